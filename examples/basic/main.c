@@ -1,8 +1,16 @@
 #include "wagon_engine.h"
 
+// First entity the engine made, its handle stops resolving if it's destroyed from the UI
+static entity_t bouncing;
+
 void example_init() {
     printf("Example init\n");
-    ecs.transforms[0].position.X = 0;
+    bouncing = ecs.transforms.entities[0];
+    transform_c_t transform;
+    if (get_transform(bouncing, &transform)) {
+        transform.position.X = 0;
+        update_transform(bouncing, &transform);
+    }
     
     // // Used for relative paths
     // char dir_path[1024];
@@ -11,11 +19,15 @@ void example_init() {
     // snprintf(mesh_path, sizeof(mesh_path), "./ball.obj");
     // printf("Loading mesh: %s\n", mesh_path);
     // // exit(1);
-    // load_mesh(1, mesh_path);
+    // load_mesh(bouncing, mesh_path);
 }
 
 void example_frame_callback() {
-    ecs.transforms[0].position.Y = sin(state.wall_time_ms / 1000.0);
+    transform_c_t transform;
+    if (get_transform(bouncing, &transform)) {
+        transform.position.Y = sin(state.wall_time_ms / 1000.0);
+        update_transform(bouncing, &transform);
+    }
 }
 
 int main() {
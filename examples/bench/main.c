@@ -0,0 +1,625 @@
+#include "wagon_engine.h"
+
+// CPU benchmarks for engine code that runs without a window or GPU.
+// Run with no arguments for all of them, or pass the names of the ones to run
+
+typedef struct {
+    const char* name;
+    void (*run)(void);
+} benchmark_t;
+
+static double elapsed_ms(uint64_t start) {
+    return stm_ms(stm_since(start));
+}
+
+// Ray through the unit cube the way the volume shader sets it up, returns false if it misses
+static bool unit_cube_ray(hmm_vec3 eye, hmm_vec3 dir, float* t0, float* t1) {
+    float tx0 = (0.0f - eye.X) / dir.X, tx1 = (1.0f - eye.X) / dir.X;
+    float ty0 = (0.0f - eye.Y) / dir.Y, ty1 = (1.0f - eye.Y) / dir.Y;
+    float tz0 = (0.0f - eye.Z) / dir.Z, tz1 = (1.0f - eye.Z) / dir.Z;
+    *t0 = HMM_MAX(HMM_MIN(tx0, tx1), HMM_MAX(HMM_MIN(ty0, ty1), HMM_MIN(tz0, tz1)));
+    *t1 = HMM_MIN(HMM_MAX(tx0, tx1), HMM_MIN(HMM_MAX(ty0, ty1), HMM_MAX(tz0, tz1)));
+    *t0 = HMM_MAX(*t0, 0.0f);
+    return *t0 < *t1;
+}
+
+// Step size the volume shader uses, one voxel along the ray's major axis
+static float march_step(hmm_vec3 dir, int size) {
+    float major = HMM_MAX(fabsf(dir.X), HMM_MAX(fabsf(dir.Y), fabsf(dir.Z)));
+    return 1.0f / (size * major);
+}
+
+static float random_float(void) {
+    return (float)rand() / (float)RAND_MAX;
+}
+
+// Print what went wrong if a check failed, returns 1 if it did
+static int check(bool ok, const char* what) {
+    if (!ok) {
+        printf("  FAILED: %s\n", what);
+    }
+    return !ok;
+}
+
+// Level the page table entry of a level 0 brick points at, or -1 if it points nowhere
+static int page_table_level(const brick_cache_t* cache, int bx, int by, int bz) {
+    return cache->page_table[((bz * cache->grid_y + by) * cache->grid_x + bx) * 4 + 3] - 1;
+}
+
+static void bench_bricks(void) {
+    // A row of four level 0 bricks, with two coarser levels of two and one brick over them
+    int failed = 0, checks = 0;
+    brick_cache_t cache;
+    brick_cache_init(&cache, 4, 1, 1, 2, 1, 1);
+    const int b0 = brick_cache_brick_index(&cache, 0, 0, 0, 0), b1 = brick_cache_brick_index(&cache, 0, 1, 0, 0);
+    const int b2 = brick_cache_brick_index(&cache, 0, 2, 0, 0), b3 = brick_cache_brick_index(&cache, 0, 3, 0, 0);
+
+    // Free slots are handed out before anything gets evicted, then the brick touched longest ago goes first
+    int evicted;
+    brick_cache_begin_frame(&cache);
+    brick_cache_acquire(&cache, b0, &evicted);
+    checks++, failed += check(evicted == -1, "a free slot evicted a brick");
+    brick_cache_acquire(&cache, b1, &evicted);
+    checks++, failed += check(evicted == -1, "a free slot evicted a brick");
+    brick_cache_begin_frame(&cache);
+    brick_cache_touch(&cache, b0);
+    brick_cache_begin_frame(&cache);
+    checks++, failed += check(brick_cache_acquire(&cache, b2, &evicted) >= 0 && evicted == b1, "LRU evicted anything but the brick untouched the longest");
+    brick_cache_begin_frame(&cache);
+    checks++, failed += check(brick_cache_acquire(&cache, b3, &evicted) >= 0 && evicted == b0, "LRU evicted anything but the brick untouched the longest");
+
+    // Bricks touched this frame stay, even if that leaves no room
+    brick_cache_begin_frame(&cache);
+    brick_cache_touch(&cache, b2);
+    brick_cache_touch(&cache, b3);
+    checks++, failed += check(brick_cache_acquire(&cache, b0, &evicted) == -1 && evicted == -1, "evicted a brick touched this frame");
+    checks++, failed += check(cache.brick_slot[b2] >= 0 && cache.brick_slot[b3] >= 0 && cache.resident_count == 2, "lost a brick touched this frame");
+    brick_cache_free(&cache);
+
+    // Entries point at the wanted level if it's resident, otherwise the nearest coarser level, otherwise the nearest finer one
+    brick_cache_init(&cache, 4, 1, 1, 2, 2, 1);
+    brick_cache_begin_frame(&cache);
+    brick_cache_acquire(&cache, brick_cache_brick_index(&cache, 0, 1, 0, 0), NULL);
+    brick_cache_acquire(&cache, brick_cache_brick_index(&cache, 0, 3, 0, 0), NULL);
+    brick_cache_acquire(&cache, brick_cache_brick_index(&cache, 1, 0, 0, 0), NULL);
+    brick_cache_acquire(&cache, brick_cache_brick_index(&cache, 2, 0, 0, 0), NULL);
+    const uint8_t wanted[4] = { 0, 1, 1, 255 };
+    brick_cache_update_page_table(&cache, wanted);
+    checks++, failed += check(page_table_level(&cache, 0, 0, 0) == 1, "missing brick didn't fall back to the next coarser level");
+    checks++, failed += check(page_table_level(&cache, 1, 0, 0) == 1, "resident brick of the wanted level wasn't used");
+    checks++, failed += check(page_table_level(&cache, 2, 0, 0) == 2, "coarser fallback skipped a level or went finer first");
+    checks++, failed += check(page_table_level(&cache, 3, 0, 0) == 2, "don't care didn't take the coarsest resident level");
+    int slot = cache.brick_slot[brick_cache_brick_index(&cache, 1, 0, 0, 0)];
+    const uint8_t* entry = &cache.page_table[0];
+    checks++, failed += check(entry[0] == slot % 2 && entry[1] == slot / 2 % 2 && entry[2] == 0, "entry has the wrong atlas slot");
+
+    // Without anything coarser, entries fall back to finer levels. Keeping the level 0 bricks evicts the other two
+    brick_cache_begin_frame(&cache);
+    brick_cache_touch(&cache, brick_cache_brick_index(&cache, 0, 1, 0, 0));
+    brick_cache_touch(&cache, brick_cache_brick_index(&cache, 0, 3, 0, 0));
+    brick_cache_acquire(&cache, brick_cache_brick_index(&cache, 1, 1, 0, 0), &evicted);
+    checks++, failed += check(evicted == brick_cache_brick_index(&cache, 1, 0, 0, 0), "LRU evicted anything but the brick untouched the longest");
+    brick_cache_acquire(&cache, brick_cache_brick_index(&cache, 0, 0, 0, 0), &evicted);
+    checks++, failed += check(evicted == brick_cache_brick_index(&cache, 2, 0, 0, 0), "LRU evicted anything but the brick untouched the longest");
+    const uint8_t wanted_coarse[4] = { 2, 2, 2, 2 };
+    brick_cache_update_page_table(&cache, wanted_coarse);
+    checks++, failed += check(page_table_level(&cache, 0, 0, 0) == 0, "missing coarse brick didn't fall back to the nearest finer level");
+    checks++, failed += check(page_table_level(&cache, 2, 0, 0) == 1, "finer fallback didn't take the nearest finer level");
+    checks++, failed += check(page_table_level(&cache, 3, 0, 0) == 1, "finer fallback didn't take the nearest finer level");
+    brick_cache_free(&cache);
+    printf("bricks: %d of %d paging checks failed\n", failed, checks);
+
+    // Page table of a scroll scan: 8192 x 8192 x 2048 voxels, with a full atlas of bricks on random levels
+    brick_cache_init(&cache, 128, 128, 32, BRICK_ATLAS_X, BRICK_ATLAS_Y, BRICK_ATLAS_Z);
+    const size_t entries = (size_t)cache.grid_x * cache.grid_y * cache.grid_z;
+    uint8_t* levels = (uint8_t*)malloc(entries);
+    for (size_t i = 0; i < entries; i++) {
+        levels[i] = (uint8_t)(rand() % 4);
+    }
+    brick_cache_begin_frame(&cache);
+    for (int i = 0; i < cache.slot_count; i++) {
+        int brick = rand() % cache.brick_count;
+        if (cache.brick_slot[brick] < 0) {
+            brick_cache_acquire(&cache, brick, NULL);
+        }
+    }
+    uint64_t start = stm_now();
+    brick_cache_update_page_table(&cache, levels);
+    printf("  %dx%dx%d brick page table updated in %.2f ms with %d bricks resident\n",
+           cache.grid_x, cache.grid_y, cache.grid_z, elapsed_ms(start), cache.resident_count);
+    free(levels);
+    brick_cache_free(&cache);
+}
+
+static void bench_empty_space_skipping(void) {
+    // A ball of noise in a mostly empty volume, like a scan surrounded by air
+    const int size = 256;
+    uint8_t* volume = (uint8_t*)calloc((size_t)size * size * size, 1);
+    for (int z = 0; z < size; z++) {
+        for (int y = 0; y < size; y++) {
+            for (int x = 0; x < size; x++) {
+                float dx = (x + 0.5f) / size - 0.5f, dy = (y + 0.5f) / size - 0.5f, dz = (z + 0.5f) / size - 0.5f;
+                if (dx * dx + dy * dy + dz * dz <= 0.3f * 0.3f) {
+                    volume[((size_t)z * size + y) * size + x] = 1 + rand() % 255;
+                }
+            }
+        }
+    }
+
+    uint64_t start = stm_now();
+    macro_grid_t grid = { 0 };
+    // Opacities of the engine's default transfer function, rising from 0 at the bottom of the window to 1 at the top
+    uint8_t colormap[COLORMAP_WIDTH * 4], opacity[256];
+    transfer_function_bake(&transfer.function, colormap, COLORMAP_WIDTH);
+    volume_opacity_table(colormap, COLORMAP_WIDTH, opacity);
+    macro_grid_build(&grid, volume, VOLUME_UINT8, size, size, size);
+    macro_grid_classify(&grid, opacity, 0.0f, 255.0f);
+    double build_ms = elapsed_ms(start);
+    size_t cell_count = (size_t)grid.cells_x * grid.cells_y * grid.cells_z;
+    size_t empty_cells = 0;
+    for (size_t i = 0; i < cell_count; i++) {
+        empty_cells += grid.occupancy[i] == 0;
+    }
+
+    // Rays from eyes around the volume towards random points inside it
+    enum { RAY_COUNT = 20000, MAX_SAMPLES = 4096 };
+    hmm_vec3* eyes = (hmm_vec3*)malloc(RAY_COUNT * sizeof(hmm_vec3));
+    hmm_vec3* dirs = (hmm_vec3*)malloc(RAY_COUNT * sizeof(hmm_vec3));
+    for (int i = 0; i < RAY_COUNT; i++) {
+        hmm_vec3 eye = HMM_Vec3(random_float() * 2.0f - 0.5f, random_float() * 2.0f - 0.5f, -1.0f + random_float() * 0.5f);
+        hmm_vec3 target = HMM_Vec3(random_float(), random_float(), random_float());
+        eyes[i] = eye;
+        dirs[i] = HMM_NormalizeVec3(HMM_SubtractVec3(target, eye));
+    }
+
+    // Time the traversal plus the volume lookups and compositing the shader would do at each sample
+    float* plain = (float*)malloc(MAX_SAMPLES * sizeof(float));
+    float* skipped = (float*)malloc(MAX_SAMPLES * sizeof(float));
+    long long samples[2] = { 0, 0 };
+    double march_ms[2] = { 0.0, 0.0 };
+    float total_alpha[2] = { 0.0f, 0.0f };
+    for (int skip = 0; skip < 2; skip++) {
+        start = stm_now();
+        for (int i = 0; i < RAY_COUNT; i++) {
+            float t0, t1;
+            if (!unit_cube_ray(eyes[i], dirs[i], &t0, &t1)) {
+                continue;
+            }
+            float dt = march_step(dirs[i], size);
+            int count = macro_grid_march(skip ? &grid : NULL, size, size, size, eyes[i], dirs[i], t0, t1, dt, plain, MAX_SAMPLES);
+            float alpha = 0.0f;
+            for (int s = 0; s < count && s < MAX_SAMPLES; s++) {
+                hmm_vec3 p = HMM_AddVec3(eyes[i], HMM_MultiplyVec3f(dirs[i], plain[s]));
+                int x = (int)HMM_Clamp(0.0f, p.X * size, size - 1);
+                int y = (int)HMM_Clamp(0.0f, p.Y * size, size - 1);
+                int z = (int)HMM_Clamp(0.0f, p.Z * size, size - 1);
+                float value = volume[((size_t)z * size + y) * size + x] / 255.0f;
+                alpha += (1.0f - alpha) * value;
+            }
+            total_alpha[skip] += alpha;
+            samples[skip] += count;
+        }
+        march_ms[skip] = elapsed_ms(start);
+    }
+
+    // Skipping has to take exactly the samples of the plain march that land in occupied cells
+    int mismatched = 0;
+    for (int i = 0; i < RAY_COUNT; i++) {
+        float t0, t1;
+        if (!unit_cube_ray(eyes[i], dirs[i], &t0, &t1)) {
+            continue;
+        }
+        float dt = march_step(dirs[i], size);
+        int plain_count = macro_grid_march(NULL, size, size, size, eyes[i], dirs[i], t0, t1, dt, plain, MAX_SAMPLES);
+        int skipped_count = macro_grid_march(&grid, size, size, size, eyes[i], dirs[i], t0, t1, dt, skipped, MAX_SAMPLES);
+        int kept = 0;
+        bool match = true;
+        for (int s = 0; s < plain_count && s < MAX_SAMPLES && match; s++) {
+            hmm_vec3 p = HMM_AddVec3(eyes[i], HMM_MultiplyVec3f(dirs[i], plain[s]));
+            if (grid.occupancy[macro_grid_cell(&grid, size, size, size, p)] == 0) {
+                continue;
+            }
+            match = kept < skipped_count && skipped[kept] == plain[s];
+            kept++;
+        }
+        mismatched += !match || kept != skipped_count;
+    }
+
+    printf("empty space skipping: %dx%dx%d volume, %zu of %zu macro cells empty, grid built in %.2f ms\n",
+           size, size, size, empty_cells, cell_count, build_ms);
+    printf("  plain march    %8.2f ms, %.1f samples/ray, mean alpha %.4f\n", march_ms[0], (double)samples[0] / RAY_COUNT, total_alpha[0] / RAY_COUNT);
+    printf("  skipping march %8.2f ms, %.1f samples/ray, mean alpha %.4f\n", march_ms[1], (double)samples[1] / RAY_COUNT, total_alpha[1] / RAY_COUNT);
+    printf("  %d of %d rays sampled differently than the plain march\n", mismatched, RAY_COUNT);
+
+    free(plain);
+    free(skipped);
+    free(eyes);
+    free(dirs);
+    macro_grid_free(&grid);
+    free(volume);
+}
+
+// Smooth blobs of tissue-like values with a little noise, inside a ball of air
+static uint8_t synthetic_scan(int x, int y, int z, int size) {
+    float dx = (x + 0.5f) / size - 0.5f, dy = (y + 0.5f) / size - 0.5f, dz = (z + 0.5f) / size - 0.5f;
+    float r = sqrtf(dx * dx + dy * dy + dz * dz);
+    if (r > 0.45f) {
+        return 0;
+    }
+    float tissue = 120.0f + 60.0f * sinf(x * 0.11f) * cosf(y * 0.07f + z * 0.05f) + 40.0f * (r < 0.15f);
+    return (uint8_t)HMM_Clamp(1.0f, tissue + (rand() % 9 - 4), 255.0f);
+}
+
+static void bench_bc4(void) {
+    const int size = 256;
+    const size_t count = (size_t)size * size * size;
+    const size_t blocks_size = bc4_slice_size(size, size) * size;
+    uint8_t* volume = (uint8_t*)malloc(count);
+    uint8_t* decoded = (uint8_t*)malloc(count);
+    uint8_t* blocks = (uint8_t*)malloc(blocks_size);
+    const char* names[] = { "scan", "sphere of noise", "white noise" };
+    const int threads = parallel_thread_count();
+    printf("bc4: %dx%dx%d uint8 volumes, %.1f MB as R8, %.1f MB as BC4\n", size, size, size, count / 1e6, blocks_size / 1e6);
+    for (int kind = 0; kind < 3; kind++) {
+        for (int z = 0; z < size; z++) {
+            for (int y = 0; y < size; y++) {
+                for (int x = 0; x < size; x++) {
+                    float dx = (x + 0.5f) / size - 0.5f, dy = (y + 0.5f) / size - 0.5f, dz = (z + 0.5f) / size - 0.5f;
+                    uint8_t value = kind == 0 ? synthetic_scan(x, y, z, size)
+                                  : kind == 1 ? (dx * dx + dy * dy + dz * dz <= 0.3f * 0.3f ? 1 + rand() % 255 : 0)
+                                  : rand() % 256;
+                    volume[((size_t)z * size + y) * size + x] = value;
+                }
+            }
+        }
+
+        // Single threaded, then one thread per core
+        double encode_ms[2];
+        for (int pass = 0; pass < 2; pass++) {
+            uint64_t start = stm_now();
+            bc4_encode_volume(volume, size, size, size, blocks, pass == 0 ? 1 : threads);
+            encode_ms[pass] = elapsed_ms(start);
+        }
+        uint64_t start = stm_now();
+        bc4_decode_volume(blocks, size, size, size, decoded);
+        double decode_ms = elapsed_ms(start);
+
+        double squared_error = 0.0;
+        int max_error = 0;
+        for (size_t i = 0; i < count; i++) {
+            int error = abs((int)volume[i] - (int)decoded[i]);
+            squared_error += (double)error * error;
+            max_error = error > max_error ? error : max_error;
+        }
+        double mse = squared_error / count;
+        double psnr = mse > 0.0 ? 10.0 * log10(255.0 * 255.0 / mse) : INFINITY;
+        printf("  %-16s PSNR %6.2f dB, max error %3d, encode %7.1f MB/s on 1 thread, %7.1f MB/s on %d, decode %7.1f MB/s\n",
+               names[kind], psnr, max_error, count / 1e3 / encode_ms[0], count / 1e3 / encode_ms[1], threads, count / 1e3 / decode_ms);
+    }
+    free(volume);
+    free(decoded);
+    free(blocks);
+}
+
+// Value along a ray at x voxels in: smooth data, a ramp across the volume like the soft edge of an object
+static float ramp_value(float x) {
+    return HMM_Clamp(0.0f, x / 32.0f * 0.6f, 0.6f);
+}
+
+static float colormap_channel(const uint8_t* colormap, int width, float v, int c) {
+    float x = v * (width - 1);
+    int i = HMM_MIN((int)x, width - 2);
+    return (colormap[i * 4 + c] * (1.0f - (x - i)) + colormap[(i + 1) * 4 + c] * (x - i)) / 255.0f;
+}
+
+// March the ramp from offset in steps of stride voxels, the way the volume shader composites. Pre-integrated
+// marches look up (nearest) table entries, the others color each sample on its own
+static void march_ramp(const uint8_t* colormap, int width, const uint16_t* table, float offset, float stride, float rgb[3]) {
+    float alpha_sum = 0.0f, prev = -1.0f;
+    rgb[0] = rgb[1] = rgb[2] = 0.0f;
+    for (float x = offset; x < 40.0f; x += stride) {
+        float v = ramp_value(x);
+        float color[3], a;
+        if (table) {
+            float front = prev < 0.0f ? v : prev;
+            const uint16_t* entry = &table[((size_t)lroundf(v * (TRANSFER_TABLE_SIZE - 1)) * TRANSFER_TABLE_SIZE + lroundf(front * (TRANSFER_TABLE_SIZE - 1))) * 4];
+            float segment_alpha = half_to_float(entry[3]);
+            a = 1.0f - powf(1.0f - segment_alpha, stride);
+            for (int c = 0; c < 3; c++) {
+                color[c] = half_to_float(entry[c]) * (a / (HMM_MAX(segment_alpha, 1e-6f)));
+            }
+        } else {
+            a = 1.0f - powf(1.0f - v, stride);
+            for (int c = 0; c < 3; c++) {
+                color[c] = colormap_channel(colormap, width, v, c) * a;
+            }
+        }
+        for (int c = 0; c < 3; c++) {
+            rgb[c] += (1.0f - alpha_sum) * color[c];
+        }
+        alpha_sum += (1.0f - alpha_sum) * a;
+        prev = v;
+    }
+}
+
+static void bench_preintegration(void) {
+    // The engine's blue to red colormap, plus a narrow green band picking out one value, as an iso-surface would.
+    // Sharp features of the transfer function are what per-sample coloring slices into slabs
+    enum { WIDTH = 260 };
+    uint8_t colormap[WIDTH * 4];
+    for (int i = 0; i < WIDTH; i++) {
+        float t = (float)i / (WIDTH - 1);
+        bool band = t > 0.3f && t < 0.32f;
+        colormap[i * 4 + 0] = band ? 0 : (uint8_t)((1.0f - t) * 255);
+        colormap[i * 4 + 1] = band ? 255 : 0;
+        colormap[i * 4 + 2] = band ? 0 : (uint8_t)(t * 255);
+        colormap[i * 4 + 3] = (uint8_t)(t * 255);
+    }
+    uint16_t* table = (uint16_t*)malloc(TRANSFER_TABLE_SIZE * TRANSFER_TABLE_SIZE * 4 * sizeof(uint16_t));
+    const int threads = parallel_thread_count();
+    double bake_ms[2];
+    for (int pass = 0; pass < 2; pass++) {
+        uint64_t start = stm_now();
+        preintegrate_transfer_function(colormap, WIDTH, table, TRANSFER_TABLE_SIZE, pass == 0 ? 1 : threads);
+        bake_ms[pass] = elapsed_ms(start);
+    }
+    printf("pre-integration: %dx%d table baked in %.2f ms on 1 thread, %.2f ms on %d\n",
+           TRANSFER_TABLE_SIZE, TRANSFER_TABLE_SIZE, bake_ms[0], bake_ms[1], threads);
+
+    // Error against a very fine march, averaged over where the first sample lands
+    enum { OFFSETS = 64 };
+    const float strides[] = { 1.0f, 2.0f, 4.0f, 8.0f };
+    for (int s = 0; s < 4; s++) {
+        double error[2] = { 0.0, 0.0 };
+        for (int o = 0; o < OFFSETS; o++) {
+            float offset = strides[s] * o / OFFSETS, reference[3], rgb[3];
+            march_ramp(colormap, WIDTH, NULL, offset, 1.0f / 64.0f, reference);
+            for (int preintegrated = 0; preintegrated < 2; preintegrated++) {
+                march_ramp(colormap, WIDTH, preintegrated ? table : NULL, offset, strides[s], rgb);
+                error[preintegrated] += (fabsf(rgb[0] - reference[0]) + fabsf(rgb[1] - reference[1]) + fabsf(rgb[2] - reference[2])) / 3.0f;
+            }
+        }
+        printf("  step %.0f voxels: mean color error %.4f per sample, %.4f pre-integrated\n",
+               strides[s], error[0] / OFFSETS, error[1] / OFFSETS);
+    }
+    free(table);
+}
+
+// Model matrix the way frame() used to build it, one HMM_Rotate and HMM_MultiplyMat4 per axis
+static hmm_mat4 hmm_model_matrix(float px, float py, float pz, float rx, float ry, float rz) {
+    hmm_mat4 model = HMM_Translate(HMM_Vec3(px, py, pz));
+    model = HMM_MultiplyMat4(model, HMM_Rotate(rx, HMM_Vec3(1.0f, 0.0f, 0.0f)));
+    model = HMM_MultiplyMat4(model, HMM_Rotate(ry, HMM_Vec3(0.0f, 1.0f, 0.0f)));
+    model = HMM_MultiplyMat4(model, HMM_Rotate(rz, HMM_Vec3(0.0f, 0.0f, 1.0f)));
+    return model;
+}
+
+static void bench_transforms(void) {
+#if defined(TRANSFORM_LANES)
+    printf("transforms: %d at a time\n", TRANSFORM_LANES);
+#else
+    printf("transforms: no vector path on this target\n");
+#endif
+    const uint32_t counts[] = { 10000, 100000, 1000000 };
+    const uint32_t largest = counts[2];
+    float* columns[6];
+    for (int c = 0; c < 6; c++) {
+        columns[c] = (float*)malloc(largest * sizeof(float));
+        for (uint32_t i = 0; i < largest; i++) {
+            columns[c][i] = c < 3 ? random_float() * 100.0f - 50.0f : random_float() * 720.0f - 360.0f;
+        }
+    }
+    const float* const position[3] = { columns[0], columns[1], columns[2] };
+    const float* const rotation[3] = { columns[3], columns[4], columns[5] };
+    hmm_mat4* world = (hmm_mat4*)malloc(largest * sizeof(hmm_mat4));
+    hmm_mat4* reference = (hmm_mat4*)malloc(largest * sizeof(hmm_mat4));
+
+    for (int n = 0; n < 3; n++) {
+        const uint32_t count = counts[n];
+        const int repeats = (int)(4000000 / count);
+        double ms[3];
+        uint64_t start = stm_now();
+        for (int r = 0; r < repeats; r++) {
+            for (uint32_t i = 0; i < count; i++) {
+                reference[i] = hmm_model_matrix(columns[0][i], columns[1][i], columns[2][i], columns[3][i], columns[4][i], columns[5][i]);
+            }
+        }
+        ms[0] = elapsed_ms(start) / repeats;
+        start = stm_now();
+        for (int r = 0; r < repeats; r++) {
+            compose_transforms_scalar(position, rotation, world, 0, count);
+        }
+        ms[1] = elapsed_ms(start) / repeats;
+        start = stm_now();
+        for (int r = 0; r < repeats; r++) {
+            compose_transforms(position, rotation, world, count);
+        }
+        ms[2] = elapsed_ms(start) / repeats;
+
+        float error = 0.0f;
+        for (uint32_t i = 0; i < count; i++) {
+            for (int e = 0; e < 16; e++) {
+                error = HMM_MAX(error, fabsf((&world[i].Elements[0][0])[e] - (&reference[i].Elements[0][0])[e]));
+            }
+        }
+        printf("  %7u transforms: HMM %8.3f ms, scalar %8.3f ms, vector %8.3f ms (%.1f ns each, %.1fx HMM), max error %.2g\n",
+               count, ms[0], ms[1], ms[2], ms[2] * 1e6 / count, ms[0] / ms[2], error);
+    }
+    for (int c = 0; c < 6; c++) {
+        free(columns[c]);
+    }
+    free(world);
+    free(reference);
+}
+
+// The obvious welder: look every corner up in the vertices so far, one at a time
+static void weld_naive(const fastObjMesh* obj, welded_mesh_t* welded) {
+    welded->vertices = (fastObjIndex*)malloc(((size_t)obj->index_count + 1) * sizeof(fastObjIndex));
+    welded->indices = (uint32_t*)malloc(((size_t)obj->index_count * 3 + 1) * sizeof(uint32_t));
+    uint32_t* corners = (uint32_t*)malloc(((size_t)obj->index_count + 1) * sizeof(uint32_t));
+    welded->vertex_count = welded->index_count = 0;
+    for (unsigned c = 0; c < obj->index_count; c++) {
+        const fastObjIndex key = obj->indices[c];
+        uint32_t v = 0;
+        while (v < welded->vertex_count && (welded->vertices[v].p != key.p || welded->vertices[v].t != key.t || welded->vertices[v].n != key.n)) {
+            v++;
+        }
+        if (v == welded->vertex_count) {
+            welded->vertices[welded->vertex_count++] = key;
+        }
+        corners[c] = v;
+    }
+    for (unsigned f = 0, first = 0; f < obj->face_count; first += obj->face_vertices[f++]) {
+        for (unsigned k = 2; k < obj->face_vertices[f]; k++) {
+            welded->indices[welded->index_count++] = corners[first];
+            welded->indices[welded->index_count++] = corners[first + k - 1];
+            welded->indices[welded->index_count++] = corners[first + k];
+        }
+    }
+    free(corners);
+}
+
+static void bench_weld(void) {
+    printf("weld:\n");
+    char dir_path[1024];
+    get_dir_from_file(__FILE__, dir_path, sizeof(dir_path));
+    const char* names[] = { "teapot.obj", "monkey.obj" };
+    for (int n = 0; n < 2; n++) {
+        char path[1100];
+        snprintf(path, sizeof(path), "%s/../../assets/%s", dir_path, names[n]);
+        fastObjMesh* obj = fast_obj_read(path);
+        if (!obj) {
+            printf("  %s: couldn't read %s\n", names[n], path);
+            continue;
+        }
+        const int repeats = 20;
+        welded_mesh_t hashed = { 0 }, naive = { 0 };
+        uint64_t start = stm_now();
+        for (int r = 0; r < repeats; r++) {
+            free_welded_mesh(&hashed);
+            weld_obj_mesh(obj, &hashed);
+        }
+        double hashed_ms = elapsed_ms(start) / repeats;
+        start = stm_now();
+        for (int r = 0; r < repeats; r++) {
+            free_welded_mesh(&naive);
+            weld_naive(obj, &naive);
+        }
+        double naive_ms = elapsed_ms(start) / repeats;
+
+        const bool same = hashed.vertex_count == naive.vertex_count && hashed.index_count == naive.index_count &&
+                          memcmp(hashed.indices, naive.indices, hashed.index_count * sizeof(uint32_t)) == 0;
+        printf("  %-10s %6u corners -> %6u vertices (%u positions): hashed %7.3f ms, naive %8.3f ms (%.0fx), %s\n",
+               names[n], obj->index_count, hashed.vertex_count, obj->position_count - 1, hashed_ms, naive_ms,
+               naive_ms / hashed_ms, same ? "same result" : "RESULTS DIFFER");
+        free_welded_mesh(&hashed);
+        free_welded_mesh(&naive);
+        fast_obj_destroy(obj);
+    }
+}
+
+static void bench_import(void) {
+    printf("import:\n");
+    char dir_path[1024];
+    get_dir_from_file(__FILE__, dir_path, sizeof(dir_path));
+
+    // A flat grid of a million vertices, the size of a scanned surface
+    const int grid = 1000;
+    char grid_path[1100];
+    snprintf(grid_path, sizeof(grid_path), "%s/bench_grid.obj", P_tmpdir);
+    FILE* file = fopen(grid_path, "w");
+    if (file) {
+        for (int y = 0; y < grid; y++) {
+            for (int x = 0; x < grid; x++) {
+                fprintf(file, "v %d %d 0\n", x, y);
+            }
+        }
+        for (int y = 0; y + 1 < grid; y++) {
+            for (int x = 0; x + 1 < grid; x++) {
+                int v = y * grid + x + 1;
+                fprintf(file, "f %d %d %d %d\n", v, v + 1, v + grid + 1, v + grid);
+            }
+        }
+        fclose(file);
+    }
+
+    char paths[3][1100];
+    snprintf(paths[0], sizeof(paths[0]), "%s/../../assets/teapot.obj", dir_path);
+    snprintf(paths[1], sizeof(paths[1]), "%s/../../assets/monkey.obj", dir_path);
+    snprintf(paths[2], sizeof(paths[2]), "%s", grid_path);
+    const char* names[] = { "teapot", "monkey", "grid" };
+    for (int n = 0; n < 3; n++) {
+        const int repeats = n < 2 ? 20 : 1;
+        mesh_import_stats_t total = { 0 };
+        for (int r = 0; r < repeats; r++) {
+            mesh_c_t mesh;
+            if (!import_obj_mesh(&mesh, paths[n], 1.0f, 0.0f, 0.0f)) {
+                break;
+            }
+            total.parse_ms += mesh_import_stats.parse_ms / repeats;
+            total.convert_ms += mesh_import_stats.convert_ms / repeats;
+            free(mesh._vertices);
+            free(mesh._indices);
+        }
+
+        // Mapping its cache instead, and reading every byte of it the way the upload would
+        const unsigned vertex_count = mesh_import_stats.vertex_count;
+        const unsigned index_count = mesh_import_stats.index_count;
+        double cached_ms = 0.0;
+        struct stat source;
+        mesh_c_t mesh;
+        const float rgba[] = { 1.0f, 0.0f, 0.0f, 1.0f };
+        char cache_path[1100];
+        snprintf(cache_path, sizeof(cache_path), "%s/bench_mesh.cache", P_tmpdir);
+        if (stat(paths[n], &source) == 0 && import_obj_mesh(&mesh, paths[n], 1.0f, 0.0f, 0.0f)) {
+            write_mesh_cache(&mesh, cache_path, &source, rgba);
+            free(mesh._vertices);
+            free(mesh._indices);
+            for (int r = 0; r < repeats; r++) {
+                uint64_t start = stm_now();
+                if (!map_mesh_cache(&mesh, cache_path, &source, rgba)) {
+                    break;
+                }
+                volatile uint32_t sum = 0; // Kept, so the reads are too
+                const uint8_t* bytes = (const uint8_t*)mesh._mapped;
+                for (size_t i = 0; i < mesh._mapped_size; i += 64) {
+                    sum += bytes[i];
+                }
+                cached_ms += stm_ms(stm_since(start)) / repeats;
+                mesh_free_data(&mesh);
+            }
+            remove(cache_path);
+        }
+        // Vertex memory against the 28 bytes of float position and color per vertex it used to take
+        printf("  %-7s %8u vertices %8u indices (%d-bit): parse %8.3f ms, convert %8.3f ms, cached %8.3f ms, vertices %6.2f MB (%6.2f MB as floats)\n",
+               names[n], vertex_count, index_count, mesh_index_type(vertex_count) == SG_INDEXTYPE_UINT32 ? 32 : 16,
+               total.parse_ms, total.convert_ms, cached_ms, vertex_count * sizeof(mesh_vertex_t) / 1e6,
+               vertex_count * 7 * sizeof(float) / 1e6);
+    }
+    remove(grid_path);
+}
+
+static const benchmark_t benchmarks[] = {
+    { "bricks", bench_bricks },
+    { "skip", bench_empty_space_skipping },
+    { "bc4", bench_bc4 },
+    { "preint", bench_preintegration },
+    { "transforms", bench_transforms },
+    { "weld", bench_weld },
+    { "import", bench_import },
+};
+
+int main(int argc, char** argv) {
+    stm_setup();
+    srand(1);
+    for (size_t i = 0; i < sizeof(benchmarks) / sizeof(benchmarks[0]); i++) {
+        bool selected = argc < 2;
+        for (int a = 1; a < argc; a++) {
+            selected = selected || strcmp(argv[a], benchmarks[i].name) == 0;
+        }
+        if (selected) {
+            benchmarks[i].run();
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,56 @@
+@vs vs_composite
+
+void main(void) {
+	// One triangle covering the whole target, no vertex buffer needed
+	vec2 corner = vec2(float((gl_VertexIndex << 1) & 2), float(gl_VertexIndex & 2));
+	gl_Position = vec4(corner * 2.0 - 1.0, 0.5, 1.0);
+}
+@end
+
+@fs fs_composite
+uniform fs_composite_params {
+    vec2 source_size;
+    vec2 target_size;
+    float weight;
+    float depth_tolerance;
+    int upsample;
+};
+
+uniform texture2D source;
+uniform sampler point_smp;
+uniform texture2D full_distance;
+
+out vec4 frag_color;
+
+void main(void) {
+	ivec2 pixel = ivec2(gl_FragCoord.xy);
+	if (upsample == 0) {
+		frag_color = texelFetch(sampler2D(source, point_smp), pixel, 0) * weight;
+	} else {
+		// Blend the four source texels around the pixel bilinearly, but only as far as the meshes' distance
+		// at each texel agrees with the distance here, so volumes don't bleed across the edges of meshes in front of them.
+		// A texel saw the scene at its center, which is where its distance is looked up
+		vec2 texel_scale = source_size / target_size;
+		vec2 p = gl_FragCoord.xy * texel_scale - 0.5;
+		ivec2 base = ivec2(floor(p));
+		vec2 f = p - floor(p);
+		float center = texelFetch(sampler2D(full_distance, point_smp), pixel, 0).r;
+		vec4 sum = vec4(0.0, 0.0, 0.0, 0.0);
+		float total = 0.0;
+		for (int i = 0; i < 4; i++) {
+			ivec2 offset = ivec2(i & 1, i >> 1);
+			ivec2 texel = clamp(base + offset, ivec2(0, 0), ivec2(source_size) - ivec2(1, 1));
+			ivec2 seen = min(ivec2((vec2(texel) + 0.5) / texel_scale), ivec2(target_size) - ivec2(1, 1));
+			float difference = abs(texelFetch(sampler2D(full_distance, point_smp), seen, 0).r - center) / max(center, 1e-3);
+			vec2 bilinear = mix(vec2(1.0, 1.0) - f, f, vec2(offset));
+			float w = bilinear.x * bilinear.y / (depth_tolerance + difference);
+			sum += texelFetch(sampler2D(source, point_smp), texel, 0) * w;
+			total += w;
+		}
+		frag_color = sum * (weight / max(total, 1e-8));
+	}
+}
+@end
+
+
+@program composite vs_composite fs_composite
\ No newline at end of file
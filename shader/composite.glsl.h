@@ -0,0 +1,826 @@
+#pragma once
+/*
+    #version:1# (machine generated, don't edit!)
+
+    Generated by sokol-shdc (https://github.com/floooh/sokol-tools)
+
+    Cmdline:
+        sokol-shdc --input shader/composite.glsl --output shader/composite.glsl.h --slang glsl430:hlsl5:metal_macos -f sokol
+
+    Overview:
+    =========
+    Shader program: 'composite':
+        Get shader desc: composite_shader_desc(sg_query_backend());
+        Vertex shader: vs_composite
+        Fragment shader: fs_composite
+            Uniform block 'fs_composite_params':
+                C struct: fs_composite_params_t
+                Bind slot: SLOT_fs_composite_params => 0
+            Image 'source':
+                Image type: SG_IMAGETYPE_2D
+                Sample type: SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT
+                Multisampled: false
+                Bind slot: SLOT_source => 0
+            Image 'full_distance':
+                Image type: SG_IMAGETYPE_2D
+                Sample type: SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT
+                Multisampled: false
+                Bind slot: SLOT_full_distance => 1
+            Sampler 'point_smp':
+                Type: SG_SAMPLERTYPE_NONFILTERING
+                Bind slot: SLOT_point_smp => 0
+            Image Sampler Pair 'source_point_smp':
+                Image: source
+                Sampler: point_smp
+            Image Sampler Pair 'full_distance_point_smp':
+                Image: full_distance
+                Sampler: point_smp
+*/
+#if !defined(SOKOL_GFX_INCLUDED)
+#error "Please include sokol_gfx.h before composite.glsl.h"
+#endif
+#if !defined(SOKOL_SHDC_ALIGN)
+#if defined(_MSC_VER)
+#define SOKOL_SHDC_ALIGN(a) __declspec(align(a))
+#else
+#define SOKOL_SHDC_ALIGN(a) __attribute__((aligned(a)))
+#endif
+#endif
+#define SLOT_fs_composite_params (0)
+#define SLOT_source (0)
+#define SLOT_full_distance (1)
+#define SLOT_point_smp (0)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct fs_composite_params_t {
+    float source_size[2];
+    float target_size[2];
+    float weight;
+    float depth_tolerance;
+    int upsample;
+    uint8_t _pad_28[4];
+} fs_composite_params_t;
+#pragma pack(pop)
+/*
+    #version 430
+
+
+    void main()
+    {
+        vec2 corner = vec2(float((gl_VertexID << 1) & 2), float(gl_VertexID & 2));
+        gl_Position = vec4(corner * 2.0 - 1.0, 0.5, 1.0);
+    }
+
+*/
+static const uint8_t vs_composite_source_glsl430[166] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x0a,0x76,
+    0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x3d,0x20,0x76,
+    0x65,0x63,0x32,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x67,0x6c,0x5f,0x56,0x65,
+    0x72,0x74,0x65,0x78,0x49,0x44,0x20,0x3c,0x3c,0x20,0x31,0x29,0x20,0x26,0x20,0x32,
+    0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,
+    0x65,0x78,0x49,0x44,0x20,0x26,0x20,0x32,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,0x65,
+    0x63,0x34,0x28,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x2a,0x20,0x32,0x2e,0x30,0x20,
+    0x2d,0x20,0x31,0x2e,0x30,0x2c,0x20,0x30,0x2e,0x35,0x2c,0x20,0x31,0x2e,0x30,0x29,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 430
+
+    struct fs_composite_params
+    {
+        vec2 source_size;
+        vec2 target_size;
+        float weight;
+        float depth_tolerance;
+        int upsample;
+    };
+
+    uniform fs_composite_params _17;
+
+    layout(binding = 0) uniform sampler2D source_point_smp;
+    layout(binding = 1) uniform sampler2D full_distance_point_smp;
+
+    layout(location = 0) out vec4 frag_color;
+
+    void main()
+    {
+        ivec2 pixel = ivec2(gl_FragCoord.xy);
+        if (_17.upsample == 0) {
+            frag_color = texelFetch(source_point_smp, pixel, 0) * _17.weight;
+        } else {
+            vec2 texel_scale = _17.source_size / _17.target_size;
+            vec2 p = gl_FragCoord.xy * texel_scale - 0.5;
+            ivec2 base = ivec2(floor(p));
+            vec2 f = p - floor(p);
+            float center = texelFetch(full_distance_point_smp, pixel, 0).r;
+            vec4 sum = vec4(0.0, 0.0, 0.0, 0.0);
+            float total = 0.0;
+            for (int i = 0; i < 4; i++) {
+                ivec2 offset = ivec2(i & 1, i >> 1);
+                ivec2 texel = clamp(base + offset, ivec2(0, 0), ivec2(_17.source_size) - ivec2(1, 1));
+                ivec2 seen = min(ivec2((vec2(texel) + 0.5) / texel_scale), ivec2(_17.target_size) - ivec2(1, 1));
+                float difference = abs(texelFetch(full_distance_point_smp, seen, 0).r - center) / max(center, 1e-3);
+                vec2 bilinear = mix(vec2(1.0, 1.0) - f, f, vec2(offset));
+                float w = bilinear.x * bilinear.y / (_17.depth_tolerance + difference);
+                sum += texelFetch(source_point_smp, texel, 0) * w;
+                total += w;
+            }
+            frag_color = sum * (_17.weight / max(total, 1e-8));
+        }
+    }
+
+*/
+static const uint8_t fs_composite_source_glsl430[1582] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x73,0x74,
+    0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x63,0x6f,0x6d,0x70,0x6f,0x73,0x69,0x74,
+    0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x32,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x69,0x7a,0x65,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x74,0x61,0x72,0x67,0x65,0x74,
+    0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x77,0x65,0x69,0x67,0x68,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x64,0x65,0x70,0x74,0x68,0x5f,0x74,0x6f,0x6c,0x65,0x72,0x61,0x6e,
+    0x63,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x75,0x70,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,
+    0x6d,0x20,0x66,0x73,0x5f,0x63,0x6f,0x6d,0x70,0x6f,0x73,0x69,0x74,0x65,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x20,0x5f,0x31,0x37,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,
+    0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x30,0x29,0x20,
+    0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,
+    0x44,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x70,0x6f,0x69,0x6e,0x74,0x5f,0x73,
+    0x6d,0x70,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,
+    0x6e,0x67,0x20,0x3d,0x20,0x31,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x66,0x75,0x6c,0x6c,0x5f,0x64,
+    0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x70,0x6f,0x69,0x6e,0x74,0x5f,0x73,0x6d,
+    0x70,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,
+    0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x76,0x65,0x63,0x32,0x20,0x70,0x69,0x78,0x65,0x6c,0x20,0x3d,0x20,0x69,
+    0x76,0x65,0x63,0x32,0x28,0x67,0x6c,0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6f,0x72,
+    0x64,0x2e,0x78,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,
+    0x31,0x37,0x2e,0x75,0x70,0x73,0x61,0x6d,0x70,0x6c,0x65,0x20,0x3d,0x3d,0x20,0x30,
+    0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,
+    0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,
+    0x74,0x63,0x68,0x28,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x70,0x6f,0x69,0x6e,0x74,
+    0x5f,0x73,0x6d,0x70,0x2c,0x20,0x70,0x69,0x78,0x65,0x6c,0x2c,0x20,0x30,0x29,0x20,
+    0x2a,0x20,0x5f,0x31,0x37,0x2e,0x77,0x65,0x69,0x67,0x68,0x74,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x74,0x65,0x78,0x65,0x6c,0x5f,0x73,0x63,
+    0x61,0x6c,0x65,0x20,0x3d,0x20,0x5f,0x31,0x37,0x2e,0x73,0x6f,0x75,0x72,0x63,0x65,
+    0x5f,0x73,0x69,0x7a,0x65,0x20,0x2f,0x20,0x5f,0x31,0x37,0x2e,0x74,0x61,0x72,0x67,
+    0x65,0x74,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x20,0x3d,0x20,0x67,0x6c,0x5f,0x46,0x72,0x61,
+    0x67,0x43,0x6f,0x6f,0x72,0x64,0x2e,0x78,0x79,0x20,0x2a,0x20,0x74,0x65,0x78,0x65,
+    0x6c,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x2d,0x20,0x30,0x2e,0x35,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x76,0x65,0x63,0x32,0x20,0x62,0x61,0x73,
+    0x65,0x20,0x3d,0x20,0x69,0x76,0x65,0x63,0x32,0x28,0x66,0x6c,0x6f,0x6f,0x72,0x28,
+    0x70,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
+    0x32,0x20,0x66,0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,0x66,0x6c,0x6f,0x6f,0x72,0x28,
+    0x70,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x63,0x65,0x6e,0x74,0x65,0x72,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,
+    0x46,0x65,0x74,0x63,0x68,0x28,0x66,0x75,0x6c,0x6c,0x5f,0x64,0x69,0x73,0x74,0x61,
+    0x6e,0x63,0x65,0x5f,0x70,0x6f,0x69,0x6e,0x74,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x70,
+    0x69,0x78,0x65,0x6c,0x2c,0x20,0x30,0x29,0x2e,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x73,0x75,0x6d,0x20,0x3d,0x20,0x76,
+    0x65,0x63,0x34,0x28,0x30,0x2e,0x30,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x30,0x2e,
+    0x30,0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x6f,0x74,0x61,0x6c,0x20,0x3d,0x20,0x30,
+    0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,
+    0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,
+    0x34,0x3b,0x20,0x69,0x2b,0x2b,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x76,0x65,0x63,0x32,0x20,0x6f,0x66,0x66,0x73,
+    0x65,0x74,0x20,0x3d,0x20,0x69,0x76,0x65,0x63,0x32,0x28,0x69,0x20,0x26,0x20,0x31,
+    0x2c,0x20,0x69,0x20,0x3e,0x3e,0x20,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x76,0x65,0x63,0x32,0x20,0x74,0x65,0x78,
+    0x65,0x6c,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x62,0x61,0x73,0x65,0x20,
+    0x2b,0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x2c,0x20,0x69,0x76,0x65,0x63,0x32,0x28,
+    0x30,0x2c,0x20,0x30,0x29,0x2c,0x20,0x69,0x76,0x65,0x63,0x32,0x28,0x5f,0x31,0x37,
+    0x2e,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x69,0x7a,0x65,0x29,0x20,0x2d,0x20,
+    0x69,0x76,0x65,0x63,0x32,0x28,0x31,0x2c,0x20,0x31,0x29,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x76,0x65,0x63,0x32,0x20,
+    0x73,0x65,0x65,0x6e,0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,0x69,0x76,0x65,0x63,0x32,
+    0x28,0x28,0x76,0x65,0x63,0x32,0x28,0x74,0x65,0x78,0x65,0x6c,0x29,0x20,0x2b,0x20,
+    0x30,0x2e,0x35,0x29,0x20,0x2f,0x20,0x74,0x65,0x78,0x65,0x6c,0x5f,0x73,0x63,0x61,
+    0x6c,0x65,0x29,0x2c,0x20,0x69,0x76,0x65,0x63,0x32,0x28,0x5f,0x31,0x37,0x2e,0x74,
+    0x61,0x72,0x67,0x65,0x74,0x5f,0x73,0x69,0x7a,0x65,0x29,0x20,0x2d,0x20,0x69,0x76,
+    0x65,0x63,0x32,0x28,0x31,0x2c,0x20,0x31,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,
+    0x66,0x66,0x65,0x72,0x65,0x6e,0x63,0x65,0x20,0x3d,0x20,0x61,0x62,0x73,0x28,0x74,
+    0x65,0x78,0x65,0x6c,0x46,0x65,0x74,0x63,0x68,0x28,0x66,0x75,0x6c,0x6c,0x5f,0x64,
+    0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x70,0x6f,0x69,0x6e,0x74,0x5f,0x73,0x6d,
+    0x70,0x2c,0x20,0x73,0x65,0x65,0x6e,0x2c,0x20,0x30,0x29,0x2e,0x72,0x20,0x2d,0x20,
+    0x63,0x65,0x6e,0x74,0x65,0x72,0x29,0x20,0x2f,0x20,0x6d,0x61,0x78,0x28,0x63,0x65,
+    0x6e,0x74,0x65,0x72,0x2c,0x20,0x31,0x65,0x2d,0x33,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x62,0x69,
+    0x6c,0x69,0x6e,0x65,0x61,0x72,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x76,0x65,0x63,
+    0x32,0x28,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x20,0x2d,0x20,0x66,0x2c,
+    0x20,0x66,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x6f,0x66,0x66,0x73,0x65,0x74,0x29,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x77,0x20,0x3d,0x20,0x62,0x69,0x6c,0x69,0x6e,0x65,0x61,
+    0x72,0x2e,0x78,0x20,0x2a,0x20,0x62,0x69,0x6c,0x69,0x6e,0x65,0x61,0x72,0x2e,0x79,
+    0x20,0x2f,0x20,0x28,0x5f,0x31,0x37,0x2e,0x64,0x65,0x70,0x74,0x68,0x5f,0x74,0x6f,
+    0x6c,0x65,0x72,0x61,0x6e,0x63,0x65,0x20,0x2b,0x20,0x64,0x69,0x66,0x66,0x65,0x72,
+    0x65,0x6e,0x63,0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x73,0x75,0x6d,0x20,0x2b,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x46,
+    0x65,0x74,0x63,0x68,0x28,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x70,0x6f,0x69,0x6e,
+    0x74,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x74,0x65,0x78,0x65,0x6c,0x2c,0x20,0x30,0x29,
+    0x20,0x2a,0x20,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x74,0x6f,0x74,0x61,0x6c,0x20,0x2b,0x3d,0x20,0x77,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x73,0x75,0x6d,
+    0x20,0x2a,0x20,0x28,0x5f,0x31,0x37,0x2e,0x77,0x65,0x69,0x67,0x68,0x74,0x20,0x2f,
+    0x20,0x6d,0x61,0x78,0x28,0x74,0x6f,0x74,0x61,0x6c,0x2c,0x20,0x31,0x65,0x2d,0x38,
+    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    static float4 gl_Position;
+    static int gl_VertexIndex;
+
+    struct SPIRV_Cross_Input
+    {
+        uint gl_VertexIndex : SV_VertexID;
+    };
+
+    struct SPIRV_Cross_Output
+    {
+        float4 gl_Position : SV_Position;
+    };
+
+    void vert_main()
+    {
+        float2 corner = float2(float((gl_VertexIndex << 1) & 2), float(gl_VertexIndex & 2));
+        gl_Position = float4(corner * 2.0f - 1.0f, 0.5f, 1.0f);
+    }
+
+    SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
+    {
+        gl_VertexIndex = int(stage_input.gl_VertexIndex);
+        vert_main();
+        SPIRV_Cross_Output stage_output;
+        stage_output.gl_Position = gl_Position;
+        return stage_output;
+    }
+
+*/
+static const uint8_t vs_composite_source_hlsl5[603] = {
+    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,
+    0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x69,0x6e,0x74,0x20,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,
+    0x6e,0x64,0x65,0x78,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,
+    0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x67,0x6c,0x5f,0x56,0x65,
+    0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x20,0x3a,0x20,0x53,0x56,0x5f,0x56,
+    0x65,0x72,0x74,0x65,0x78,0x49,0x44,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,
+    0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,
+    0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,
+    0x3a,0x20,0x53,0x56,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,0x61,0x69,
+    0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x20,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,
+    0x78,0x49,0x6e,0x64,0x65,0x78,0x20,0x3c,0x3c,0x20,0x31,0x29,0x20,0x26,0x20,0x32,
+    0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,
+    0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x20,0x26,0x20,0x32,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x2a,
+    0x20,0x32,0x2e,0x30,0x66,0x20,0x2d,0x20,0x31,0x2e,0x30,0x66,0x2c,0x20,0x30,0x2e,
+    0x35,0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x53,0x50,
+    0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,
+    0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,
+    0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,
+    0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x56,0x65,
+    0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,
+    0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x56,
+    0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,
+    0x74,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,
+    0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,
+    0x70,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
+};
+/*
+    cbuffer fs_composite_params : register(b0)
+    {
+        float2 _17_source_size : packoffset(c0);
+        float2 _17_target_size : packoffset(c0.z);
+        float _17_weight : packoffset(c1);
+        float _17_depth_tolerance : packoffset(c1.y);
+        int _17_upsample : packoffset(c1.z);
+    };
+
+
+    Texture2D<float4> source : register(t0);
+    SamplerState point_smp : register(s0);
+    Texture2D<float4> full_distance : register(t1);
+
+    static float4 gl_FragCoord;
+    static float4 frag_color;
+
+    struct SPIRV_Cross_Input
+    {
+        float4 gl_FragCoord : SV_Position;
+    };
+
+    struct SPIRV_Cross_Output
+    {
+        float4 frag_color : SV_Target0;
+    };
+
+    void frag_main()
+    {
+        int2 pixel = ((int2)(gl_FragCoord.xy));
+        if (_17_upsample == 0) {
+            frag_color = source.Load(int3(pixel, 0)) * _17_weight;
+        } else {
+            float2 texel_scale = _17_source_size / _17_target_size;
+            float2 p = gl_FragCoord.xy * texel_scale - 0.5f;
+            int2 base = ((int2)(floor(p)));
+            float2 f = p - floor(p);
+            float center = full_distance.Load(int3(pixel, 0)).r;
+            float4 sum = float4(0.0f, 0.0f, 0.0f, 0.0f);
+            float total = 0.0f;
+            for (int i = 0; i < 4; i++) {
+                int2 offset = int2(i & 1, i >> 1);
+                int2 texel = clamp(base + offset, int2(0, 0), ((int2)(_17_source_size)) - int2(1, 1));
+                int2 seen = min(((int2)((((float2)(texel)) + 0.5f) / texel_scale)), ((int2)(_17_target_size)) - int2(1, 1));
+                float difference = abs(full_distance.Load(int3(seen, 0)).r - center) / max(center, 1e-3);
+                float2 bilinear = lerp(float2(1.0f, 1.0f) - f, f, ((float2)(offset)));
+                float w = bilinear.x * bilinear.y / (_17_depth_tolerance + difference);
+                sum += source.Load(int3(texel, 0)) * w;
+                total += w;
+            }
+            frag_color = sum * (_17_weight / max(total, 1e-8));
+        }
+    }
+
+    SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
+    {
+        gl_FragCoord = stage_input.gl_FragCoord;
+        gl_FragCoord.w = 1.0 / gl_FragCoord.w;
+        frag_main();
+        SPIRV_Cross_Output stage_output;
+        stage_output.frag_color = frag_color;
+        return stage_output;
+    }
+
+*/
+static const uint8_t fs_composite_source_hlsl5[2096] = {
+    0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x66,0x73,0x5f,0x63,0x6f,0x6d,0x70,0x6f,
+    0x73,0x69,0x74,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x3a,0x20,0x72,0x65,
+    0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x30,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x31,0x37,0x5f,0x73,0x6f,0x75,0x72,
+    0x63,0x65,0x5f,0x73,0x69,0x7a,0x65,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,
+    0x66,0x73,0x65,0x74,0x28,0x63,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x5f,0x31,0x37,0x5f,0x74,0x61,0x72,0x67,0x65,0x74,0x5f,
+    0x73,0x69,0x7a,0x65,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,
+    0x74,0x28,0x63,0x30,0x2e,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x5f,0x31,0x37,0x5f,0x77,0x65,0x69,0x67,0x68,0x74,0x20,0x3a,0x20,
+    0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x31,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x37,0x5f,0x64,0x65,
+    0x70,0x74,0x68,0x5f,0x74,0x6f,0x6c,0x65,0x72,0x61,0x6e,0x63,0x65,0x20,0x3a,0x20,
+    0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x31,0x2e,0x79,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x31,0x37,0x5f,0x75,0x70,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x28,0x63,0x31,0x2e,0x7a,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x0a,
+    0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x3e,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,
+    0x74,0x65,0x72,0x28,0x74,0x30,0x29,0x3b,0x0a,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,
+    0x53,0x74,0x61,0x74,0x65,0x20,0x70,0x6f,0x69,0x6e,0x74,0x5f,0x73,0x6d,0x70,0x20,
+    0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x73,0x30,0x29,0x3b,0x0a,
+    0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x3e,0x20,0x66,0x75,0x6c,0x6c,0x5f,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x20,
+    0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x31,0x29,0x3b,0x0a,
+    0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,
+    0x6c,0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6f,0x72,0x64,0x3b,0x0a,0x73,0x74,0x61,
+    0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x5f,
+    0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,
+    0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,
+    0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6f,0x72,0x64,0x20,0x3a,0x20,0x53,0x56,0x5f,
+    0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,
+    0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,
+    0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,
+    0x3a,0x20,0x53,0x56,0x5f,0x54,0x61,0x72,0x67,0x65,0x74,0x30,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,0x69,0x6e,
+    0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x32,0x20,0x70,0x69,
+    0x78,0x65,0x6c,0x20,0x3d,0x20,0x28,0x28,0x69,0x6e,0x74,0x32,0x29,0x28,0x67,0x6c,
+    0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6f,0x72,0x64,0x2e,0x78,0x79,0x29,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x31,0x37,0x5f,0x75,0x70,0x73,
+    0x61,0x6d,0x70,0x6c,0x65,0x20,0x3d,0x3d,0x20,0x30,0x29,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,
+    0x20,0x3d,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,0x2e,0x4c,0x6f,0x61,0x64,0x28,0x69,
+    0x6e,0x74,0x33,0x28,0x70,0x69,0x78,0x65,0x6c,0x2c,0x20,0x30,0x29,0x29,0x20,0x2a,
+    0x20,0x5f,0x31,0x37,0x5f,0x77,0x65,0x69,0x67,0x68,0x74,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x65,0x6c,0x5f,0x73,
+    0x63,0x61,0x6c,0x65,0x20,0x3d,0x20,0x5f,0x31,0x37,0x5f,0x73,0x6f,0x75,0x72,0x63,
+    0x65,0x5f,0x73,0x69,0x7a,0x65,0x20,0x2f,0x20,0x5f,0x31,0x37,0x5f,0x74,0x61,0x72,
+    0x67,0x65,0x74,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x20,0x3d,0x20,0x67,0x6c,0x5f,
+    0x46,0x72,0x61,0x67,0x43,0x6f,0x6f,0x72,0x64,0x2e,0x78,0x79,0x20,0x2a,0x20,0x74,
+    0x65,0x78,0x65,0x6c,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x2d,0x20,0x30,0x2e,0x35,
+    0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x32,0x20,
+    0x62,0x61,0x73,0x65,0x20,0x3d,0x20,0x28,0x28,0x69,0x6e,0x74,0x32,0x29,0x28,0x66,
+    0x6c,0x6f,0x6f,0x72,0x28,0x70,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x66,0x20,0x3d,0x20,0x70,0x20,
+    0x2d,0x20,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x70,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x63,0x65,0x6e,0x74,0x65,0x72,
+    0x20,0x3d,0x20,0x66,0x75,0x6c,0x6c,0x5f,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,
+    0x2e,0x4c,0x6f,0x61,0x64,0x28,0x69,0x6e,0x74,0x33,0x28,0x70,0x69,0x78,0x65,0x6c,
+    0x2c,0x20,0x30,0x29,0x29,0x2e,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x73,0x75,0x6d,0x20,0x3d,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x28,0x30,0x2e,0x30,0x66,0x2c,0x20,0x30,0x2e,0x30,0x66,0x2c,
+    0x20,0x30,0x2e,0x30,0x66,0x2c,0x20,0x30,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x6f,0x74,0x61,
+    0x6c,0x20,0x3d,0x20,0x30,0x2e,0x30,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,
+    0x3b,0x20,0x69,0x20,0x3c,0x20,0x34,0x3b,0x20,0x69,0x2b,0x2b,0x29,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x32,
+    0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x3d,0x20,0x69,0x6e,0x74,0x32,0x28,0x69,
+    0x20,0x26,0x20,0x31,0x2c,0x20,0x69,0x20,0x3e,0x3e,0x20,0x31,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x32,0x20,
+    0x74,0x65,0x78,0x65,0x6c,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x62,0x61,
+    0x73,0x65,0x20,0x2b,0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x2c,0x20,0x69,0x6e,0x74,
+    0x32,0x28,0x30,0x2c,0x20,0x30,0x29,0x2c,0x20,0x28,0x28,0x69,0x6e,0x74,0x32,0x29,
+    0x28,0x5f,0x31,0x37,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x69,0x7a,0x65,
+    0x29,0x29,0x20,0x2d,0x20,0x69,0x6e,0x74,0x32,0x28,0x31,0x2c,0x20,0x31,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x6e,
+    0x74,0x32,0x20,0x73,0x65,0x65,0x6e,0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,0x28,0x28,
+    0x69,0x6e,0x74,0x32,0x29,0x28,0x28,0x28,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x29,
+    0x28,0x74,0x65,0x78,0x65,0x6c,0x29,0x29,0x20,0x2b,0x20,0x30,0x2e,0x35,0x66,0x29,
+    0x20,0x2f,0x20,0x74,0x65,0x78,0x65,0x6c,0x5f,0x73,0x63,0x61,0x6c,0x65,0x29,0x29,
+    0x2c,0x20,0x28,0x28,0x69,0x6e,0x74,0x32,0x29,0x28,0x5f,0x31,0x37,0x5f,0x74,0x61,
+    0x72,0x67,0x65,0x74,0x5f,0x73,0x69,0x7a,0x65,0x29,0x29,0x20,0x2d,0x20,0x69,0x6e,
+    0x74,0x32,0x28,0x31,0x2c,0x20,0x31,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x66,
+    0x66,0x65,0x72,0x65,0x6e,0x63,0x65,0x20,0x3d,0x20,0x61,0x62,0x73,0x28,0x66,0x75,
+    0x6c,0x6c,0x5f,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x2e,0x4c,0x6f,0x61,0x64,
+    0x28,0x69,0x6e,0x74,0x33,0x28,0x73,0x65,0x65,0x6e,0x2c,0x20,0x30,0x29,0x29,0x2e,
+    0x72,0x20,0x2d,0x20,0x63,0x65,0x6e,0x74,0x65,0x72,0x29,0x20,0x2f,0x20,0x6d,0x61,
+    0x78,0x28,0x63,0x65,0x6e,0x74,0x65,0x72,0x2c,0x20,0x31,0x65,0x2d,0x33,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x62,0x69,0x6c,0x69,0x6e,0x65,0x61,0x72,0x20,0x3d,0x20,0x6c,
+    0x65,0x72,0x70,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x31,0x2e,0x30,0x66,0x2c,
+    0x20,0x31,0x2e,0x30,0x66,0x29,0x20,0x2d,0x20,0x66,0x2c,0x20,0x66,0x2c,0x20,0x28,
+    0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x29,0x28,0x6f,0x66,0x66,0x73,0x65,0x74,0x29,
+    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x77,0x20,0x3d,0x20,0x62,0x69,0x6c,0x69,0x6e,0x65,
+    0x61,0x72,0x2e,0x78,0x20,0x2a,0x20,0x62,0x69,0x6c,0x69,0x6e,0x65,0x61,0x72,0x2e,
+    0x79,0x20,0x2f,0x20,0x28,0x5f,0x31,0x37,0x5f,0x64,0x65,0x70,0x74,0x68,0x5f,0x74,
+    0x6f,0x6c,0x65,0x72,0x61,0x6e,0x63,0x65,0x20,0x2b,0x20,0x64,0x69,0x66,0x66,0x65,
+    0x72,0x65,0x6e,0x63,0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x73,0x75,0x6d,0x20,0x2b,0x3d,0x20,0x73,0x6f,0x75,0x72,0x63,
+    0x65,0x2e,0x4c,0x6f,0x61,0x64,0x28,0x69,0x6e,0x74,0x33,0x28,0x74,0x65,0x78,0x65,
+    0x6c,0x2c,0x20,0x30,0x29,0x29,0x20,0x2a,0x20,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x74,0x61,0x6c,0x20,0x2b,0x3d,
+    0x20,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,
+    0x20,0x3d,0x20,0x73,0x75,0x6d,0x20,0x2a,0x20,0x28,0x5f,0x31,0x37,0x5f,0x77,0x65,
+    0x69,0x67,0x68,0x74,0x20,0x2f,0x20,0x6d,0x61,0x78,0x28,0x74,0x6f,0x74,0x61,0x6c,
+    0x2c,0x20,0x31,0x65,0x2d,0x38,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x7d,0x0a,0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,
+    0x75,0x74,0x70,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,0x49,0x52,0x56,
+    0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x67,0x6c,0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6f,0x72,0x64,0x20,0x3d,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x46,0x72,
+    0x61,0x67,0x43,0x6f,0x6f,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,
+    0x46,0x72,0x61,0x67,0x43,0x6f,0x6f,0x72,0x64,0x2e,0x77,0x20,0x3d,0x20,0x31,0x2e,
+    0x30,0x20,0x2f,0x20,0x67,0x6c,0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6f,0x72,0x64,
+    0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,0x69,
+    0x6e,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,
+    0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,
+    0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,
+    0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x5f,
+    0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,
+    0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
+};
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+
+    using namespace metal;
+
+    struct main0_out
+    {
+        float4 gl_Position [[position]];
+    };
+
+    vertex main0_out main0(uint gl_VertexIndex [[vertex_id]])
+    {
+        main0_out out = {};
+        float2 corner = float2(float((gl_VertexIndex << 1) & 2), float(gl_VertexIndex & 2));
+        out.gl_Position = float4(corner * 2.0 - 1.0, 0.5, 1.0);
+        return out;
+    }
+
+*/
+static const uint8_t vs_composite_source_metal_macos[385] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,
+    0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x20,0x5b,0x5b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5d,0x5d,0x3b,0x0a,
+    0x7d,0x3b,0x0a,0x0a,0x76,0x65,0x72,0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,
+    0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x75,0x69,0x6e,0x74,0x20,
+    0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x20,0x5b,
+    0x5b,0x76,0x65,0x72,0x74,0x65,0x78,0x5f,0x69,0x64,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,
+    0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x67,0x6c,0x5f,0x56,0x65,0x72,
+    0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x20,0x3c,0x3c,0x20,0x31,0x29,0x20,0x26,
+    0x20,0x32,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x67,0x6c,0x5f,0x56,0x65,
+    0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x20,0x26,0x20,0x32,0x29,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x63,0x6f,
+    0x72,0x6e,0x65,0x72,0x20,0x2a,0x20,0x32,0x2e,0x30,0x20,0x2d,0x20,0x31,0x2e,0x30,
+    0x2c,0x20,0x30,0x2e,0x35,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x00,
+};
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+
+    using namespace metal;
+
+    struct fs_composite_params
+    {
+        float2 source_size;
+        float2 target_size;
+        float weight;
+        float depth_tolerance;
+        int upsample;
+    };
+
+    struct main0_out
+    {
+        float4 frag_color [[color(0)]];
+    };
+
+    fragment main0_out main0(constant fs_composite_params& _17 [[buffer(0)]], texture2d<float> source [[texture(0)]], texture2d<float> full_distance [[texture(1)]], sampler point_smp [[sampler(0)]], float4 gl_FragCoord [[position]])
+    {
+        main0_out out = {};
+        int2 pixel = int2(gl_FragCoord.xy);
+        if (_17.upsample == 0) {
+            out.frag_color = source.read(uint2(pixel), 0) * _17.weight;
+        } else {
+            float2 texel_scale = _17.source_size / _17.target_size;
+            float2 p = gl_FragCoord.xy * texel_scale - 0.5;
+            int2 base = int2(floor(p));
+            float2 f = p - floor(p);
+            float center = full_distance.read(uint2(pixel), 0).r;
+            float4 sum = float4(0.0, 0.0, 0.0, 0.0);
+            float total = 0.0;
+            for (int i = 0; i < 4; i++) {
+                int2 offset = int2(i & 1, i >> 1);
+                int2 texel = clamp(base + offset, int2(0, 0), int2(_17.source_size) - int2(1, 1));
+                int2 seen = min(int2((float2(texel) + 0.5) / texel_scale), int2(_17.target_size) - int2(1, 1));
+                float difference = abs(full_distance.read(uint2(seen), 0).r - center) / max(center, 1e-3);
+                float2 bilinear = mix(float2(1.0, 1.0) - f, f, float2(offset));
+                float w = bilinear.x * bilinear.y / (_17.depth_tolerance + difference);
+                sum += source.read(uint2(texel), 0) * w;
+                total += w;
+            }
+            out.frag_color = sum * (_17.weight / max(total, 1e-8));
+        }
+        return out;
+    }
+
+*/
+static const uint8_t fs_composite_source_metal_macos[1735] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,
+    0x73,0x5f,0x63,0x6f,0x6d,0x70,0x6f,0x73,0x69,0x74,0x65,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x61,0x72,0x67,0x65,0x74,0x5f,0x73,
+    0x69,0x7a,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x77,
+    0x65,0x69,0x67,0x68,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x64,0x65,0x70,0x74,0x68,0x5f,0x74,0x6f,0x6c,0x65,0x72,0x61,0x6e,0x63,0x65,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x75,0x70,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,
+    0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,
+    0x20,0x5b,0x5b,0x63,0x6f,0x6c,0x6f,0x72,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,
+    0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x63,0x6f,0x6e,0x73,
+    0x74,0x61,0x6e,0x74,0x20,0x66,0x73,0x5f,0x63,0x6f,0x6d,0x70,0x6f,0x73,0x69,0x74,
+    0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x31,0x37,0x20,0x5b,0x5b,
+    0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x73,0x6f,
+    0x75,0x72,0x63,0x65,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x30,
+    0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,
+    0x6c,0x6f,0x61,0x74,0x3e,0x20,0x66,0x75,0x6c,0x6c,0x5f,0x64,0x69,0x73,0x74,0x61,
+    0x6e,0x63,0x65,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x31,0x29,
+    0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x70,0x6f,0x69,0x6e,
+    0x74,0x5f,0x73,0x6d,0x70,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,
+    0x30,0x29,0x5d,0x5d,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,
+    0x46,0x72,0x61,0x67,0x43,0x6f,0x6f,0x72,0x64,0x20,0x5b,0x5b,0x70,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,
+    0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x32,0x20,0x70,0x69,0x78,0x65,0x6c,
+    0x20,0x3d,0x20,0x69,0x6e,0x74,0x32,0x28,0x67,0x6c,0x5f,0x46,0x72,0x61,0x67,0x43,
+    0x6f,0x6f,0x72,0x64,0x2e,0x78,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,
+    0x20,0x28,0x5f,0x31,0x37,0x2e,0x75,0x70,0x73,0x61,0x6d,0x70,0x6c,0x65,0x20,0x3d,
+    0x3d,0x20,0x30,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,
+    0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,
+    0x73,0x6f,0x75,0x72,0x63,0x65,0x2e,0x72,0x65,0x61,0x64,0x28,0x75,0x69,0x6e,0x74,
+    0x32,0x28,0x70,0x69,0x78,0x65,0x6c,0x29,0x2c,0x20,0x30,0x29,0x20,0x2a,0x20,0x5f,
+    0x31,0x37,0x2e,0x77,0x65,0x69,0x67,0x68,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
+    0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x65,0x6c,0x5f,0x73,0x63,0x61,
+    0x6c,0x65,0x20,0x3d,0x20,0x5f,0x31,0x37,0x2e,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,
+    0x73,0x69,0x7a,0x65,0x20,0x2f,0x20,0x5f,0x31,0x37,0x2e,0x74,0x61,0x72,0x67,0x65,
+    0x74,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x20,0x3d,0x20,0x67,0x6c,0x5f,0x46,0x72,
+    0x61,0x67,0x43,0x6f,0x6f,0x72,0x64,0x2e,0x78,0x79,0x20,0x2a,0x20,0x74,0x65,0x78,
+    0x65,0x6c,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x2d,0x20,0x30,0x2e,0x35,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x32,0x20,0x62,0x61,0x73,
+    0x65,0x20,0x3d,0x20,0x69,0x6e,0x74,0x32,0x28,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x70,
+    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x66,0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,0x66,0x6c,0x6f,0x6f,0x72,
+    0x28,0x70,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x63,0x65,0x6e,0x74,0x65,0x72,0x20,0x3d,0x20,0x66,0x75,0x6c,0x6c,
+    0x5f,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x2e,0x72,0x65,0x61,0x64,0x28,0x75,
+    0x69,0x6e,0x74,0x32,0x28,0x70,0x69,0x78,0x65,0x6c,0x29,0x2c,0x20,0x30,0x29,0x2e,
+    0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x73,0x75,0x6d,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x30,
+    0x2e,0x30,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x30,0x2e,
+    0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x74,0x6f,0x74,0x61,0x6c,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,
+    0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x34,0x3b,0x20,0x69,0x2b,
+    0x2b,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x69,0x6e,0x74,0x32,0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x3d,0x20,0x69,
+    0x6e,0x74,0x32,0x28,0x69,0x20,0x26,0x20,0x31,0x2c,0x20,0x69,0x20,0x3e,0x3e,0x20,
+    0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x69,0x6e,0x74,0x32,0x20,0x74,0x65,0x78,0x65,0x6c,0x20,0x3d,0x20,0x63,0x6c,0x61,
+    0x6d,0x70,0x28,0x62,0x61,0x73,0x65,0x20,0x2b,0x20,0x6f,0x66,0x66,0x73,0x65,0x74,
+    0x2c,0x20,0x69,0x6e,0x74,0x32,0x28,0x30,0x2c,0x20,0x30,0x29,0x2c,0x20,0x69,0x6e,
+    0x74,0x32,0x28,0x5f,0x31,0x37,0x2e,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x73,0x69,
+    0x7a,0x65,0x29,0x20,0x2d,0x20,0x69,0x6e,0x74,0x32,0x28,0x31,0x2c,0x20,0x31,0x29,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,
+    0x6e,0x74,0x32,0x20,0x73,0x65,0x65,0x6e,0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,0x69,
+    0x6e,0x74,0x32,0x28,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x74,0x65,0x78,0x65,
+    0x6c,0x29,0x20,0x2b,0x20,0x30,0x2e,0x35,0x29,0x20,0x2f,0x20,0x74,0x65,0x78,0x65,
+    0x6c,0x5f,0x73,0x63,0x61,0x6c,0x65,0x29,0x2c,0x20,0x69,0x6e,0x74,0x32,0x28,0x5f,
+    0x31,0x37,0x2e,0x74,0x61,0x72,0x67,0x65,0x74,0x5f,0x73,0x69,0x7a,0x65,0x29,0x20,
+    0x2d,0x20,0x69,0x6e,0x74,0x32,0x28,0x31,0x2c,0x20,0x31,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x64,0x69,0x66,0x66,0x65,0x72,0x65,0x6e,0x63,0x65,0x20,0x3d,0x20,0x61,0x62,
+    0x73,0x28,0x66,0x75,0x6c,0x6c,0x5f,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x2e,
+    0x72,0x65,0x61,0x64,0x28,0x75,0x69,0x6e,0x74,0x32,0x28,0x73,0x65,0x65,0x6e,0x29,
+    0x2c,0x20,0x30,0x29,0x2e,0x72,0x20,0x2d,0x20,0x63,0x65,0x6e,0x74,0x65,0x72,0x29,
+    0x20,0x2f,0x20,0x6d,0x61,0x78,0x28,0x63,0x65,0x6e,0x74,0x65,0x72,0x2c,0x20,0x31,
+    0x65,0x2d,0x33,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x62,0x69,0x6c,0x69,0x6e,0x65,0x61,
+    0x72,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x31,
+    0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x20,0x2d,0x20,0x66,0x2c,0x20,0x66,0x2c,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x77,0x20,0x3d,0x20,0x62,0x69,0x6c,0x69,0x6e,0x65,0x61,0x72,
+    0x2e,0x78,0x20,0x2a,0x20,0x62,0x69,0x6c,0x69,0x6e,0x65,0x61,0x72,0x2e,0x79,0x20,
+    0x2f,0x20,0x28,0x5f,0x31,0x37,0x2e,0x64,0x65,0x70,0x74,0x68,0x5f,0x74,0x6f,0x6c,
+    0x65,0x72,0x61,0x6e,0x63,0x65,0x20,0x2b,0x20,0x64,0x69,0x66,0x66,0x65,0x72,0x65,
+    0x6e,0x63,0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x73,0x75,0x6d,0x20,0x2b,0x3d,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,0x2e,
+    0x72,0x65,0x61,0x64,0x28,0x75,0x69,0x6e,0x74,0x32,0x28,0x74,0x65,0x78,0x65,0x6c,
+    0x29,0x2c,0x20,0x30,0x29,0x20,0x2a,0x20,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x74,0x61,0x6c,0x20,0x2b,0x3d,0x20,
+    0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,
+    0x6c,0x6f,0x72,0x20,0x3d,0x20,0x73,0x75,0x6d,0x20,0x2a,0x20,0x28,0x5f,0x31,0x37,
+    0x2e,0x77,0x65,0x69,0x67,0x68,0x74,0x20,0x2f,0x20,0x6d,0x61,0x78,0x28,0x74,0x6f,
+    0x74,0x61,0x6c,0x2c,0x20,0x31,0x65,0x2d,0x38,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,
+    0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+static inline const sg_shader_desc* composite_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vs.source = (const char*)vs_composite_source_glsl430;
+            desc.vs.entry = "main";
+            desc.fs.source = (const char*)fs_composite_source_glsl430;
+            desc.fs.entry = "main";
+            desc.fs.uniform_blocks[0].size = 32;
+            desc.fs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.fs.uniform_blocks[0].uniforms[0].name = "_17.source_size";
+            desc.fs.uniform_blocks[0].uniforms[0].type = SG_UNIFORMTYPE_FLOAT2;
+            desc.fs.uniform_blocks[0].uniforms[0].array_count = 0;
+            desc.fs.uniform_blocks[0].uniforms[1].name = "_17.target_size";
+            desc.fs.uniform_blocks[0].uniforms[1].type = SG_UNIFORMTYPE_FLOAT2;
+            desc.fs.uniform_blocks[0].uniforms[1].array_count = 0;
+            desc.fs.uniform_blocks[0].uniforms[2].name = "_17.weight";
+            desc.fs.uniform_blocks[0].uniforms[2].type = SG_UNIFORMTYPE_FLOAT;
+            desc.fs.uniform_blocks[0].uniforms[2].array_count = 0;
+            desc.fs.uniform_blocks[0].uniforms[3].name = "_17.depth_tolerance";
+            desc.fs.uniform_blocks[0].uniforms[3].type = SG_UNIFORMTYPE_FLOAT;
+            desc.fs.uniform_blocks[0].uniforms[3].array_count = 0;
+            desc.fs.uniform_blocks[0].uniforms[4].name = "_17.upsample";
+            desc.fs.uniform_blocks[0].uniforms[4].type = SG_UNIFORMTYPE_INT;
+            desc.fs.uniform_blocks[0].uniforms[4].array_count = 0;
+            desc.fs.images[0].used = true;
+            desc.fs.images[0].multisampled = false;
+            desc.fs.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.fs.images[0].sample_type = SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT;
+            desc.fs.images[1].used = true;
+            desc.fs.images[1].multisampled = false;
+            desc.fs.images[1].image_type = SG_IMAGETYPE_2D;
+            desc.fs.images[1].sample_type = SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT;
+            desc.fs.samplers[0].used = true;
+            desc.fs.samplers[0].sampler_type = SG_SAMPLERTYPE_NONFILTERING;
+            desc.fs.image_sampler_pairs[0].used = true;
+            desc.fs.image_sampler_pairs[0].image_slot = 0;
+            desc.fs.image_sampler_pairs[0].sampler_slot = 0;
+            desc.fs.image_sampler_pairs[0].glsl_name = "source_point_smp";
+            desc.fs.image_sampler_pairs[1].used = true;
+            desc.fs.image_sampler_pairs[1].image_slot = 1;
+            desc.fs.image_sampler_pairs[1].sampler_slot = 0;
+            desc.fs.image_sampler_pairs[1].glsl_name = "full_distance_point_smp";
+            desc.label = "composite_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_D3D11) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vs.source = (const char*)vs_composite_source_hlsl5;
+            desc.vs.d3d11_target = "vs_5_0";
+            desc.vs.entry = "main";
+            desc.fs.source = (const char*)fs_composite_source_hlsl5;
+            desc.fs.d3d11_target = "ps_5_0";
+            desc.fs.entry = "main";
+            desc.fs.uniform_blocks[0].size = 32;
+            desc.fs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.fs.images[0].used = true;
+            desc.fs.images[0].multisampled = false;
+            desc.fs.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.fs.images[0].sample_type = SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT;
+            desc.fs.images[1].used = true;
+            desc.fs.images[1].multisampled = false;
+            desc.fs.images[1].image_type = SG_IMAGETYPE_2D;
+            desc.fs.images[1].sample_type = SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT;
+            desc.fs.samplers[0].used = true;
+            desc.fs.samplers[0].sampler_type = SG_SAMPLERTYPE_NONFILTERING;
+            desc.fs.image_sampler_pairs[0].used = true;
+            desc.fs.image_sampler_pairs[0].image_slot = 0;
+            desc.fs.image_sampler_pairs[0].sampler_slot = 0;
+            desc.fs.image_sampler_pairs[1].used = true;
+            desc.fs.image_sampler_pairs[1].image_slot = 1;
+            desc.fs.image_sampler_pairs[1].sampler_slot = 0;
+            desc.label = "composite_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_METAL_MACOS) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vs.source = (const char*)vs_composite_source_metal_macos;
+            desc.vs.entry = "main0";
+            desc.fs.source = (const char*)fs_composite_source_metal_macos;
+            desc.fs.entry = "main0";
+            desc.fs.uniform_blocks[0].size = 32;
+            desc.fs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.fs.images[0].used = true;
+            desc.fs.images[0].multisampled = false;
+            desc.fs.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.fs.images[0].sample_type = SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT;
+            desc.fs.images[1].used = true;
+            desc.fs.images[1].multisampled = false;
+            desc.fs.images[1].image_type = SG_IMAGETYPE_2D;
+            desc.fs.images[1].sample_type = SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT;
+            desc.fs.samplers[0].used = true;
+            desc.fs.samplers[0].sampler_type = SG_SAMPLERTYPE_NONFILTERING;
+            desc.fs.image_sampler_pairs[0].used = true;
+            desc.fs.image_sampler_pairs[0].image_slot = 0;
+            desc.fs.image_sampler_pairs[0].sampler_slot = 0;
+            desc.fs.image_sampler_pairs[1].used = true;
+            desc.fs.image_sampler_pairs[1].image_slot = 1;
+            desc.fs.image_sampler_pairs[1].sampler_slot = 0;
+            desc.label = "composite_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
@@ -0,0 +1,33 @@
+@ctype mat4 hmm_mat4
+
+@vs vs_distance
+layout(location=0) in vec4 position;
+
+uniform vs_distance_params {
+    mat4 mvp;
+    mat4 model;
+    vec3 eye_pos;
+};
+
+out vec3 eye_offset;
+
+void main(void) {
+	vec4 world = model * position;
+	gl_Position = mvp * position;
+	eye_offset = world.xyz - eye_pos;
+}
+@end
+
+@fs fs_distance
+in vec3 eye_offset;
+
+out vec4 frag_distance;
+
+void main(void) {
+	// Distance from the eye in world units, the same along every ray through the pixel
+	frag_distance = vec4(length(eye_offset), 0.0, 0.0, 1.0);
+}
+@end
+
+
+@program distance vs_distance fs_distance
\ No newline at end of file
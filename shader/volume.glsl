@@ -7,7 +7,7 @@ uniform vs_vol_params {
     mat4 proj_view;
     vec3 eye_pos;
     vec3 volume_scale;
-	vec3 volume_translation;
+    vec3 volume_translation;
 };
 
 out vec3 vray_dir;
@@ -16,7 +16,7 @@ flat out vec3 transformed_eye;
 void main(void) {
 	// Translate the cube to center it at the origin.
 	//vec3 volume_translation = vec3(0.5) - volume_scale * 0.5;
-	gl_Position = proj_view * vec4(pos * volume_scale + volume_translation, 1);
+	gl_Position = proj_view * vec4(pos * volume_scale + volume_translation, 1.0);
 
 	// Compute eye position and ray directions in the unit cube space
 	transformed_eye = (eye_pos - volume_translation) / volume_scale;
@@ -30,17 +30,32 @@ precision highp float;
 
 uniform fs_vol_params {
     ivec3 volume_dims;
-    float dt_scale;
-    float near_clip;
-    float far_clip;
+    int bricked;
+    int brick_size;
     vec3 new_box_min;
     vec3 new_box_max;
+    float lod_scale;
+    vec3 volume_extent;
+    float max_lod;
+    ivec3 cell_dims;
+    int cell_size;
+    float value_scale;
+    float value_offset;
+    vec4 march;
+    float jitter;
+    vec2 scene_scale;
+    ivec2 scene_size;
 };
 
 uniform texture3D volume;
 uniform sampler volume_smp;
-uniform texture2D colormap;
-uniform sampler colormap_smp;
+uniform texture2D transfer_table;
+uniform sampler transfer_smp;
+uniform texture3D brick_table;
+uniform texture3D brick_atlas;
+uniform texture3D occupancy;
+uniform texture2D scene_distance;
+uniform sampler scene_smp;
 
 in vec3 vray_dir;
 flat in vec3 transformed_eye;
@@ -60,6 +75,48 @@ vec2 intersect_box(vec3 orig, vec3 dir) {
     return vec2(t0, t1);
 }
 
+// Mip level at which one voxel covers about a pixel, t along the ray from the eye
+float ray_lod(float t, vec3 ray_dir) {
+    float ray_distance = t * length(ray_dir * volume_extent);
+    return clamp(log2(max(ray_distance * lod_scale, 1.0)), 0.0, max_lod);
+}
+
+// Look up the voxel at p in [0, 1]^3. Bricked volumes go through the page table: each
+// entry holds the atlas slot of the resident brick covering it and that brick's mip level plus one,
+// or alpha 0 when nothing covering it is paged in yet
+float sample_volume(vec3 p, float lod) {
+    if (bricked == 0) {
+        return textureLod(sampler3D(volume, volume_smp), p, lod).r;
+    }
+    ivec3 voxel = clamp(ivec3(floor(p * vec3(volume_dims))), ivec3(0, 0, 0), volume_dims - ivec3(1, 1, 1));
+    vec4 entry = texelFetch(sampler3D(brick_table, volume_smp), voxel / brick_size, 0);
+    int brick_level = int(entry.a * 255.0 + 0.5) - 1;
+    if (brick_level < 0) {
+        return 0.0;
+    }
+    ivec3 coarse = voxel >> brick_level;
+    ivec3 slot = ivec3(entry.rgb * 255.0 + 0.5);
+    return texelFetch(sampler3D(brick_atlas, volume_smp), slot * brick_size + (coarse - (coarse / brick_size) * brick_size), 0).r;
+}
+
+// Where the ray leaves the macro cell around p if nothing in the cell can be visible, otherwise t itself
+float skip_empty(vec3 p, float t, vec3 eye, vec3 ray_dir) {
+    vec3 cell_scale = vec3(volume_dims) / float(cell_size);
+    ivec3 cell = clamp(ivec3(floor(p * cell_scale)), ivec3(0, 0, 0), cell_dims - ivec3(1, 1, 1));
+    if (texelFetch(sampler3D(occupancy, volume_smp), cell, 0).r > 0.0) {
+        return t;
+    }
+    vec3 exit_face = (vec3(cell) + step(vec3(0.0, 0.0, 0.0), ray_dir)) / cell_scale;
+    vec3 t_exit = (exit_face - eye) / ray_dir;
+    return min(t_exit.x, min(t_exit.y, t_exit.z));
+}
+
+// Premultiplied color and opacity of a step whose value goes from front to back, from the 256 x 256 pre-integrated
+// transfer function table. Entry i sits at value i / 255
+vec4 transfer_segment(float front, float back) {
+    return texture(sampler2D(transfer_table, transfer_smp), vec2(front, back) * (255.0 / 256.0) + 0.5 / 256.0);
+}
+
 float wang_hash(int seed) {
     seed = (seed ^ 61) ^ (seed >> 16);
     seed *= 9;
@@ -91,34 +148,85 @@ void main(void) {
 	// of the eye
 	t_hit.x = max(t_hit.x, 0.0);
 
+	// Stop at the nearest mesh. scene_distance holds its distance from the eye in world units at full size,
+	// and a step of t along ray_dir covers length(ray_dir * volume_extent) of those
+	ivec2 scene_pixel = min(ivec2(gl_FragCoord.xy * scene_scale), scene_size - ivec2(1, 1));
+	float mesh_distance = texelFetch(sampler2D(scene_distance, scene_smp), scene_pixel, 0).r;
+	t_hit.y = min(t_hit.y, mesh_distance / length(ray_dir * volume_extent));
+	if (t_hit.x >= t_hit.y) {
+		discard;
+	}
+
 	// Step 3: Compute the step size to march through the volume grid
 	vec3 dt_vec = 1.0 / (vec3(volume_dims) * abs(ray_dir));
 	float dt = min(dt_vec.x, min(dt_vec.y, dt_vec.z));
 
+	// Shortest and longest step in steps of dt, how faint samples have to be to step over them, and the opacity to stop at
+	float min_step = march.x;
+	float max_step = march.y;
+	float refine_opacity = march.z;
+	float alpha_cutoff = march.w;
+
     FragColor = vec4(0.0, 0.0, 0.0, 0.0);
 
 	// Step 4: Starting from the entry point, march the ray through the volume
-	// and sample it
-	vec3 p = transformed_eye + t_hit.x * ray_dir;
-	for (float t = t_hit.x; t < t_hit.y; t += dt) {
+	// and sample it. Positions are counted in steps of dt from the entry point rather than
+	// adding up dt, so skipping ahead lands exactly on the steps a plain march would take.
+	// With max_step above 1, steps grow (up to max_step of them) while samples stay faint
+	// and flat, and drop back to min_step as soon as something shows up. jitter shifts every
+	// step by a fraction of one, so frames averaged together sample in between each other
+	float steps = (t_hit.y - t_hit.x) / dt;
+	float s = jitter;
+	float stride = 1.0; // Steps since the previous sample
+	float prev_val = -1.0; // None yet
+	while (s < steps) {
+		float t = t_hit.x + s * dt;
+		vec3 p = transformed_eye + t * ray_dir;
+
+		// Jump over macro cells that are fully transparent, to the last step before the cell
+		// ends. If rounding leaves that step in the same cell, the next pass moves on by one
+		float t_skip = skip_empty(p, t, transformed_eye, ray_dir);
+		if (t_skip > t) {
+			s = max(floor((t_skip - t_hit.x) / dt - jitter) + jitter, s + 1.0);
+			stride = 1.0;
+			prev_val = -1.0; // The next sample starts a new stretch, the skipped one is invisible
+			continue;
+		}
+
 		// Step 4.1: Sample the volume, and color it by the transfer function.
 		// Note that here we don't use the opacity from the transfer function,
 		// and just use the sample value as the opacity
-		float val = texture(sampler3D(volume, volume_smp), p).r;
-        
-        // val_color = vec4(texture(transfer_fcn, vec2(val, 0.5)).rgb, val);
-		vec4 val_color = vec4(texture(sampler2D(colormap, colormap_smp), vec2(val * .999 + 0.0005, 0.5)).rgb, val);
+		// The window maps to 0..1, anything outside it to the transfer function's ends
+		float val = clamp(sample_volume(p, ray_lod(t, ray_dir)) * value_scale + value_offset, 0.0, 1.0);
+
+		// A long step that lands on something visible may have stepped over its front,
+		// so go back and walk up to it min_step steps at a time
+		bool faint = val <= refine_opacity && abs(val - prev_val) <= refine_opacity;
+		if (stride > min_step && !faint) {
+			s -= stride - min_step;
+			stride = min_step;
+			continue;
+		}
+
+		// Step 4.2: Look up the color and opacity of the stretch from the previous sample to this one.
+		// They're integrated ahead of time for every pair of values at its ends, so long steps don't
+		// band. The table holds a single step, the n steps this sample stands for let through (1 - a)^n
+		vec4 segment = transfer_segment(prev_val < 0.0 ? val : prev_val, val);
+		float alpha = 1.0 - pow(1.0 - segment.a, stride);
+		vec3 color = segment.rgb * (alpha / max(segment.a, 1e-6));
 
-		// Step 4.2: Accumulate the color and opacity using the front-to-back
-		// compositing equation
-		FragColor.rgb += (1.0 - FragColor.a) * val_color.a * val_color.rgb;
-		FragColor.a += (1.0 - FragColor.a) * val_color.a;
+		// Step 4.3: Accumulate the color and opacity using the front-to-back
+		// compositing equation, with the colors premultiplied by their opacity
+		FragColor.rgb += (1.0 - FragColor.a) * color;
+		FragColor.a += (1.0 - FragColor.a) * alpha;
 
 		// Optimization: break out of the loop when the color is near opaque
-		if (FragColor.a >= 0.98) {
+		if (FragColor.a >= alpha_cutoff) {
 			break;
 		}
-		p += ray_dir * dt;
+		prev_val = val;
+		stride = faint ? min(stride * 2.0, max_step) : min_step;
+		s += stride;
 	}
     FragColor.r = linear_to_srgb(FragColor.r);
     FragColor.g = linear_to_srgb(FragColor.g);
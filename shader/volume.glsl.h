@@ -26,23 +26,58 @@
                 Sample type: SG_IMAGESAMPLETYPE_FLOAT
                 Multisampled: false
                 Bind slot: SLOT_volume => 0
-            Image 'colormap':
+            Image 'transfer_table':
                 Image type: SG_IMAGETYPE_2D
                 Sample type: SG_IMAGESAMPLETYPE_FLOAT
                 Multisampled: false
-                Bind slot: SLOT_colormap => 1
+                Bind slot: SLOT_transfer_table => 1
+            Image 'brick_table':
+                Image type: SG_IMAGETYPE_3D
+                Sample type: SG_IMAGESAMPLETYPE_FLOAT
+                Multisampled: false
+                Bind slot: SLOT_brick_table => 2
+            Image 'brick_atlas':
+                Image type: SG_IMAGETYPE_3D
+                Sample type: SG_IMAGESAMPLETYPE_FLOAT
+                Multisampled: false
+                Bind slot: SLOT_brick_atlas => 3
+            Image 'occupancy':
+                Image type: SG_IMAGETYPE_3D
+                Sample type: SG_IMAGESAMPLETYPE_FLOAT
+                Multisampled: false
+                Bind slot: SLOT_occupancy => 4
+            Image 'scene_distance':
+                Image type: SG_IMAGETYPE_2D
+                Sample type: SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT
+                Multisampled: false
+                Bind slot: SLOT_scene_distance => 5
             Sampler 'volume_smp':
                 Type: SG_SAMPLERTYPE_FILTERING
                 Bind slot: SLOT_volume_smp => 0
-            Sampler 'colormap_smp':
+            Sampler 'transfer_smp':
                 Type: SG_SAMPLERTYPE_FILTERING
-                Bind slot: SLOT_colormap_smp => 1
+                Bind slot: SLOT_transfer_smp => 1
+            Sampler 'scene_smp':
+                Type: SG_SAMPLERTYPE_NONFILTERING
+                Bind slot: SLOT_scene_smp => 2
             Image Sampler Pair 'volume_volume_smp':
                 Image: volume
                 Sampler: volume_smp
-            Image Sampler Pair 'colormap_colormap_smp':
-                Image: colormap
-                Sampler: colormap_smp
+            Image Sampler Pair 'transfer_table_transfer_smp':
+                Image: transfer_table
+                Sampler: transfer_smp
+            Image Sampler Pair 'brick_table_volume_smp':
+                Image: brick_table
+                Sampler: volume_smp
+            Image Sampler Pair 'brick_atlas_volume_smp':
+                Image: brick_atlas
+                Sampler: volume_smp
+            Image Sampler Pair 'occupancy_volume_smp':
+                Image: occupancy
+                Sampler: volume_smp
+            Image Sampler Pair 'scene_distance_scene_smp':
+                Image: scene_distance
+                Sampler: scene_smp
 */
 #if !defined(SOKOL_GFX_INCLUDED)
 #error "Please include sokol_gfx.h before volume.glsl.h"
@@ -58,9 +93,14 @@
 #define SLOT_vs_vol_params (0)
 #define SLOT_fs_vol_params (0)
 #define SLOT_volume (0)
-#define SLOT_colormap (1)
+#define SLOT_transfer_table (1)
+#define SLOT_brick_table (2)
+#define SLOT_brick_atlas (3)
+#define SLOT_occupancy (4)
+#define SLOT_scene_distance (5)
 #define SLOT_volume_smp (0)
-#define SLOT_colormap_smp (1)
+#define SLOT_transfer_smp (1)
+#define SLOT_scene_smp (2)
 #pragma pack(push,1)
 SOKOL_SHDC_ALIGN(16) typedef struct vs_vol_params_t {
     hmm_mat4 proj_view;
@@ -75,64 +115,88 @@ SOKOL_SHDC_ALIGN(16) typedef struct vs_vol_params_t {
 #pragma pack(push,1)
 SOKOL_SHDC_ALIGN(16) typedef struct fs_vol_params_t {
     int volume_dims[3];
-    float dt_scale;
-    float near_clip;
-    float far_clip;
-    uint8_t _pad_24[8];
+    int bricked;
+    int brick_size;
+    uint8_t _pad_20[12];
     float new_box_min[3];
     uint8_t _pad_44[4];
     float new_box_max[3];
-    uint8_t _pad_60[4];
+    float lod_scale;
+    float volume_extent[3];
+    float max_lod;
+    int cell_dims[3];
+    int cell_size;
+    float value_scale;
+    float value_offset;
+    uint8_t _pad_104[8];
+    float march[4];
+    float jitter;
+    uint8_t _pad_132[4];
+    float scene_scale[2];
+    int scene_size[2];
+    uint8_t _pad_152[8];
 } fs_vol_params_t;
 #pragma pack(pop)
 /*
     #version 430
 
-    uniform vec4 vs_vol_params[7];
+    struct vs_vol_params
+    {
+        mat4 proj_view;
+        vec3 eye_pos;
+        vec3 volume_scale;
+        vec3 volume_translation;
+    };
+
+    uniform vs_vol_params _20;
+
     layout(location = 0) in vec3 pos;
-    layout(location = 1) flat out vec3 transformed_eye;
     layout(location = 0) out vec3 vray_dir;
+    layout(location = 1) flat out vec3 transformed_eye;
 
     void main()
     {
-        gl_Position = mat4(vs_vol_params[0], vs_vol_params[1], vs_vol_params[2], vs_vol_params[3]) * vec4(fma(pos, vs_vol_params[5].xyz, vs_vol_params[6].xyz), 1.0);
-        transformed_eye = (vs_vol_params[4].xyz - vs_vol_params[6].xyz) / vs_vol_params[5].xyz;
+        gl_Position = (_20.proj_view * vec4(pos * _20.volume_scale + _20.volume_translation, 1.0));
+
+        transformed_eye = (_20.eye_pos - _20.volume_translation) / _20.volume_scale;
         vray_dir = pos - transformed_eye;
     }
 
 */
-static const uint8_t vs_volume_source_glsl430[482] = {
-    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
-    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,0x5f,0x76,0x6f,
-    0x6c,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x37,0x5d,0x3b,0x0a,0x6c,0x61,0x79,
-    0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,
-    0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x6f,0x73,0x3b,0x0a,0x6c,
+static const uint8_t vs_volume_source_glsl430[520] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x73,0x74,
+    0x72,0x75,0x63,0x74,0x20,0x76,0x73,0x5f,0x76,0x6f,0x6c,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x34,0x20,0x70,0x72,
+    0x6f,0x6a,0x5f,0x76,0x69,0x65,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
+    0x33,0x20,0x65,0x79,0x65,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x73,0x63,0x61,0x6c,0x65,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x6f,0x6c,0x75,0x6d,
+    0x65,0x5f,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x73,0x5f,0x76,0x6f,
+    0x6c,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x5f,0x32,0x30,0x3b,0x0a,0x0a,0x6c,
     0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,
-    0x20,0x31,0x29,0x20,0x66,0x6c,0x61,0x74,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,
-    0x33,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x65,0x64,0x5f,0x65,0x79,
-    0x65,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
-    0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x33,
-    0x20,0x76,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,
-    0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,
-    0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x6d,0x61,0x74,0x34,
-    0x28,0x76,0x73,0x5f,0x76,0x6f,0x6c,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,
-    0x5d,0x2c,0x20,0x76,0x73,0x5f,0x76,0x6f,0x6c,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
-    0x5b,0x31,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x76,0x6f,0x6c,0x5f,0x70,0x61,0x72,0x61,
-    0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x76,0x6f,0x6c,0x5f,0x70,0x61,
-    0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x28,
-    0x66,0x6d,0x61,0x28,0x70,0x6f,0x73,0x2c,0x20,0x76,0x73,0x5f,0x76,0x6f,0x6c,0x5f,
-    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x76,
-    0x73,0x5f,0x76,0x6f,0x6c,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,0x2e,
-    0x78,0x79,0x7a,0x29,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x65,0x64,0x5f,0x65,0x79,0x65,0x20,
-    0x3d,0x20,0x28,0x76,0x73,0x5f,0x76,0x6f,0x6c,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
-    0x5b,0x34,0x5d,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x76,0x73,0x5f,0x76,0x6f,0x6c,
-    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,0x2e,0x78,0x79,0x7a,0x29,0x20,
-    0x2f,0x20,0x76,0x73,0x5f,0x76,0x6f,0x6c,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
-    0x35,0x5d,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x72,0x61,0x79,
-    0x5f,0x64,0x69,0x72,0x20,0x3d,0x20,0x70,0x6f,0x73,0x20,0x2d,0x20,0x74,0x72,0x61,
-    0x6e,0x73,0x66,0x6f,0x72,0x6d,0x65,0x64,0x5f,0x65,0x79,0x65,0x3b,0x0a,0x7d,0x0a,
-    0x0a,0x00,
+    0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x6f,0x73,0x3b,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x33,0x20,0x76,
+    0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x66,0x6c,
+    0x61,0x74,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x33,0x20,0x74,0x72,0x61,0x6e,
+    0x73,0x66,0x6f,0x72,0x6d,0x65,0x64,0x5f,0x65,0x79,0x65,0x3b,0x0a,0x0a,0x76,0x6f,
+    0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x28,0x5f,
+    0x32,0x30,0x2e,0x70,0x72,0x6f,0x6a,0x5f,0x76,0x69,0x65,0x77,0x20,0x2a,0x20,0x76,
+    0x65,0x63,0x34,0x28,0x70,0x6f,0x73,0x20,0x2a,0x20,0x5f,0x32,0x30,0x2e,0x76,0x6f,
+    0x6c,0x75,0x6d,0x65,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x2b,0x20,0x5f,0x32,0x30,
+    0x2e,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,
+    0x69,0x6f,0x6e,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x0a,0x20,0x20,0x20,
+    0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x65,0x64,0x5f,0x65,0x79,0x65,
+    0x20,0x3d,0x20,0x28,0x5f,0x32,0x30,0x2e,0x65,0x79,0x65,0x5f,0x70,0x6f,0x73,0x20,
+    0x2d,0x20,0x5f,0x32,0x30,0x2e,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x74,0x72,0x61,
+    0x6e,0x73,0x6c,0x61,0x74,0x69,0x6f,0x6e,0x29,0x20,0x2f,0x20,0x5f,0x32,0x30,0x2e,
+    0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x73,0x63,0x61,0x6c,0x65,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x20,0x3d,0x20,0x70,0x6f,0x73,
+    0x20,0x2d,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x65,0x64,0x5f,0x65,
+    0x79,0x65,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
 /*
     #version 430
@@ -140,242 +204,520 @@ static const uint8_t vs_volume_source_glsl430[482] = {
     struct fs_vol_params
     {
         ivec3 volume_dims;
-        float dt_scale;
-        float near_clip;
-        float far_clip;
+        int bricked;
+        int brick_size;
         vec3 new_box_min;
         vec3 new_box_max;
+        float lod_scale;
+        vec3 volume_extent;
+        float max_lod;
+        ivec3 cell_dims;
+        int cell_size;
+        float value_scale;
+        float value_offset;
+        vec4 march;
+        float jitter;
+        vec2 scene_scale;
+        ivec2 scene_size;
     };
 
     uniform fs_vol_params _25;
 
     layout(binding = 0) uniform sampler3D volume_volume_smp;
-    layout(binding = 1) uniform sampler2D colormap_colormap_smp;
+    layout(binding = 1) uniform sampler2D transfer_table_transfer_smp;
+    layout(binding = 2) uniform sampler3D brick_table_volume_smp;
+    layout(binding = 3) uniform sampler3D brick_atlas_volume_smp;
+    layout(binding = 4) uniform sampler3D occupancy_volume_smp;
+    layout(binding = 5) uniform sampler2D scene_distance_scene_smp;
 
     layout(location = 0) in vec3 vray_dir;
     layout(location = 1) flat in vec3 transformed_eye;
     layout(location = 0) out vec4 FragColor;
 
-    vec2 intersect_box(vec3 orig, vec3 dir)
-    {
-        vec3 _38 = vec3(1.0) / dir;
-        vec3 _44 = (_25.new_box_min - orig) * _38;
-        vec3 _50 = (_25.new_box_max - orig) * _38;
-        vec3 _54 = min(_44, _50);
-        vec3 _58 = max(_44, _50);
-        return vec2(max(_54.x, max(_54.y, _54.z)), min(_58.x, min(_58.y, _58.z)));
+    vec2 intersect_box(vec3 orig, vec3 dir) {
+        vec3 box_min = _25.new_box_min;
+        vec3 box_max = _25.new_box_max;
+        vec3 inv_dir = 1.0 / dir;
+        vec3 tmin_tmp = (box_min - orig) * inv_dir;
+        vec3 tmax_tmp = (box_max - orig) * inv_dir;
+        vec3 tmin = min(tmin_tmp, tmax_tmp);
+        vec3 tmax = max(tmin_tmp, tmax_tmp);
+        float t0 = max(tmin.x, max(tmin.y, tmin.z));
+        float t1 = min(tmax.x, min(tmax.y, tmax.z));
+        return vec2(t0, t1);
     }
 
-    float linear_to_srgb(float x)
-    {
-        if (x <= 0.003130800090730190277099609375)
-        {
-            return 12.9200000762939453125 * x;
+    float ray_lod(float t, vec3 ray_dir) {
+        float ray_distance = t * length(ray_dir * _25.volume_extent);
+        return clamp(log2(max(ray_distance * _25.lod_scale, 1.0)), 0.0, _25.max_lod);
+    }
+
+    float sample_volume(vec3 p, float lod) {
+        if (_25.bricked == 0) {
+            return textureLod(volume_volume_smp, p, lod).r;
         }
-        return fma(1.05499994754791259765625, pow(x, 0.4166666567325592041015625), -0.054999999701976776123046875);
+        ivec3 voxel = clamp(ivec3(floor(p * vec3(_25.volume_dims))), ivec3(0, 0, 0), _25.volume_dims - ivec3(1, 1, 1));
+        vec4 entry = texelFetch(brick_table_volume_smp, voxel / _25.brick_size, 0);
+        int brick_level = int(entry.a * 255.0 + 0.5) - 1;
+        if (brick_level < 0) {
+            return 0.0;
+        }
+        ivec3 coarse = voxel >> brick_level;
+        ivec3 slot = ivec3(entry.rgb * 255.0 + 0.5);
+        return texelFetch(brick_atlas_volume_smp, slot * _25.brick_size + (coarse - (coarse / _25.brick_size) * _25.brick_size), 0).r;
+    }
+
+    float skip_empty(vec3 p, float t, vec3 eye, vec3 ray_dir) {
+        vec3 cell_scale = vec3(_25.volume_dims) / float(_25.cell_size);
+        ivec3 cell = clamp(ivec3(floor(p * cell_scale)), ivec3(0, 0, 0), _25.cell_dims - ivec3(1, 1, 1));
+        if (texelFetch(occupancy_volume_smp, cell, 0).r > 0.0) {
+            return t;
+        }
+        vec3 exit_face = (vec3(cell) + step(vec3(0.0, 0.0, 0.0), ray_dir)) / cell_scale;
+        vec3 t_exit = (exit_face - eye) / ray_dir;
+        return min(t_exit.x, min(t_exit.y, t_exit.z));
+    }
+
+    vec4 transfer_segment(float front, float back) {
+        return texture(transfer_table_transfer_smp, vec2(front, back) * (255.0 / 256.0) + 0.5 / 256.0);
+    }
+
+    float wang_hash(int seed) {
+        seed = (seed ^ 61) ^ (seed >> 16);
+        seed *= 9;
+        seed = seed ^ (seed >> 4);
+        seed *= 0x27d4eb2d;
+        seed = seed ^ (seed >> 15);
+        return float(seed % 2147483647) / float(2147483647);
+    }
+
+    float linear_to_srgb(float x) {
+        if (x <= 0.0031308f) {
+            return 12.92f * x;
+        }
+        return 1.055f * pow(x, 1.f / 2.4f) - 0.055f;
     }
 
     void main()
     {
-        vec3 _109 = normalize(vray_dir);
-        vec3 param = transformed_eye;
-        vec3 param_1 = _109;
-        vec2 _117 = intersect_box(param, param_1);
-        vec2 t_hit = _117;
-        if (_117.x > _117.y)
-        {
+        vec3 ray_dir = normalize(vray_dir);
+
+        vec2 t_hit = intersect_box(transformed_eye, ray_dir);
+        if (t_hit.x > t_hit.y) {
+            discard;
+        }
+        t_hit.x = max(t_hit.x, 0.0);
+
+        ivec2 scene_pixel = min(ivec2(gl_FragCoord.xy * _25.scene_scale), _25.scene_size - ivec2(1, 1));
+        float mesh_distance = texelFetch(scene_distance_scene_smp, scene_pixel, 0).r;
+        t_hit.y = min(t_hit.y, mesh_distance / length(ray_dir * _25.volume_extent));
+        if (t_hit.x >= t_hit.y) {
             discard;
         }
-        vec2 _274 = t_hit;
-        float _129 = max(_274.x, 0.0);
-        vec2 _276 = _274;
-        _276.x = _129;
-        t_hit = _276;
-        vec3 _141 = vec3(1.0) / (vec3(_25.volume_dims) * abs(_109));
-        float _150 = min(_141.x, min(_141.y, _141.z));
-        FragColor = vec4(0.0);
-        vec3 p = transformed_eye + (_109 * _129);
-        for (float t = _129; t < t_hit.y; t += _150)
-        {
-            vec4 _186 = texture(volume_volume_smp, p);
-            float _187 = _186.x;
-            float _215 = FragColor.w;
-            vec4 _223 = FragColor;
-            vec3 _225 = _223.xyz + (vec4(texture(colormap_colormap_smp, vec2(fma(_187, 0.999000012874603271484375, 0.0005000000237487256526947021484375), 0.5)).xyz, _187).xyz * ((1.0 - _215) * _187));
-            FragColor.x = _225.x;
-            FragColor.y = _225.y;
-            FragColor.z = _225.z;
-            FragColor.w = fma(1.0 - FragColor.w, _187, FragColor.w);
-            if (FragColor.w >= 0.980000019073486328125)
-            {
+
+        vec3 dt_vec = 1.0 / (vec3(_25.volume_dims) * abs(ray_dir));
+        float dt = min(dt_vec.x, min(dt_vec.y, dt_vec.z));
+
+        float min_step = _25.march.x;
+        float max_step = _25.march.y;
+        float refine_opacity = _25.march.z;
+        float alpha_cutoff = _25.march.w;
+
+        FragColor = vec4(0.0, 0.0, 0.0, 0.0);
+
+        float steps = (t_hit.y - t_hit.x) / dt;
+        float s = _25.jitter;
+        float stride = 1.0;
+        float prev_val = -1.0;
+        while (s < steps) {
+            float t = t_hit.x + s * dt;
+            vec3 p = transformed_eye + t * ray_dir;
+
+            float t_skip = skip_empty(p, t, transformed_eye, ray_dir);
+            if (t_skip > t) {
+                s = max(floor((t_skip - t_hit.x) / dt - _25.jitter) + _25.jitter, s + 1.0);
+                stride = 1.0;
+                prev_val = -1.0;
+                continue;
+            }
+
+            float val = clamp(sample_volume(p, ray_lod(t, ray_dir)) * _25.value_scale + _25.value_offset, 0.0, 1.0);
+
+            bool faint = val <= refine_opacity && abs(val - prev_val) <= refine_opacity;
+            if (stride > min_step && !faint) {
+                s -= stride - min_step;
+                stride = min_step;
+                continue;
+            }
+
+            vec4 segment = transfer_segment(prev_val < 0.0 ? val : prev_val, val);
+            float alpha = 1.0 - pow(1.0 - segment.a, stride);
+            vec3 color = segment.rgb * (alpha / max(segment.a, 1e-6));
+
+            FragColor.rgb += (1.0 - FragColor.a) * color;
+            FragColor.a += (1.0 - FragColor.a) * alpha;
+
+            if (FragColor.a >= alpha_cutoff) {
                 break;
             }
-            p += (_109 * _150);
+            prev_val = val;
+            stride = faint ? min(stride * 2.0, max_step) : min_step;
+            s += stride;
         }
-        float param_2 = FragColor.x;
-        FragColor.x = linear_to_srgb(param_2);
-        float param_3 = FragColor.y;
-        FragColor.y = linear_to_srgb(param_3);
-        float param_4 = FragColor.z;
-        FragColor.z = linear_to_srgb(param_4);
+        FragColor.r = linear_to_srgb(FragColor.r);
+        FragColor.g = linear_to_srgb(FragColor.g);
+        FragColor.b = linear_to_srgb(FragColor.b);
     }
 
 */
-static const uint8_t fs_volume_source_glsl430[2456] = {
+static const uint8_t fs_volume_source_glsl430[5542] = {
     0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x73,0x74,
     0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x76,0x6f,0x6c,0x5f,0x70,0x61,0x72,0x61,
     0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x76,0x65,0x63,0x33,0x20,0x76,
     0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x64,0x69,0x6d,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x74,0x5f,0x73,0x63,0x61,0x6c,0x65,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6e,0x65,0x61,0x72,0x5f,0x63,
-    0x6c,0x69,0x70,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x66,
-    0x61,0x72,0x5f,0x63,0x6c,0x69,0x70,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
-    0x33,0x20,0x6e,0x65,0x77,0x5f,0x62,0x6f,0x78,0x5f,0x6d,0x69,0x6e,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x6e,0x65,0x77,0x5f,0x62,0x6f,0x78,0x5f,
-    0x6d,0x61,0x78,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,
-    0x20,0x66,0x73,0x5f,0x76,0x6f,0x6c,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x5f,
-    0x32,0x35,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,
-    0x69,0x6e,0x67,0x20,0x3d,0x20,0x30,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,
-    0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x33,0x44,0x20,0x76,0x6f,0x6c,0x75,0x6d,
-    0x65,0x5f,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x6c,0x61,
-    0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,
+    0x69,0x6e,0x74,0x20,0x62,0x72,0x69,0x63,0x6b,0x65,0x64,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x6e,0x74,0x20,0x62,0x72,0x69,0x63,0x6b,0x5f,0x73,0x69,0x7a,0x65,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x6e,0x65,0x77,0x5f,0x62,0x6f,
+    0x78,0x5f,0x6d,0x69,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,
+    0x6e,0x65,0x77,0x5f,0x62,0x6f,0x78,0x5f,0x6d,0x61,0x78,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6c,0x6f,0x64,0x5f,0x73,0x63,0x61,0x6c,0x65,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x6f,0x6c,0x75,0x6d,
+    0x65,0x5f,0x65,0x78,0x74,0x65,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x6d,0x61,0x78,0x5f,0x6c,0x6f,0x64,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x76,0x65,0x63,0x33,0x20,0x63,0x65,0x6c,0x6c,0x5f,0x64,0x69,0x6d,0x73,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x63,0x65,0x6c,0x6c,0x5f,0x73,
+    0x69,0x7a,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,
+    0x61,0x6c,0x75,0x65,0x5f,0x73,0x63,0x61,0x6c,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x5f,0x6f,0x66,0x66,0x73,
+    0x65,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x6d,0x61,0x72,
+    0x63,0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6a,0x69,
+    0x74,0x74,0x65,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x73,
+    0x63,0x65,0x6e,0x65,0x5f,0x73,0x63,0x61,0x6c,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x76,0x65,0x63,0x32,0x20,0x73,0x63,0x65,0x6e,0x65,0x5f,0x73,0x69,0x7a,0x65,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x66,0x73,
+    0x5f,0x76,0x6f,0x6c,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x5f,0x32,0x35,0x3b,
+    0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,
+    0x20,0x3d,0x20,0x30,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x33,0x44,0x20,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x76,
+    0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,
+    0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,0x29,0x20,0x75,
+    0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,
+    0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x65,0x72,0x5f,0x74,0x61,0x62,0x6c,0x65,0x5f,
+    0x74,0x72,0x61,0x6e,0x73,0x66,0x65,0x72,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x32,
     0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,
-    0x72,0x32,0x44,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x6d,0x61,0x70,0x5f,0x63,0x6f,0x6c,
-    0x6f,0x72,0x6d,0x61,0x70,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,
-    0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,
-    0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x72,0x61,0x79,0x5f,0x64,0x69,
-    0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
-    0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x66,0x6c,0x61,0x74,0x20,0x69,0x6e,0x20,
-    0x76,0x65,0x63,0x33,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x65,0x64,
-    0x5f,0x65,0x79,0x65,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,
-    0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,
-    0x65,0x63,0x34,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,
-    0x76,0x65,0x63,0x32,0x20,0x69,0x6e,0x74,0x65,0x72,0x73,0x65,0x63,0x74,0x5f,0x62,
-    0x6f,0x78,0x28,0x76,0x65,0x63,0x33,0x20,0x6f,0x72,0x69,0x67,0x2c,0x20,0x76,0x65,
-    0x63,0x33,0x20,0x64,0x69,0x72,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
-    0x63,0x33,0x20,0x5f,0x33,0x38,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x31,0x2e,
-    0x30,0x29,0x20,0x2f,0x20,0x64,0x69,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
-    0x63,0x33,0x20,0x5f,0x34,0x34,0x20,0x3d,0x20,0x28,0x5f,0x32,0x35,0x2e,0x6e,0x65,
-    0x77,0x5f,0x62,0x6f,0x78,0x5f,0x6d,0x69,0x6e,0x20,0x2d,0x20,0x6f,0x72,0x69,0x67,
-    0x29,0x20,0x2a,0x20,0x5f,0x33,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
-    0x33,0x20,0x5f,0x35,0x30,0x20,0x3d,0x20,0x28,0x5f,0x32,0x35,0x2e,0x6e,0x65,0x77,
-    0x5f,0x62,0x6f,0x78,0x5f,0x6d,0x61,0x78,0x20,0x2d,0x20,0x6f,0x72,0x69,0x67,0x29,
-    0x20,0x2a,0x20,0x5f,0x33,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,
-    0x20,0x5f,0x35,0x34,0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,0x5f,0x34,0x34,0x2c,0x20,
-    0x5f,0x35,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,
-    0x35,0x38,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x5f,0x34,0x34,0x2c,0x20,0x5f,0x35,
-    0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,
-    0x65,0x63,0x32,0x28,0x6d,0x61,0x78,0x28,0x5f,0x35,0x34,0x2e,0x78,0x2c,0x20,0x6d,
-    0x61,0x78,0x28,0x5f,0x35,0x34,0x2e,0x79,0x2c,0x20,0x5f,0x35,0x34,0x2e,0x7a,0x29,
-    0x29,0x2c,0x20,0x6d,0x69,0x6e,0x28,0x5f,0x35,0x38,0x2e,0x78,0x2c,0x20,0x6d,0x69,
-    0x6e,0x28,0x5f,0x35,0x38,0x2e,0x79,0x2c,0x20,0x5f,0x35,0x38,0x2e,0x7a,0x29,0x29,
-    0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6c,0x69,0x6e,0x65,
-    0x61,0x72,0x5f,0x74,0x6f,0x5f,0x73,0x72,0x67,0x62,0x28,0x66,0x6c,0x6f,0x61,0x74,
-    0x20,0x78,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x78,0x20,
-    0x3c,0x3d,0x20,0x30,0x2e,0x30,0x30,0x33,0x31,0x33,0x30,0x38,0x30,0x30,0x30,0x39,
-    0x30,0x37,0x33,0x30,0x31,0x39,0x30,0x32,0x37,0x37,0x30,0x39,0x39,0x36,0x30,0x39,
-    0x33,0x37,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x31,0x32,0x2e,0x39,0x32,0x30,
-    0x30,0x30,0x30,0x30,0x37,0x36,0x32,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,
-    0x20,0x2a,0x20,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
-    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6d,0x61,0x28,0x31,0x2e,0x30,0x35,0x34,
-    0x39,0x39,0x39,0x39,0x34,0x37,0x35,0x34,0x37,0x39,0x31,0x32,0x35,0x39,0x37,0x36,
-    0x35,0x36,0x32,0x35,0x2c,0x20,0x70,0x6f,0x77,0x28,0x78,0x2c,0x20,0x30,0x2e,0x34,
-    0x31,0x36,0x36,0x36,0x36,0x36,0x35,0x36,0x37,0x33,0x32,0x35,0x35,0x39,0x32,0x30,
-    0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x29,0x2c,0x20,0x2d,0x30,0x2e,0x30,0x35,
-    0x34,0x39,0x39,0x39,0x39,0x39,0x39,0x37,0x30,0x31,0x39,0x37,0x36,0x37,0x37,0x36,
-    0x31,0x32,0x33,0x30,0x34,0x36,0x38,0x37,0x35,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,
-    0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
-    0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x31,0x30,0x39,0x20,0x3d,0x20,0x6e,0x6f,0x72,
-    0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x76,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x29,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x20,0x3d,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x65,0x64,0x5f,0x65,
-    0x79,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,
-    0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x5f,0x31,0x30,0x39,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x31,0x31,0x37,0x20,0x3d,0x20,0x69,0x6e,0x74,
-    0x65,0x72,0x73,0x65,0x63,0x74,0x5f,0x62,0x6f,0x78,0x28,0x70,0x61,0x72,0x61,0x6d,
-    0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x76,0x65,0x63,0x32,0x20,0x74,0x5f,0x68,0x69,0x74,0x20,0x3d,0x20,0x5f,0x31,0x31,
-    0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x31,0x31,0x37,0x2e,
-    0x78,0x20,0x3e,0x20,0x5f,0x31,0x31,0x37,0x2e,0x79,0x29,0x0a,0x20,0x20,0x20,0x20,
-    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x69,0x73,0x63,0x61,0x72,
-    0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
-    0x32,0x20,0x5f,0x32,0x37,0x34,0x20,0x3d,0x20,0x74,0x5f,0x68,0x69,0x74,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x32,0x39,0x20,0x3d,
-    0x20,0x6d,0x61,0x78,0x28,0x5f,0x32,0x37,0x34,0x2e,0x78,0x2c,0x20,0x30,0x2e,0x30,
-    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x32,0x37,0x36,
-    0x20,0x3d,0x20,0x5f,0x32,0x37,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x32,0x37,
-    0x36,0x2e,0x78,0x20,0x3d,0x20,0x5f,0x31,0x32,0x39,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x74,0x5f,0x68,0x69,0x74,0x20,0x3d,0x20,0x5f,0x32,0x37,0x36,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x31,0x34,0x31,0x20,0x3d,0x20,0x76,0x65,
-    0x63,0x33,0x28,0x31,0x2e,0x30,0x29,0x20,0x2f,0x20,0x28,0x76,0x65,0x63,0x33,0x28,
+    0x72,0x33,0x44,0x20,0x62,0x72,0x69,0x63,0x6b,0x5f,0x74,0x61,0x62,0x6c,0x65,0x5f,
+    0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x6c,0x61,0x79,0x6f,
+    0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x33,0x29,0x20,
+    0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x33,
+    0x44,0x20,0x62,0x72,0x69,0x63,0x6b,0x5f,0x61,0x74,0x6c,0x61,0x73,0x5f,0x76,0x6f,
+    0x6c,0x75,0x6d,0x65,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
+    0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x34,0x29,0x20,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x33,0x44,0x20,
+    0x6f,0x63,0x63,0x75,0x70,0x61,0x6e,0x63,0x79,0x5f,0x76,0x6f,0x6c,0x75,0x6d,0x65,
+    0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,
+    0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x35,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,
+    0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x73,0x63,0x65,0x6e,
+    0x65,0x5f,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x63,0x65,0x6e,0x65,
+    0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x76,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x3b,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x31,0x29,0x20,0x66,0x6c,0x61,0x74,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,
+    0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x65,0x64,0x5f,0x65,0x79,0x65,0x3b,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x46,
+    0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x65,0x63,0x32,0x20,
+    0x69,0x6e,0x74,0x65,0x72,0x73,0x65,0x63,0x74,0x5f,0x62,0x6f,0x78,0x28,0x76,0x65,
+    0x63,0x33,0x20,0x6f,0x72,0x69,0x67,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x64,0x69,
+    0x72,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x62,0x6f,
+    0x78,0x5f,0x6d,0x69,0x6e,0x20,0x3d,0x20,0x5f,0x32,0x35,0x2e,0x6e,0x65,0x77,0x5f,
+    0x62,0x6f,0x78,0x5f,0x6d,0x69,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
+    0x33,0x20,0x62,0x6f,0x78,0x5f,0x6d,0x61,0x78,0x20,0x3d,0x20,0x5f,0x32,0x35,0x2e,
+    0x6e,0x65,0x77,0x5f,0x62,0x6f,0x78,0x5f,0x6d,0x61,0x78,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x33,0x20,0x69,0x6e,0x76,0x5f,0x64,0x69,0x72,0x20,0x3d,0x20,
+    0x31,0x2e,0x30,0x20,0x2f,0x20,0x64,0x69,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x74,0x6d,0x69,0x6e,0x5f,0x74,0x6d,0x70,0x20,0x3d,0x20,0x28,
+    0x62,0x6f,0x78,0x5f,0x6d,0x69,0x6e,0x20,0x2d,0x20,0x6f,0x72,0x69,0x67,0x29,0x20,
+    0x2a,0x20,0x69,0x6e,0x76,0x5f,0x64,0x69,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x74,0x6d,0x61,0x78,0x5f,0x74,0x6d,0x70,0x20,0x3d,0x20,0x28,
+    0x62,0x6f,0x78,0x5f,0x6d,0x61,0x78,0x20,0x2d,0x20,0x6f,0x72,0x69,0x67,0x29,0x20,
+    0x2a,0x20,0x69,0x6e,0x76,0x5f,0x64,0x69,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x74,0x6d,0x69,0x6e,0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,0x74,
+    0x6d,0x69,0x6e,0x5f,0x74,0x6d,0x70,0x2c,0x20,0x74,0x6d,0x61,0x78,0x5f,0x74,0x6d,
+    0x70,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x74,0x6d,0x61,
+    0x78,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x74,0x6d,0x69,0x6e,0x5f,0x74,0x6d,0x70,
+    0x2c,0x20,0x74,0x6d,0x61,0x78,0x5f,0x74,0x6d,0x70,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x30,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,
+    0x74,0x6d,0x69,0x6e,0x2e,0x78,0x2c,0x20,0x6d,0x61,0x78,0x28,0x74,0x6d,0x69,0x6e,
+    0x2e,0x79,0x2c,0x20,0x74,0x6d,0x69,0x6e,0x2e,0x7a,0x29,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x31,0x20,0x3d,0x20,0x6d,0x69,0x6e,
+    0x28,0x74,0x6d,0x61,0x78,0x2e,0x78,0x2c,0x20,0x6d,0x69,0x6e,0x28,0x74,0x6d,0x61,
+    0x78,0x2e,0x79,0x2c,0x20,0x74,0x6d,0x61,0x78,0x2e,0x7a,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x65,0x63,0x32,0x28,0x74,
+    0x30,0x2c,0x20,0x74,0x31,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x72,0x61,0x79,0x5f,0x6c,0x6f,0x64,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,
+    0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x29,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x61,0x79,0x5f,
+    0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x20,0x3d,0x20,0x74,0x20,0x2a,0x20,0x6c,
+    0x65,0x6e,0x67,0x74,0x68,0x28,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x20,0x2a,0x20,
+    0x5f,0x32,0x35,0x2e,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x65,0x78,0x74,0x65,0x6e,
+    0x74,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x63,
+    0x6c,0x61,0x6d,0x70,0x28,0x6c,0x6f,0x67,0x32,0x28,0x6d,0x61,0x78,0x28,0x72,0x61,
+    0x79,0x5f,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x20,0x2a,0x20,0x5f,0x32,0x35,
+    0x2e,0x6c,0x6f,0x64,0x5f,0x73,0x63,0x61,0x6c,0x65,0x2c,0x20,0x31,0x2e,0x30,0x29,
+    0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x5f,0x32,0x35,0x2e,0x6d,0x61,0x78,0x5f,
+    0x6c,0x6f,0x64,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,
+    0x61,0x6d,0x70,0x6c,0x65,0x5f,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x28,0x76,0x65,0x63,
+    0x33,0x20,0x70,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6c,0x6f,0x64,0x29,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x32,0x35,0x2e,0x62,0x72,
+    0x69,0x63,0x6b,0x65,0x64,0x20,0x3d,0x3d,0x20,0x30,0x29,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x4c,0x6f,0x64,0x28,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x76,
+    0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x70,0x2c,0x20,0x6c,0x6f,
+    0x64,0x29,0x2e,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x76,0x65,0x63,0x33,0x20,0x76,0x6f,0x78,0x65,0x6c,0x20,0x3d,0x20,0x63,0x6c,
+    0x61,0x6d,0x70,0x28,0x69,0x76,0x65,0x63,0x33,0x28,0x66,0x6c,0x6f,0x6f,0x72,0x28,
+    0x70,0x20,0x2a,0x20,0x76,0x65,0x63,0x33,0x28,0x5f,0x32,0x35,0x2e,0x76,0x6f,0x6c,
+    0x75,0x6d,0x65,0x5f,0x64,0x69,0x6d,0x73,0x29,0x29,0x29,0x2c,0x20,0x69,0x76,0x65,
+    0x63,0x33,0x28,0x30,0x2c,0x20,0x30,0x2c,0x20,0x30,0x29,0x2c,0x20,0x5f,0x32,0x35,
+    0x2e,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x64,0x69,0x6d,0x73,0x20,0x2d,0x20,0x69,
+    0x76,0x65,0x63,0x33,0x28,0x31,0x2c,0x20,0x31,0x2c,0x20,0x31,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x65,0x6e,0x74,0x72,0x79,0x20,0x3d,
+    0x20,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,0x74,0x63,0x68,0x28,0x62,0x72,0x69,0x63,
+    0x6b,0x5f,0x74,0x61,0x62,0x6c,0x65,0x5f,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x73,
+    0x6d,0x70,0x2c,0x20,0x76,0x6f,0x78,0x65,0x6c,0x20,0x2f,0x20,0x5f,0x32,0x35,0x2e,
+    0x62,0x72,0x69,0x63,0x6b,0x5f,0x73,0x69,0x7a,0x65,0x2c,0x20,0x30,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x62,0x72,0x69,0x63,0x6b,0x5f,0x6c,0x65,
+    0x76,0x65,0x6c,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x65,0x6e,0x74,0x72,0x79,0x2e,
+    0x61,0x20,0x2a,0x20,0x32,0x35,0x35,0x2e,0x30,0x20,0x2b,0x20,0x30,0x2e,0x35,0x29,
+    0x20,0x2d,0x20,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x62,0x72,
+    0x69,0x63,0x6b,0x5f,0x6c,0x65,0x76,0x65,0x6c,0x20,0x3c,0x20,0x30,0x29,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x76,0x65,0x63,0x33,0x20,0x63,0x6f,0x61,0x72,0x73,0x65,0x20,0x3d,0x20,0x76,0x6f,
+    0x78,0x65,0x6c,0x20,0x3e,0x3e,0x20,0x62,0x72,0x69,0x63,0x6b,0x5f,0x6c,0x65,0x76,
+    0x65,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x76,0x65,0x63,0x33,0x20,0x73,0x6c,
+    0x6f,0x74,0x20,0x3d,0x20,0x69,0x76,0x65,0x63,0x33,0x28,0x65,0x6e,0x74,0x72,0x79,
+    0x2e,0x72,0x67,0x62,0x20,0x2a,0x20,0x32,0x35,0x35,0x2e,0x30,0x20,0x2b,0x20,0x30,
+    0x2e,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x74,0x65,0x78,0x65,0x6c,0x46,0x65,0x74,0x63,0x68,0x28,0x62,0x72,0x69,0x63,0x6b,
+    0x5f,0x61,0x74,0x6c,0x61,0x73,0x5f,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x73,0x6d,
+    0x70,0x2c,0x20,0x73,0x6c,0x6f,0x74,0x20,0x2a,0x20,0x5f,0x32,0x35,0x2e,0x62,0x72,
+    0x69,0x63,0x6b,0x5f,0x73,0x69,0x7a,0x65,0x20,0x2b,0x20,0x28,0x63,0x6f,0x61,0x72,
+    0x73,0x65,0x20,0x2d,0x20,0x28,0x63,0x6f,0x61,0x72,0x73,0x65,0x20,0x2f,0x20,0x5f,
+    0x32,0x35,0x2e,0x62,0x72,0x69,0x63,0x6b,0x5f,0x73,0x69,0x7a,0x65,0x29,0x20,0x2a,
+    0x20,0x5f,0x32,0x35,0x2e,0x62,0x72,0x69,0x63,0x6b,0x5f,0x73,0x69,0x7a,0x65,0x29,
+    0x2c,0x20,0x30,0x29,0x2e,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x73,0x6b,0x69,0x70,0x5f,0x65,0x6d,0x70,0x74,0x79,0x28,0x76,0x65,0x63,0x33,
+    0x20,0x70,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x2c,0x20,0x76,0x65,0x63,
+    0x33,0x20,0x65,0x79,0x65,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x72,0x61,0x79,0x5f,
+    0x64,0x69,0x72,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,
+    0x63,0x65,0x6c,0x6c,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x3d,0x20,0x76,0x65,0x63,
+    0x33,0x28,0x5f,0x32,0x35,0x2e,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x64,0x69,0x6d,
+    0x73,0x29,0x20,0x2f,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x5f,0x32,0x35,0x2e,0x63,
+    0x65,0x6c,0x6c,0x5f,0x73,0x69,0x7a,0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x76,0x65,0x63,0x33,0x20,0x63,0x65,0x6c,0x6c,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,
+    0x70,0x28,0x69,0x76,0x65,0x63,0x33,0x28,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x70,0x20,
+    0x2a,0x20,0x63,0x65,0x6c,0x6c,0x5f,0x73,0x63,0x61,0x6c,0x65,0x29,0x29,0x2c,0x20,
+    0x69,0x76,0x65,0x63,0x33,0x28,0x30,0x2c,0x20,0x30,0x2c,0x20,0x30,0x29,0x2c,0x20,
+    0x5f,0x32,0x35,0x2e,0x63,0x65,0x6c,0x6c,0x5f,0x64,0x69,0x6d,0x73,0x20,0x2d,0x20,
+    0x69,0x76,0x65,0x63,0x33,0x28,0x31,0x2c,0x20,0x31,0x2c,0x20,0x31,0x29,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,
+    0x74,0x63,0x68,0x28,0x6f,0x63,0x63,0x75,0x70,0x61,0x6e,0x63,0x79,0x5f,0x76,0x6f,
+    0x6c,0x75,0x6d,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x63,0x65,0x6c,0x6c,0x2c,0x20,
+    0x30,0x29,0x2e,0x72,0x20,0x3e,0x20,0x30,0x2e,0x30,0x29,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x65,
+    0x78,0x69,0x74,0x5f,0x66,0x61,0x63,0x65,0x20,0x3d,0x20,0x28,0x76,0x65,0x63,0x33,
+    0x28,0x63,0x65,0x6c,0x6c,0x29,0x20,0x2b,0x20,0x73,0x74,0x65,0x70,0x28,0x76,0x65,
+    0x63,0x33,0x28,0x30,0x2e,0x30,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x30,0x2e,0x30,
+    0x29,0x2c,0x20,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x29,0x29,0x20,0x2f,0x20,0x63,
+    0x65,0x6c,0x6c,0x5f,0x73,0x63,0x61,0x6c,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x74,0x5f,0x65,0x78,0x69,0x74,0x20,0x3d,0x20,0x28,0x65,0x78,
+    0x69,0x74,0x5f,0x66,0x61,0x63,0x65,0x20,0x2d,0x20,0x65,0x79,0x65,0x29,0x20,0x2f,
+    0x20,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x20,0x6d,0x69,0x6e,0x28,0x74,0x5f,0x65,0x78,0x69,0x74,0x2e,
+    0x78,0x2c,0x20,0x6d,0x69,0x6e,0x28,0x74,0x5f,0x65,0x78,0x69,0x74,0x2e,0x79,0x2c,
+    0x20,0x74,0x5f,0x65,0x78,0x69,0x74,0x2e,0x7a,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x76,0x65,0x63,0x34,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x65,0x72,0x5f,0x73,0x65,
+    0x67,0x6d,0x65,0x6e,0x74,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x66,0x72,0x6f,0x6e,
+    0x74,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x62,0x61,0x63,0x6b,0x29,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x28,0x74,0x72,0x61,0x6e,0x73,0x66,0x65,0x72,0x5f,0x74,0x61,0x62,
+    0x6c,0x65,0x5f,0x74,0x72,0x61,0x6e,0x73,0x66,0x65,0x72,0x5f,0x73,0x6d,0x70,0x2c,
+    0x20,0x76,0x65,0x63,0x32,0x28,0x66,0x72,0x6f,0x6e,0x74,0x2c,0x20,0x62,0x61,0x63,
+    0x6b,0x29,0x20,0x2a,0x20,0x28,0x32,0x35,0x35,0x2e,0x30,0x20,0x2f,0x20,0x32,0x35,
+    0x36,0x2e,0x30,0x29,0x20,0x2b,0x20,0x30,0x2e,0x35,0x20,0x2f,0x20,0x32,0x35,0x36,
+    0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x77,0x61,
+    0x6e,0x67,0x5f,0x68,0x61,0x73,0x68,0x28,0x69,0x6e,0x74,0x20,0x73,0x65,0x65,0x64,
+    0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x73,0x65,0x65,0x64,0x20,0x3d,0x20,0x28,
+    0x73,0x65,0x65,0x64,0x20,0x5e,0x20,0x36,0x31,0x29,0x20,0x5e,0x20,0x28,0x73,0x65,
+    0x65,0x64,0x20,0x3e,0x3e,0x20,0x31,0x36,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,
+    0x65,0x65,0x64,0x20,0x2a,0x3d,0x20,0x39,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x65,
+    0x65,0x64,0x20,0x3d,0x20,0x73,0x65,0x65,0x64,0x20,0x5e,0x20,0x28,0x73,0x65,0x65,
+    0x64,0x20,0x3e,0x3e,0x20,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x65,0x65,
+    0x64,0x20,0x2a,0x3d,0x20,0x30,0x78,0x32,0x37,0x64,0x34,0x65,0x62,0x32,0x64,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x73,0x65,0x65,0x64,0x20,0x3d,0x20,0x73,0x65,0x65,0x64,
+    0x20,0x5e,0x20,0x28,0x73,0x65,0x65,0x64,0x20,0x3e,0x3e,0x20,0x31,0x35,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x28,0x73,0x65,0x65,0x64,0x20,0x25,0x20,0x32,0x31,0x34,0x37,0x34,0x38,0x33,
+    0x36,0x34,0x37,0x29,0x20,0x2f,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x32,0x31,0x34,
+    0x37,0x34,0x38,0x33,0x36,0x34,0x37,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x5f,0x74,0x6f,0x5f,0x73,0x72,0x67,
+    0x62,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x78,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x78,0x20,0x3c,0x3d,0x20,0x30,0x2e,0x30,0x30,0x33,0x31,
+    0x33,0x30,0x38,0x66,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x31,0x32,0x2e,0x39,0x32,0x66,0x20,0x2a,0x20,
+    0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x31,0x2e,0x30,0x35,0x35,0x66,0x20,0x2a,0x20,0x70,0x6f,0x77,
+    0x28,0x78,0x2c,0x20,0x31,0x2e,0x66,0x20,0x2f,0x20,0x32,0x2e,0x34,0x66,0x29,0x20,
+    0x2d,0x20,0x30,0x2e,0x30,0x35,0x35,0x66,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,
+    0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x20,0x3d,0x20,0x6e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x76,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,
+    0x29,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x74,0x5f,0x68,
+    0x69,0x74,0x20,0x3d,0x20,0x69,0x6e,0x74,0x65,0x72,0x73,0x65,0x63,0x74,0x5f,0x62,
+    0x6f,0x78,0x28,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x65,0x64,0x5f,0x65,
+    0x79,0x65,0x2c,0x20,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x5f,0x68,0x69,0x74,0x2e,0x78,0x20,0x3e,0x20,
+    0x74,0x5f,0x68,0x69,0x74,0x2e,0x79,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x74,0x5f,0x68,0x69,0x74,0x2e,0x78,0x20,0x3d,0x20,
+    0x6d,0x61,0x78,0x28,0x74,0x5f,0x68,0x69,0x74,0x2e,0x78,0x2c,0x20,0x30,0x2e,0x30,
+    0x29,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x69,0x76,0x65,0x63,0x32,0x20,0x73,0x63,
+    0x65,0x6e,0x65,0x5f,0x70,0x69,0x78,0x65,0x6c,0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,
+    0x69,0x76,0x65,0x63,0x32,0x28,0x67,0x6c,0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6f,
+    0x72,0x64,0x2e,0x78,0x79,0x20,0x2a,0x20,0x5f,0x32,0x35,0x2e,0x73,0x63,0x65,0x6e,
+    0x65,0x5f,0x73,0x63,0x61,0x6c,0x65,0x29,0x2c,0x20,0x5f,0x32,0x35,0x2e,0x73,0x63,
+    0x65,0x6e,0x65,0x5f,0x73,0x69,0x7a,0x65,0x20,0x2d,0x20,0x69,0x76,0x65,0x63,0x32,
+    0x28,0x31,0x2c,0x20,0x31,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x6d,0x65,0x73,0x68,0x5f,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,
+    0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,0x74,0x63,0x68,0x28,0x73,0x63,
+    0x65,0x6e,0x65,0x5f,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x63,0x65,
+    0x6e,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x73,0x63,0x65,0x6e,0x65,0x5f,0x70,0x69,
+    0x78,0x65,0x6c,0x2c,0x20,0x30,0x29,0x2e,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x74,
+    0x5f,0x68,0x69,0x74,0x2e,0x79,0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,0x74,0x5f,0x68,
+    0x69,0x74,0x2e,0x79,0x2c,0x20,0x6d,0x65,0x73,0x68,0x5f,0x64,0x69,0x73,0x74,0x61,
+    0x6e,0x63,0x65,0x20,0x2f,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x72,0x61,0x79,
+    0x5f,0x64,0x69,0x72,0x20,0x2a,0x20,0x5f,0x32,0x35,0x2e,0x76,0x6f,0x6c,0x75,0x6d,
+    0x65,0x5f,0x65,0x78,0x74,0x65,0x6e,0x74,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x74,0x5f,0x68,0x69,0x74,0x2e,0x78,0x20,0x3e,0x3d,0x20,0x74,
+    0x5f,0x68,0x69,0x74,0x2e,0x79,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x64,0x74,0x5f,0x76,0x65,
+    0x63,0x20,0x3d,0x20,0x31,0x2e,0x30,0x20,0x2f,0x20,0x28,0x76,0x65,0x63,0x33,0x28,
     0x5f,0x32,0x35,0x2e,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x64,0x69,0x6d,0x73,0x29,
-    0x20,0x2a,0x20,0x61,0x62,0x73,0x28,0x5f,0x31,0x30,0x39,0x29,0x29,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x35,0x30,0x20,0x3d,0x20,
-    0x6d,0x69,0x6e,0x28,0x5f,0x31,0x34,0x31,0x2e,0x78,0x2c,0x20,0x6d,0x69,0x6e,0x28,
-    0x5f,0x31,0x34,0x31,0x2e,0x79,0x2c,0x20,0x5f,0x31,0x34,0x31,0x2e,0x7a,0x29,0x29,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,
-    0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x20,0x3d,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,
-    0x6f,0x72,0x6d,0x65,0x64,0x5f,0x65,0x79,0x65,0x20,0x2b,0x20,0x28,0x5f,0x31,0x30,
-    0x39,0x20,0x2a,0x20,0x5f,0x31,0x32,0x39,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
-    0x6f,0x72,0x20,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x20,0x3d,0x20,0x5f,0x31,
-    0x32,0x39,0x3b,0x20,0x74,0x20,0x3c,0x20,0x74,0x5f,0x68,0x69,0x74,0x2e,0x79,0x3b,
-    0x20,0x74,0x20,0x2b,0x3d,0x20,0x5f,0x31,0x35,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,
-    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,
-    0x31,0x38,0x36,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x76,0x6f,
-    0x6c,0x75,0x6d,0x65,0x5f,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x73,0x6d,0x70,0x2c,
-    0x20,0x70,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x20,0x5f,0x31,0x38,0x37,0x20,0x3d,0x20,0x5f,0x31,0x38,0x36,0x2e,0x78,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
-    0x5f,0x32,0x31,0x35,0x20,0x3d,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,
-    0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,
-    0x20,0x5f,0x32,0x32,0x33,0x20,0x3d,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,
-    0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,
-    0x5f,0x32,0x32,0x35,0x20,0x3d,0x20,0x5f,0x32,0x32,0x33,0x2e,0x78,0x79,0x7a,0x20,
-    0x2b,0x20,0x28,0x76,0x65,0x63,0x34,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,
-    0x63,0x6f,0x6c,0x6f,0x72,0x6d,0x61,0x70,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x6d,0x61,
-    0x70,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x66,0x6d,0x61,0x28,
-    0x5f,0x31,0x38,0x37,0x2c,0x20,0x30,0x2e,0x39,0x39,0x39,0x30,0x30,0x30,0x30,0x31,
-    0x32,0x38,0x37,0x34,0x36,0x30,0x33,0x32,0x37,0x31,0x34,0x38,0x34,0x33,0x37,0x35,
-    0x2c,0x20,0x30,0x2e,0x30,0x30,0x30,0x35,0x30,0x30,0x30,0x30,0x30,0x30,0x32,0x33,
-    0x37,0x34,0x38,0x37,0x32,0x35,0x36,0x35,0x32,0x36,0x39,0x34,0x37,0x30,0x32,0x31,
-    0x34,0x38,0x34,0x33,0x37,0x35,0x29,0x2c,0x20,0x30,0x2e,0x35,0x29,0x29,0x2e,0x78,
-    0x79,0x7a,0x2c,0x20,0x5f,0x31,0x38,0x37,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,
-    0x28,0x28,0x31,0x2e,0x30,0x20,0x2d,0x20,0x5f,0x32,0x31,0x35,0x29,0x20,0x2a,0x20,
-    0x5f,0x31,0x38,0x37,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x78,0x20,0x3d,0x20,0x5f,0x32,
-    0x32,0x35,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x46,0x72,
-    0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x79,0x20,0x3d,0x20,0x5f,0x32,0x32,0x35,
-    0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,
-    0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x7a,0x20,0x3d,0x20,0x5f,0x32,0x32,0x35,0x2e,0x7a,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,
-    0x6c,0x6f,0x72,0x2e,0x77,0x20,0x3d,0x20,0x66,0x6d,0x61,0x28,0x31,0x2e,0x30,0x20,
-    0x2d,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x77,0x2c,0x20,0x5f,
-    0x31,0x38,0x37,0x2c,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x77,
-    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x46,
-    0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x77,0x20,0x3e,0x3d,0x20,0x30,0x2e,
-    0x39,0x38,0x30,0x30,0x30,0x30,0x30,0x31,0x39,0x30,0x37,0x33,0x34,0x38,0x36,0x33,
-    0x32,0x38,0x31,0x32,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x72,0x65,
-    0x61,0x6b,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x20,0x2b,0x3d,0x20,0x28,0x5f,0x31,0x30,0x39,
-    0x20,0x2a,0x20,0x5f,0x31,0x35,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x32,0x20,0x3d,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x78,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x78,
-    0x20,0x3d,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x5f,0x74,0x6f,0x5f,0x73,0x72,0x67,
-    0x62,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,
-    0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x79,0x20,0x3d,0x20,0x6c,
-    0x69,0x6e,0x65,0x61,0x72,0x5f,0x74,0x6f,0x5f,0x73,0x72,0x67,0x62,0x28,0x70,0x61,
-    0x72,0x61,0x6d,0x5f,0x33,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x46,0x72,0x61,0x67,
-    0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,
-    0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x7a,0x20,0x3d,0x20,0x6c,0x69,0x6e,0x65,0x61,
-    0x72,0x5f,0x74,0x6f,0x5f,0x73,0x72,0x67,0x62,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x34,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+    0x20,0x2a,0x20,0x61,0x62,0x73,0x28,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x74,0x20,0x3d,
+    0x20,0x6d,0x69,0x6e,0x28,0x64,0x74,0x5f,0x76,0x65,0x63,0x2e,0x78,0x2c,0x20,0x6d,
+    0x69,0x6e,0x28,0x64,0x74,0x5f,0x76,0x65,0x63,0x2e,0x79,0x2c,0x20,0x64,0x74,0x5f,
+    0x76,0x65,0x63,0x2e,0x7a,0x29,0x29,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x6d,0x69,0x6e,0x5f,0x73,0x74,0x65,0x70,0x20,0x3d,0x20,0x5f,
+    0x32,0x35,0x2e,0x6d,0x61,0x72,0x63,0x68,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x6d,0x61,0x78,0x5f,0x73,0x74,0x65,0x70,0x20,0x3d,
+    0x20,0x5f,0x32,0x35,0x2e,0x6d,0x61,0x72,0x63,0x68,0x2e,0x79,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x65,0x66,0x69,0x6e,0x65,0x5f,0x6f,
+    0x70,0x61,0x63,0x69,0x74,0x79,0x20,0x3d,0x20,0x5f,0x32,0x35,0x2e,0x6d,0x61,0x72,
+    0x63,0x68,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x61,0x6c,0x70,0x68,0x61,0x5f,0x63,0x75,0x74,0x6f,0x66,0x66,0x20,0x3d,0x20,0x5f,
+    0x32,0x35,0x2e,0x6d,0x61,0x72,0x63,0x68,0x2e,0x77,0x3b,0x0a,0x0a,0x20,0x20,0x20,
+    0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,
+    0x34,0x28,0x30,0x2e,0x30,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x30,0x2e,0x30,0x2c,
+    0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x73,0x74,0x65,0x70,0x73,0x20,0x3d,0x20,0x28,0x74,0x5f,0x68,0x69,0x74,
+    0x2e,0x79,0x20,0x2d,0x20,0x74,0x5f,0x68,0x69,0x74,0x2e,0x78,0x29,0x20,0x2f,0x20,
+    0x64,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x20,
+    0x3d,0x20,0x5f,0x32,0x35,0x2e,0x6a,0x69,0x74,0x74,0x65,0x72,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x74,0x72,0x69,0x64,0x65,0x20,0x3d,
+    0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x70,0x72,0x65,0x76,0x5f,0x76,0x61,0x6c,0x20,0x3d,0x20,0x2d,0x31,0x2e,0x30,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x73,0x20,0x3c,0x20,
+    0x73,0x74,0x65,0x70,0x73,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x20,0x3d,0x20,0x74,0x5f,0x68,0x69,0x74,
+    0x2e,0x78,0x20,0x2b,0x20,0x73,0x20,0x2a,0x20,0x64,0x74,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x20,0x3d,0x20,0x74,0x72,
+    0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x65,0x64,0x5f,0x65,0x79,0x65,0x20,0x2b,0x20,
+    0x74,0x20,0x2a,0x20,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x3b,0x0a,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x5f,0x73,0x6b,
+    0x69,0x70,0x20,0x3d,0x20,0x73,0x6b,0x69,0x70,0x5f,0x65,0x6d,0x70,0x74,0x79,0x28,
+    0x70,0x2c,0x20,0x74,0x2c,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x65,
+    0x64,0x5f,0x65,0x79,0x65,0x2c,0x20,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x5f,0x73,
+    0x6b,0x69,0x70,0x20,0x3e,0x20,0x74,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x66,
+    0x6c,0x6f,0x6f,0x72,0x28,0x28,0x74,0x5f,0x73,0x6b,0x69,0x70,0x20,0x2d,0x20,0x74,
+    0x5f,0x68,0x69,0x74,0x2e,0x78,0x29,0x20,0x2f,0x20,0x64,0x74,0x20,0x2d,0x20,0x5f,
+    0x32,0x35,0x2e,0x6a,0x69,0x74,0x74,0x65,0x72,0x29,0x20,0x2b,0x20,0x5f,0x32,0x35,
+    0x2e,0x6a,0x69,0x74,0x74,0x65,0x72,0x2c,0x20,0x73,0x20,0x2b,0x20,0x31,0x2e,0x30,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,
+    0x74,0x72,0x69,0x64,0x65,0x20,0x3d,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x65,0x76,0x5f,0x76,0x61,
+    0x6c,0x20,0x3d,0x20,0x2d,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x61,0x6c,0x20,0x3d,0x20,0x63,
+    0x6c,0x61,0x6d,0x70,0x28,0x73,0x61,0x6d,0x70,0x6c,0x65,0x5f,0x76,0x6f,0x6c,0x75,
+    0x6d,0x65,0x28,0x70,0x2c,0x20,0x72,0x61,0x79,0x5f,0x6c,0x6f,0x64,0x28,0x74,0x2c,
+    0x20,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x29,0x29,0x20,0x2a,0x20,0x5f,0x32,0x35,
+    0x2e,0x76,0x61,0x6c,0x75,0x65,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x2b,0x20,0x5f,
+    0x32,0x35,0x2e,0x76,0x61,0x6c,0x75,0x65,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x2c,
+    0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x66,0x61,0x69,0x6e,0x74,0x20,
+    0x3d,0x20,0x76,0x61,0x6c,0x20,0x3c,0x3d,0x20,0x72,0x65,0x66,0x69,0x6e,0x65,0x5f,
+    0x6f,0x70,0x61,0x63,0x69,0x74,0x79,0x20,0x26,0x26,0x20,0x61,0x62,0x73,0x28,0x76,
+    0x61,0x6c,0x20,0x2d,0x20,0x70,0x72,0x65,0x76,0x5f,0x76,0x61,0x6c,0x29,0x20,0x3c,
+    0x3d,0x20,0x72,0x65,0x66,0x69,0x6e,0x65,0x5f,0x6f,0x70,0x61,0x63,0x69,0x74,0x79,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x73,0x74,
+    0x72,0x69,0x64,0x65,0x20,0x3e,0x20,0x6d,0x69,0x6e,0x5f,0x73,0x74,0x65,0x70,0x20,
+    0x26,0x26,0x20,0x21,0x66,0x61,0x69,0x6e,0x74,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x20,0x2d,0x3d,0x20,0x73,0x74,
+    0x72,0x69,0x64,0x65,0x20,0x2d,0x20,0x6d,0x69,0x6e,0x5f,0x73,0x74,0x65,0x70,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x74,0x72,
+    0x69,0x64,0x65,0x20,0x3d,0x20,0x6d,0x69,0x6e,0x5f,0x73,0x74,0x65,0x70,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x74,
+    0x69,0x6e,0x75,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x73,0x65,
+    0x67,0x6d,0x65,0x6e,0x74,0x20,0x3d,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x65,0x72,
+    0x5f,0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x28,0x70,0x72,0x65,0x76,0x5f,0x76,0x61,
+    0x6c,0x20,0x3c,0x20,0x30,0x2e,0x30,0x20,0x3f,0x20,0x76,0x61,0x6c,0x20,0x3a,0x20,
+    0x70,0x72,0x65,0x76,0x5f,0x76,0x61,0x6c,0x2c,0x20,0x76,0x61,0x6c,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x61,0x6c,
+    0x70,0x68,0x61,0x20,0x3d,0x20,0x31,0x2e,0x30,0x20,0x2d,0x20,0x70,0x6f,0x77,0x28,
+    0x31,0x2e,0x30,0x20,0x2d,0x20,0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x2e,0x61,0x2c,
+    0x20,0x73,0x74,0x72,0x69,0x64,0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x73,
+    0x65,0x67,0x6d,0x65,0x6e,0x74,0x2e,0x72,0x67,0x62,0x20,0x2a,0x20,0x28,0x61,0x6c,
+    0x70,0x68,0x61,0x20,0x2f,0x20,0x6d,0x61,0x78,0x28,0x73,0x65,0x67,0x6d,0x65,0x6e,
+    0x74,0x2e,0x61,0x2c,0x20,0x31,0x65,0x2d,0x36,0x29,0x29,0x3b,0x0a,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,
+    0x72,0x67,0x62,0x20,0x2b,0x3d,0x20,0x28,0x31,0x2e,0x30,0x20,0x2d,0x20,0x46,0x72,
+    0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x61,0x29,0x20,0x2a,0x20,0x63,0x6f,0x6c,
+    0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,
+    0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x61,0x20,0x2b,0x3d,0x20,0x28,0x31,0x2e,0x30,0x20,
+    0x2d,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x61,0x29,0x20,0x2a,
+    0x20,0x61,0x6c,0x70,0x68,0x61,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x61,
+    0x20,0x3e,0x3d,0x20,0x61,0x6c,0x70,0x68,0x61,0x5f,0x63,0x75,0x74,0x6f,0x66,0x66,
+    0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x62,0x72,0x65,0x61,0x6b,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x65,0x76,0x5f,0x76,0x61,
+    0x6c,0x20,0x3d,0x20,0x76,0x61,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x73,0x74,0x72,0x69,0x64,0x65,0x20,0x3d,0x20,0x66,0x61,0x69,0x6e,0x74,0x20,
+    0x3f,0x20,0x6d,0x69,0x6e,0x28,0x73,0x74,0x72,0x69,0x64,0x65,0x20,0x2a,0x20,0x32,
+    0x2e,0x30,0x2c,0x20,0x6d,0x61,0x78,0x5f,0x73,0x74,0x65,0x70,0x29,0x20,0x3a,0x20,
+    0x6d,0x69,0x6e,0x5f,0x73,0x74,0x65,0x70,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x73,0x20,0x2b,0x3d,0x20,0x73,0x74,0x72,0x69,0x64,0x65,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,
+    0x6f,0x72,0x2e,0x72,0x20,0x3d,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x5f,0x74,0x6f,
+    0x5f,0x73,0x72,0x67,0x62,0x28,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,
+    0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,
+    0x72,0x2e,0x67,0x20,0x3d,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x5f,0x74,0x6f,0x5f,
+    0x73,0x72,0x67,0x62,0x28,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x67,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,
+    0x2e,0x62,0x20,0x3d,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x5f,0x74,0x6f,0x5f,0x73,
+    0x72,0x67,0x62,0x28,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x62,0x29,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
 /*
     cbuffer vs_vol_params : register(b0)
@@ -389,8 +731,8 @@ static const uint8_t fs_volume_source_glsl430[2456] = {
 
     static float4 gl_Position;
     static float3 pos;
-    static float3 transformed_eye;
     static float3 vray_dir;
+    static float3 transformed_eye;
 
     struct SPIRV_Cross_Input
     {
@@ -406,7 +748,8 @@ static const uint8_t fs_volume_source_glsl430[2456] = {
 
     void vert_main()
     {
-        gl_Position = mul(float4(mad(pos, _20_volume_scale, _20_volume_translation), 1.0f), _20_proj_view);
+        gl_Position = mul(float4(pos * _20_volume_scale + _20_volume_translation, 1.0f), _20_proj_view);
+
         transformed_eye = (_20_eye_pos - _20_volume_translation) / _20_volume_scale;
         vray_dir = pos - transformed_eye;
     }
@@ -417,12 +760,13 @@ static const uint8_t fs_volume_source_glsl430[2456] = {
         vert_main();
         SPIRV_Cross_Output stage_output;
         stage_output.gl_Position = gl_Position;
-        stage_output.transformed_eye = transformed_eye;
         stage_output.vray_dir = vray_dir;
+        stage_output.transformed_eye = transformed_eye;
         return stage_output;
     }
+
 */
-static const uint8_t vs_volume_source_hlsl5[1103] = {
+static const uint8_t vs_volume_source_hlsl5[1101] = {
     0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x76,0x73,0x5f,0x76,0x6f,0x6c,0x5f,0x70,
     0x61,0x72,0x61,0x6d,0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,
     0x28,0x62,0x30,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x77,0x5f,0x6d,
@@ -441,10 +785,10 @@ static const uint8_t vs_volume_source_hlsl5[1103] = {
     0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,
     0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
     0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x6f,0x73,0x3b,0x0a,0x73,0x74,0x61,0x74,
-    0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,
-    0x6f,0x72,0x6d,0x65,0x64,0x5f,0x65,0x79,0x65,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,
-    0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x72,0x61,0x79,0x5f,0x64,0x69,
-    0x72,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,
+    0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x72,0x61,0x79,0x5f,0x64,
+    0x69,0x72,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x65,0x64,0x5f,0x65,0x79,
+    0x65,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,
     0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,
     0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x6f,0x73,0x20,0x3a,0x20,
     0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,
@@ -460,55 +804,72 @@ static const uint8_t vs_volume_source_hlsl5[1103] = {
     0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x6f,
     0x69,0x64,0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,
     0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
-    0x20,0x3d,0x20,0x6d,0x75,0x6c,0x28,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x6d,0x61,
-    0x64,0x28,0x70,0x6f,0x73,0x2c,0x20,0x5f,0x32,0x30,0x5f,0x76,0x6f,0x6c,0x75,0x6d,
-    0x65,0x5f,0x73,0x63,0x61,0x6c,0x65,0x2c,0x20,0x5f,0x32,0x30,0x5f,0x76,0x6f,0x6c,
-    0x75,0x6d,0x65,0x5f,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x69,0x6f,0x6e,0x29,
-    0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x2c,0x20,0x5f,0x32,0x30,0x5f,0x70,0x72,0x6f,
-    0x6a,0x5f,0x76,0x69,0x65,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x74,0x72,0x61,
-    0x6e,0x73,0x66,0x6f,0x72,0x6d,0x65,0x64,0x5f,0x65,0x79,0x65,0x20,0x3d,0x20,0x28,
-    0x5f,0x32,0x30,0x5f,0x65,0x79,0x65,0x5f,0x70,0x6f,0x73,0x20,0x2d,0x20,0x5f,0x32,
-    0x30,0x5f,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,
-    0x74,0x69,0x6f,0x6e,0x29,0x20,0x2f,0x20,0x5f,0x32,0x30,0x5f,0x76,0x6f,0x6c,0x75,
-    0x6d,0x65,0x5f,0x73,0x63,0x61,0x6c,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x72,
-    0x61,0x79,0x5f,0x64,0x69,0x72,0x20,0x3d,0x20,0x70,0x6f,0x73,0x20,0x2d,0x20,0x74,
-    0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x65,0x64,0x5f,0x65,0x79,0x65,0x3b,0x0a,
-    0x7d,0x0a,0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,
-    0x75,0x74,0x70,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,0x49,0x52,0x56,
-    0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x61,
-    0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
-    0x70,0x6f,0x73,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,
-    0x74,0x2e,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x72,0x74,0x5f,
-    0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,0x52,
-    0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x73,
-    0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x67,0x6c,
-    0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x67,0x6c,0x5f,0x50,
-    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,
-    0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x74,0x72,0x61,0x6e,0x73,0x66,
-    0x6f,0x72,0x6d,0x65,0x64,0x5f,0x65,0x79,0x65,0x20,0x3d,0x20,0x74,0x72,0x61,0x6e,
-    0x73,0x66,0x6f,0x72,0x6d,0x65,0x64,0x5f,0x65,0x79,0x65,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x72,
-    0x61,0x79,0x5f,0x64,0x69,0x72,0x20,0x3d,0x20,0x76,0x72,0x61,0x79,0x5f,0x64,0x69,
-    0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,
-    0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
+    0x20,0x3d,0x20,0x6d,0x75,0x6c,0x28,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x70,0x6f,
+    0x73,0x20,0x2a,0x20,0x5f,0x32,0x30,0x5f,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x73,
+    0x63,0x61,0x6c,0x65,0x20,0x2b,0x20,0x5f,0x32,0x30,0x5f,0x76,0x6f,0x6c,0x75,0x6d,
+    0x65,0x5f,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x31,
+    0x2e,0x30,0x66,0x29,0x2c,0x20,0x5f,0x32,0x30,0x5f,0x70,0x72,0x6f,0x6a,0x5f,0x76,
+    0x69,0x65,0x77,0x29,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x74,0x72,0x61,0x6e,0x73,
+    0x66,0x6f,0x72,0x6d,0x65,0x64,0x5f,0x65,0x79,0x65,0x20,0x3d,0x20,0x28,0x5f,0x32,
+    0x30,0x5f,0x65,0x79,0x65,0x5f,0x70,0x6f,0x73,0x20,0x2d,0x20,0x5f,0x32,0x30,0x5f,
+    0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x69,
+    0x6f,0x6e,0x29,0x20,0x2f,0x20,0x5f,0x32,0x30,0x5f,0x76,0x6f,0x6c,0x75,0x6d,0x65,
+    0x5f,0x73,0x63,0x61,0x6c,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x72,0x61,0x79,
+    0x5f,0x64,0x69,0x72,0x20,0x3d,0x20,0x70,0x6f,0x73,0x20,0x2d,0x20,0x74,0x72,0x61,
+    0x6e,0x73,0x66,0x6f,0x72,0x6d,0x65,0x64,0x5f,0x65,0x79,0x65,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,
+    0x70,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,
+    0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,
+    0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x70,0x6f,
+    0x73,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,
+    0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,0x61,
+    0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,
+    0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,
+    0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,
+    0x20,0x3d,0x20,0x76,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x74,0x72,
+    0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x65,0x64,0x5f,0x65,0x79,0x65,0x20,0x3d,0x20,
+    0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x65,0x64,0x5f,0x65,0x79,0x65,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x61,0x67,
+    0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
 };
 /*
     cbuffer fs_vol_params : register(b0)
     {
         int3 _25_volume_dims : packoffset(c0);
-        float _25_dt_scale : packoffset(c0.w);
-        float _25_near_clip : packoffset(c1);
-        float _25_far_clip : packoffset(c1.y);
+        int _25_bricked : packoffset(c0.w);
+        int _25_brick_size : packoffset(c1);
         float3 _25_new_box_min : packoffset(c2);
         float3 _25_new_box_max : packoffset(c3);
+        float _25_lod_scale : packoffset(c3.w);
+        float3 _25_volume_extent : packoffset(c4);
+        float _25_max_lod : packoffset(c4.w);
+        int3 _25_cell_dims : packoffset(c5);
+        int _25_cell_size : packoffset(c5.w);
+        float _25_value_scale : packoffset(c6);
+        float _25_value_offset : packoffset(c6.y);
+        float4 _25_march : packoffset(c7);
+        float _25_jitter : packoffset(c8);
+        float2 _25_scene_scale : packoffset(c8.z);
+        int2 _25_scene_size : packoffset(c9);
     };
 
+
     Texture3D<float4> volume : register(t0);
     SamplerState volume_smp : register(s0);
-    Texture2D<float4> colormap : register(t1);
-    SamplerState colormap_smp : register(s1);
+    Texture2D<float4> transfer_table : register(t1);
+    SamplerState transfer_smp : register(s1);
+    Texture3D<float4> brick_table : register(t2);
+    Texture3D<float4> brick_atlas : register(t3);
+    Texture3D<float4> occupancy : register(t4);
+    Texture2D<float4> scene_distance : register(t5);
+    SamplerState scene_smp : register(s2);
 
+    static float4 gl_FragCoord;
     static float3 vray_dir;
     static float3 transformed_eye;
     static float4 FragColor;
@@ -517,6 +878,7 @@ static const uint8_t vs_volume_source_hlsl5[1103] = {
     {
         float3 vray_dir : TEXCOORD0;
         nointerpolation float3 transformed_eye : TEXCOORD1;
+        float4 gl_FragCoord : SV_Position;
     };
 
     struct SPIRV_Cross_Output
@@ -524,72 +886,145 @@ static const uint8_t vs_volume_source_hlsl5[1103] = {
         float4 FragColor : SV_Target0;
     };
 
-    float2 intersect_box(float3 orig, float3 dir)
-    {
-        float3 _38 = 1.0f.xxx / dir;
-        float3 _44 = (_25_new_box_min - orig) * _38;
-        float3 _50 = (_25_new_box_max - orig) * _38;
-        float3 _54 = min(_44, _50);
-        float3 _58 = max(_44, _50);
-        return float2(max(_54.x, max(_54.y, _54.z)), min(_58.x, min(_58.y, _58.z)));
+    float2 intersect_box(float3 orig, float3 dir) {
+        float3 box_min = _25_new_box_min;
+        float3 box_max = _25_new_box_max;
+        float3 inv_dir = 1.0f / dir;
+        float3 tmin_tmp = (box_min - orig) * inv_dir;
+        float3 tmax_tmp = (box_max - orig) * inv_dir;
+        float3 tmin = min(tmin_tmp, tmax_tmp);
+        float3 tmax = max(tmin_tmp, tmax_tmp);
+        float t0 = max(tmin.x, max(tmin.y, tmin.z));
+        float t1 = min(tmax.x, min(tmax.y, tmax.z));
+        return float2(t0, t1);
     }
 
-    float linear_to_srgb(float x)
-    {
-        if (x <= 0.003130800090730190277099609375f)
-        {
-            return 12.9200000762939453125f * x;
+    float ray_lod(float t, float3 ray_dir) {
+        float ray_distance = t * length(ray_dir * _25_volume_extent);
+        return clamp(log2(max(ray_distance * _25_lod_scale, 1.0f)), 0.0f, _25_max_lod);
+    }
+
+    float sample_volume(float3 p, float lod) {
+        if (_25_bricked == 0) {
+            return volume.SampleLevel(volume_smp, p, lod).r;
         }
-        return mad(1.05499994754791259765625f, pow(x, 0.4166666567325592041015625f), -0.054999999701976776123046875f);
+        int3 voxel = clamp(((int3)(floor(p * ((float3)(_25_volume_dims))))), int3(0, 0, 0), _25_volume_dims - int3(1, 1, 1));
+        float4 entry = brick_table.Load(int4(voxel / _25_brick_size, 0));
+        int brick_level = int(entry.a * 255.0f + 0.5f) - 1;
+        if (brick_level < 0) {
+            return 0.0f;
+        }
+        int3 coarse = voxel >> brick_level;
+        int3 slot = ((int3)(entry.rgb * 255.0f + 0.5f));
+        return brick_atlas.Load(int4(slot * _25_brick_size + (coarse - (coarse / _25_brick_size) * _25_brick_size), 0)).r;
+    }
+
+    float skip_empty(float3 p, float t, float3 eye, float3 ray_dir) {
+        float3 cell_scale = ((float3)(_25_volume_dims)) / float(_25_cell_size);
+        int3 cell = clamp(((int3)(floor(p * cell_scale))), int3(0, 0, 0), _25_cell_dims - int3(1, 1, 1));
+        if (occupancy.Load(int4(cell, 0)).r > 0.0f) {
+            return t;
+        }
+        float3 exit_face = (((float3)(cell)) + step(float3(0.0f, 0.0f, 0.0f), ray_dir)) / cell_scale;
+        float3 t_exit = (exit_face - eye) / ray_dir;
+        return min(t_exit.x, min(t_exit.y, t_exit.z));
+    }
+
+    float4 transfer_segment(float front, float back) {
+        return transfer_table.Sample(transfer_smp, float2(front, back) * (255.0f / 256.0f) + 0.5f / 256.0f);
+    }
+
+    float wang_hash(int seed) {
+        seed = (seed ^ 61) ^ (seed >> 16);
+        seed *= 9;
+        seed = seed ^ (seed >> 4);
+        seed *= 0x27d4eb2d;
+        seed = seed ^ (seed >> 15);
+        return float(seed % 2147483647) / float(2147483647);
+    }
+
+    float linear_to_srgb(float x) {
+        if (x <= 0.0031308f) {
+            return 12.92f * x;
+        }
+        return 1.055f * pow(x, 1.f / 2.4f) - 0.055f;
     }
 
     void frag_main()
     {
-        float3 _109 = normalize(vray_dir);
-        float3 param = transformed_eye;
-        float3 param_1 = _109;
-        float2 _117 = intersect_box(param, param_1);
-        float2 t_hit = _117;
-        if (_117.x > _117.y)
-        {
+        float3 ray_dir = normalize(vray_dir);
+
+        float2 t_hit = intersect_box(transformed_eye, ray_dir);
+        if (t_hit.x > t_hit.y) {
+            discard;
+        }
+        t_hit.x = max(t_hit.x, 0.0f);
+
+        int2 scene_pixel = min(((int2)(gl_FragCoord.xy * _25_scene_scale)), _25_scene_size - int2(1, 1));
+        float mesh_distance = scene_distance.Load(int3(scene_pixel, 0)).r;
+        t_hit.y = min(t_hit.y, mesh_distance / length(ray_dir * _25_volume_extent));
+        if (t_hit.x >= t_hit.y) {
             discard;
         }
-        float2 _274 = t_hit;
-        float _129 = max(_274.x, 0.0f);
-        float2 _276 = _274;
-        _276.x = _129;
-        t_hit = _276;
-        float3 _141 = 1.0f.xxx / (float3(_25_volume_dims) * abs(_109));
-        float _150 = min(_141.x, min(_141.y, _141.z));
-        FragColor = 0.0f.xxxx;
-        float3 p = transformed_eye + (_109 * _129);
-        for (float t = _129; t < t_hit.y; t += _150)
-        {
-            float4 _186 = volume.Sample(volume_smp, p);
-            float _187 = _186.x;
-            float _215 = FragColor.w;
-            float4 _223 = FragColor;
-            float3 _225 = _223.xyz + (float4(colormap.Sample(colormap_smp, float2(mad(_187, 0.999000012874603271484375f, 0.0005000000237487256526947021484375f), 0.5f)).xyz, _187).xyz * ((1.0f - _215) * _187));
-            FragColor.x = _225.x;
-            FragColor.y = _225.y;
-            FragColor.z = _225.z;
-            FragColor.w = mad(1.0f - FragColor.w, _187, FragColor.w);
-            if (FragColor.w >= 0.980000019073486328125f)
-            {
+
+        float3 dt_vec = 1.0f / (((float3)(_25_volume_dims)) * abs(ray_dir));
+        float dt = min(dt_vec.x, min(dt_vec.y, dt_vec.z));
+
+        float min_step = _25_march.x;
+        float max_step = _25_march.y;
+        float refine_opacity = _25_march.z;
+        float alpha_cutoff = _25_march.w;
+
+        FragColor = float4(0.0f, 0.0f, 0.0f, 0.0f);
+
+        float steps = (t_hit.y - t_hit.x) / dt;
+        float s = _25_jitter;
+        float stride = 1.0f;
+        float prev_val = -1.0f;
+        while (s < steps) {
+            float t = t_hit.x + s * dt;
+            float3 p = transformed_eye + t * ray_dir;
+
+            float t_skip = skip_empty(p, t, transformed_eye, ray_dir);
+            if (t_skip > t) {
+                s = max(floor((t_skip - t_hit.x) / dt - _25_jitter) + _25_jitter, s + 1.0f);
+                stride = 1.0f;
+                prev_val = -1.0f;
+                continue;
+            }
+
+            float val = clamp(sample_volume(p, ray_lod(t, ray_dir)) * _25_value_scale + _25_value_offset, 0.0f, 1.0f);
+
+            bool faint = val <= refine_opacity && abs(val - prev_val) <= refine_opacity;
+            if (stride > min_step && !faint) {
+                s -= stride - min_step;
+                stride = min_step;
+                continue;
+            }
+
+            float4 segment = transfer_segment(prev_val < 0.0f ? val : prev_val, val);
+            float alpha = 1.0f - pow(1.0f - segment.a, stride);
+            float3 color = segment.rgb * (alpha / max(segment.a, 1e-6));
+
+            FragColor.rgb += (1.0f - FragColor.a) * color;
+            FragColor.a += (1.0f - FragColor.a) * alpha;
+
+            if (FragColor.a >= alpha_cutoff) {
                 break;
             }
-            p += (_109 * _150);
+            prev_val = val;
+            stride = faint ? min(stride * 2.0f, max_step) : min_step;
+            s += stride;
         }
-        float param_2 = FragColor.x;
-        FragColor.x = linear_to_srgb(param_2);
-        float param_3 = FragColor.y;
-        FragColor.y = linear_to_srgb(param_3);
-        float param_4 = FragColor.z;
-        FragColor.z = linear_to_srgb(param_4);
+        FragColor.r = linear_to_srgb(FragColor.r);
+        FragColor.g = linear_to_srgb(FragColor.g);
+        FragColor.b = linear_to_srgb(FragColor.b);
     }
 
     SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
     {
+        gl_FragCoord = stage_input.gl_FragCoord;
+        gl_FragCoord.w = 1.0 / gl_FragCoord.w;
         vray_dir = stage_input.vray_dir;
         transformed_eye = stage_input.transformed_eye;
         frag_main();
@@ -597,201 +1032,418 @@ static const uint8_t vs_volume_source_hlsl5[1103] = {
         stage_output.FragColor = FragColor;
         return stage_output;
     }
+
 */
-static const uint8_t fs_volume_source_hlsl5[3074] = {
+static const uint8_t fs_volume_source_hlsl5[6532] = {
     0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x66,0x73,0x5f,0x76,0x6f,0x6c,0x5f,0x70,
     0x61,0x72,0x61,0x6d,0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,
     0x28,0x62,0x30,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x33,0x20,
     0x5f,0x32,0x35,0x5f,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x64,0x69,0x6d,0x73,0x20,
     0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x30,0x29,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x35,0x5f,
-    0x64,0x74,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,
-    0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x30,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x35,0x5f,0x6e,0x65,0x61,0x72,0x5f,
-    0x63,0x6c,0x69,0x70,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,
-    0x74,0x28,0x63,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x20,0x5f,0x32,0x35,0x5f,0x66,0x61,0x72,0x5f,0x63,0x6c,0x69,0x70,0x20,0x3a,0x20,
-    0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x31,0x2e,0x79,0x29,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x32,0x35,
-    0x5f,0x6e,0x65,0x77,0x5f,0x62,0x6f,0x78,0x5f,0x6d,0x69,0x6e,0x20,0x3a,0x20,0x70,
-    0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x32,0x29,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x32,0x35,0x5f,0x6e,0x65,
-    0x77,0x5f,0x62,0x6f,0x78,0x5f,0x6d,0x61,0x78,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,
-    0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x33,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,
-    0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x33,0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,
-    0x3e,0x20,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,
-    0x74,0x65,0x72,0x28,0x74,0x30,0x29,0x3b,0x0a,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,
-    0x53,0x74,0x61,0x74,0x65,0x20,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x73,0x6d,0x70,
-    0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x73,0x30,0x29,0x3b,
-    0x0a,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,
-    0x34,0x3e,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x6d,0x61,0x70,0x20,0x3a,0x20,0x72,0x65,
-    0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x31,0x29,0x3b,0x0a,0x53,0x61,0x6d,0x70,
-    0x6c,0x65,0x72,0x53,0x74,0x61,0x74,0x65,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x6d,0x61,
-    0x70,0x5f,0x73,0x6d,0x70,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,
-    0x28,0x73,0x31,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,
-    0x6f,0x61,0x74,0x33,0x20,0x76,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x3b,0x0a,0x73,
-    0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x74,0x72,0x61,
-    0x6e,0x73,0x66,0x6f,0x72,0x6d,0x65,0x64,0x5f,0x65,0x79,0x65,0x3b,0x0a,0x73,0x74,
-    0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x46,0x72,0x61,0x67,
-    0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,
-    0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,
-    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x72,
-    0x61,0x79,0x5f,0x64,0x69,0x72,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,
-    0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6e,0x6f,0x69,0x6e,0x74,0x65,0x72,0x70,
-    0x6f,0x6c,0x61,0x74,0x69,0x6f,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x74,
-    0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x65,0x64,0x5f,0x65,0x79,0x65,0x20,0x3a,
-    0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,
-    0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,
-    0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,
-    0x20,0x3a,0x20,0x53,0x56,0x5f,0x54,0x61,0x72,0x67,0x65,0x74,0x30,0x3b,0x0a,0x7d,
-    0x3b,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x69,0x6e,0x74,0x65,0x72,0x73,
-    0x65,0x63,0x74,0x5f,0x62,0x6f,0x78,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x6f,
-    0x72,0x69,0x67,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x64,0x69,0x72,0x29,
-    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x33,
-    0x38,0x20,0x3d,0x20,0x31,0x2e,0x30,0x66,0x2e,0x78,0x78,0x78,0x20,0x2f,0x20,0x64,
-    0x69,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,
-    0x34,0x34,0x20,0x3d,0x20,0x28,0x5f,0x32,0x35,0x5f,0x6e,0x65,0x77,0x5f,0x62,0x6f,
-    0x78,0x5f,0x6d,0x69,0x6e,0x20,0x2d,0x20,0x6f,0x72,0x69,0x67,0x29,0x20,0x2a,0x20,
-    0x5f,0x33,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,
-    0x5f,0x35,0x30,0x20,0x3d,0x20,0x28,0x5f,0x32,0x35,0x5f,0x6e,0x65,0x77,0x5f,0x62,
-    0x6f,0x78,0x5f,0x6d,0x61,0x78,0x20,0x2d,0x20,0x6f,0x72,0x69,0x67,0x29,0x20,0x2a,
-    0x20,0x5f,0x33,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
-    0x20,0x5f,0x35,0x34,0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,0x5f,0x34,0x34,0x2c,0x20,
-    0x5f,0x35,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
-    0x20,0x5f,0x35,0x38,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x5f,0x34,0x34,0x2c,0x20,
-    0x5f,0x35,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x6d,0x61,0x78,0x28,0x5f,0x35,0x34,0x2e,
-    0x78,0x2c,0x20,0x6d,0x61,0x78,0x28,0x5f,0x35,0x34,0x2e,0x79,0x2c,0x20,0x5f,0x35,
-    0x34,0x2e,0x7a,0x29,0x29,0x2c,0x20,0x6d,0x69,0x6e,0x28,0x5f,0x35,0x38,0x2e,0x78,
-    0x2c,0x20,0x6d,0x69,0x6e,0x28,0x5f,0x35,0x38,0x2e,0x79,0x2c,0x20,0x5f,0x35,0x38,
-    0x2e,0x7a,0x29,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,
-    0x6c,0x69,0x6e,0x65,0x61,0x72,0x5f,0x74,0x6f,0x5f,0x73,0x72,0x67,0x62,0x28,0x66,
-    0x6c,0x6f,0x61,0x74,0x20,0x78,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,
-    0x20,0x28,0x78,0x20,0x3c,0x3d,0x20,0x30,0x2e,0x30,0x30,0x33,0x31,0x33,0x30,0x38,
-    0x30,0x30,0x30,0x39,0x30,0x37,0x33,0x30,0x31,0x39,0x30,0x32,0x37,0x37,0x30,0x39,
-    0x39,0x36,0x30,0x39,0x33,0x37,0x35,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x31,
-    0x32,0x2e,0x39,0x32,0x30,0x30,0x30,0x30,0x30,0x37,0x36,0x32,0x39,0x33,0x39,0x34,
-    0x35,0x33,0x31,0x32,0x35,0x66,0x20,0x2a,0x20,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x61,0x64,
-    0x28,0x31,0x2e,0x30,0x35,0x34,0x39,0x39,0x39,0x39,0x34,0x37,0x35,0x34,0x37,0x39,
-    0x31,0x32,0x35,0x39,0x37,0x36,0x35,0x36,0x32,0x35,0x66,0x2c,0x20,0x70,0x6f,0x77,
-    0x28,0x78,0x2c,0x20,0x30,0x2e,0x34,0x31,0x36,0x36,0x36,0x36,0x36,0x35,0x36,0x37,
-    0x33,0x32,0x35,0x35,0x39,0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x66,
-    0x29,0x2c,0x20,0x2d,0x30,0x2e,0x30,0x35,0x34,0x39,0x39,0x39,0x39,0x39,0x39,0x37,
-    0x30,0x31,0x39,0x37,0x36,0x37,0x37,0x36,0x31,0x32,0x33,0x30,0x34,0x36,0x38,0x37,
-    0x35,0x66,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x66,0x72,0x61,
-    0x67,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x31,0x30,0x39,0x20,0x3d,0x20,0x6e,0x6f,0x72,
-    0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x76,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x29,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,
-    0x61,0x6d,0x20,0x3d,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x65,0x64,
-    0x5f,0x65,0x79,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
-    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x5f,0x31,0x30,0x39,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x31,0x31,0x37,
-    0x20,0x3d,0x20,0x69,0x6e,0x74,0x65,0x72,0x73,0x65,0x63,0x74,0x5f,0x62,0x6f,0x78,
-    0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x5f,0x68,
-    0x69,0x74,0x20,0x3d,0x20,0x5f,0x31,0x31,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
-    0x66,0x20,0x28,0x5f,0x31,0x31,0x37,0x2e,0x78,0x20,0x3e,0x20,0x5f,0x31,0x31,0x37,
-    0x2e,0x79,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
-    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x32,0x37,0x34,
-    0x20,0x3d,0x20,0x74,0x5f,0x68,0x69,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
-    0x6f,0x61,0x74,0x20,0x5f,0x31,0x32,0x39,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x5f,
-    0x32,0x37,0x34,0x2e,0x78,0x2c,0x20,0x30,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x32,0x37,0x36,0x20,0x3d,0x20,
-    0x5f,0x32,0x37,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x32,0x37,0x36,0x2e,0x78,
-    0x20,0x3d,0x20,0x5f,0x31,0x32,0x39,0x3b,0x0a,0x20,0x20,0x20,0x20,0x74,0x5f,0x68,
-    0x69,0x74,0x20,0x3d,0x20,0x5f,0x32,0x37,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x31,0x34,0x31,0x20,0x3d,0x20,0x31,0x2e,0x30,
-    0x66,0x2e,0x78,0x78,0x78,0x20,0x2f,0x20,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x32,0x35,0x5f,0x62,0x72,
+    0x69,0x63,0x6b,0x65,0x64,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,
+    0x65,0x74,0x28,0x63,0x30,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,
+    0x74,0x20,0x5f,0x32,0x35,0x5f,0x62,0x72,0x69,0x63,0x6b,0x5f,0x73,0x69,0x7a,0x65,
+    0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x31,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x32,
+    0x35,0x5f,0x6e,0x65,0x77,0x5f,0x62,0x6f,0x78,0x5f,0x6d,0x69,0x6e,0x20,0x3a,0x20,
+    0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x32,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x32,0x35,0x5f,0x6e,
+    0x65,0x77,0x5f,0x62,0x6f,0x78,0x5f,0x6d,0x61,0x78,0x20,0x3a,0x20,0x70,0x61,0x63,
+    0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x33,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x35,0x5f,0x6c,0x6f,0x64,0x5f,0x73,
+    0x63,0x61,0x6c,0x65,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,
+    0x74,0x28,0x63,0x33,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x20,0x5f,0x32,0x35,0x5f,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x65,
+    0x78,0x74,0x65,0x6e,0x74,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,
+    0x65,0x74,0x28,0x63,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x5f,0x32,0x35,0x5f,0x6d,0x61,0x78,0x5f,0x6c,0x6f,0x64,0x20,0x3a,0x20,
+    0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x34,0x2e,0x77,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x33,0x20,0x5f,0x32,0x35,0x5f,0x63,
+    0x65,0x6c,0x6c,0x5f,0x64,0x69,0x6d,0x73,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,
+    0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x6e,0x74,0x20,0x5f,0x32,0x35,0x5f,0x63,0x65,0x6c,0x6c,0x5f,0x73,0x69,0x7a,0x65,
+    0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x35,
+    0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,
+    0x32,0x35,0x5f,0x76,0x61,0x6c,0x75,0x65,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x3a,
+    0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x36,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x35,0x5f,0x76,
+    0x61,0x6c,0x75,0x65,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x3a,0x20,0x70,0x61,
+    0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x36,0x2e,0x79,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x32,0x35,0x5f,0x6d,
+    0x61,0x72,0x63,0x68,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,
+    0x74,0x28,0x63,0x37,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x5f,0x32,0x35,0x5f,0x6a,0x69,0x74,0x74,0x65,0x72,0x20,0x3a,0x20,0x70,0x61,
+    0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x38,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x32,0x35,0x5f,0x73,0x63,0x65,
+    0x6e,0x65,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,
+    0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x38,0x2e,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x6e,0x74,0x32,0x20,0x5f,0x32,0x35,0x5f,0x73,0x63,0x65,0x6e,0x65,0x5f,
+    0x73,0x69,0x7a,0x65,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,
+    0x74,0x28,0x63,0x39,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x0a,0x54,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x33,0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,0x3e,0x20,0x76,0x6f,
+    0x6c,0x75,0x6d,0x65,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,
+    0x74,0x30,0x29,0x3b,0x0a,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x53,0x74,0x61,0x74,
+    0x65,0x20,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x73,0x6d,0x70,0x20,0x3a,0x20,0x72,
+    0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x73,0x30,0x29,0x3b,0x0a,0x54,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,0x3e,0x20,0x74,
+    0x72,0x61,0x6e,0x73,0x66,0x65,0x72,0x5f,0x74,0x61,0x62,0x6c,0x65,0x20,0x3a,0x20,
+    0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x31,0x29,0x3b,0x0a,0x53,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x53,0x74,0x61,0x74,0x65,0x20,0x74,0x72,0x61,0x6e,0x73,
+    0x66,0x65,0x72,0x5f,0x73,0x6d,0x70,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,
+    0x65,0x72,0x28,0x73,0x31,0x29,0x3b,0x0a,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x33,
+    0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,0x3e,0x20,0x62,0x72,0x69,0x63,0x6b,0x5f,
+    0x74,0x61,0x62,0x6c,0x65,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,
+    0x28,0x74,0x32,0x29,0x3b,0x0a,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x33,0x44,0x3c,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x3e,0x20,0x62,0x72,0x69,0x63,0x6b,0x5f,0x61,0x74,
+    0x6c,0x61,0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,
+    0x33,0x29,0x3b,0x0a,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x33,0x44,0x3c,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x3e,0x20,0x6f,0x63,0x63,0x75,0x70,0x61,0x6e,0x63,0x79,0x20,
+    0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x34,0x29,0x3b,0x0a,
+    0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x3e,0x20,0x73,0x63,0x65,0x6e,0x65,0x5f,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,
+    0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x35,0x29,0x3b,
+    0x0a,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x53,0x74,0x61,0x74,0x65,0x20,0x73,0x63,
+    0x65,0x6e,0x65,0x5f,0x73,0x6d,0x70,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,
+    0x65,0x72,0x28,0x73,0x32,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,
+    0x6f,0x72,0x64,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x76,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x3b,0x0a,0x73,0x74,0x61,
+    0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x74,0x72,0x61,0x6e,0x73,
+    0x66,0x6f,0x72,0x6d,0x65,0x64,0x5f,0x65,0x79,0x65,0x3b,0x0a,0x73,0x74,0x61,0x74,
+    0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,
+    0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,
+    0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x72,0x61,0x79,
+    0x5f,0x64,0x69,0x72,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x6e,0x6f,0x69,0x6e,0x74,0x65,0x72,0x70,0x6f,0x6c,
+    0x61,0x74,0x69,0x6f,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x74,0x72,0x61,
+    0x6e,0x73,0x66,0x6f,0x72,0x6d,0x65,0x64,0x5f,0x65,0x79,0x65,0x20,0x3a,0x20,0x54,
+    0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6f,0x72,
+    0x64,0x20,0x3a,0x20,0x53,0x56,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,
+    0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,
+    0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x46,0x72,0x61,0x67,
+    0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x53,0x56,0x5f,0x54,0x61,0x72,0x67,0x65,
+    0x74,0x30,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x69,
+    0x6e,0x74,0x65,0x72,0x73,0x65,0x63,0x74,0x5f,0x62,0x6f,0x78,0x28,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x20,0x6f,0x72,0x69,0x67,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x64,0x69,0x72,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x62,0x6f,0x78,0x5f,0x6d,0x69,0x6e,0x20,0x3d,0x20,0x5f,0x32,0x35,
+    0x5f,0x6e,0x65,0x77,0x5f,0x62,0x6f,0x78,0x5f,0x6d,0x69,0x6e,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x62,0x6f,0x78,0x5f,0x6d,0x61,0x78,
+    0x20,0x3d,0x20,0x5f,0x32,0x35,0x5f,0x6e,0x65,0x77,0x5f,0x62,0x6f,0x78,0x5f,0x6d,
+    0x61,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x69,
+    0x6e,0x76,0x5f,0x64,0x69,0x72,0x20,0x3d,0x20,0x31,0x2e,0x30,0x66,0x20,0x2f,0x20,
+    0x64,0x69,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,
+    0x74,0x6d,0x69,0x6e,0x5f,0x74,0x6d,0x70,0x20,0x3d,0x20,0x28,0x62,0x6f,0x78,0x5f,
+    0x6d,0x69,0x6e,0x20,0x2d,0x20,0x6f,0x72,0x69,0x67,0x29,0x20,0x2a,0x20,0x69,0x6e,
+    0x76,0x5f,0x64,0x69,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x74,0x6d,0x61,0x78,0x5f,0x74,0x6d,0x70,0x20,0x3d,0x20,0x28,0x62,0x6f,
+    0x78,0x5f,0x6d,0x61,0x78,0x20,0x2d,0x20,0x6f,0x72,0x69,0x67,0x29,0x20,0x2a,0x20,
+    0x69,0x6e,0x76,0x5f,0x64,0x69,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x20,0x74,0x6d,0x69,0x6e,0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,0x74,
+    0x6d,0x69,0x6e,0x5f,0x74,0x6d,0x70,0x2c,0x20,0x74,0x6d,0x61,0x78,0x5f,0x74,0x6d,
+    0x70,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x74,
+    0x6d,0x61,0x78,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x74,0x6d,0x69,0x6e,0x5f,0x74,
+    0x6d,0x70,0x2c,0x20,0x74,0x6d,0x61,0x78,0x5f,0x74,0x6d,0x70,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x30,0x20,0x3d,0x20,0x6d,0x61,
+    0x78,0x28,0x74,0x6d,0x69,0x6e,0x2e,0x78,0x2c,0x20,0x6d,0x61,0x78,0x28,0x74,0x6d,
+    0x69,0x6e,0x2e,0x79,0x2c,0x20,0x74,0x6d,0x69,0x6e,0x2e,0x7a,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x31,0x20,0x3d,0x20,0x6d,
+    0x69,0x6e,0x28,0x74,0x6d,0x61,0x78,0x2e,0x78,0x2c,0x20,0x6d,0x69,0x6e,0x28,0x74,
+    0x6d,0x61,0x78,0x2e,0x79,0x2c,0x20,0x74,0x6d,0x61,0x78,0x2e,0x7a,0x29,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x28,0x74,0x30,0x2c,0x20,0x74,0x31,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x72,0x61,0x79,0x5f,0x6c,0x6f,0x64,0x28,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x74,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x72,0x61,0x79,
+    0x5f,0x64,0x69,0x72,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x72,0x61,0x79,0x5f,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x20,0x3d,
+    0x20,0x74,0x20,0x2a,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x72,0x61,0x79,0x5f,
+    0x64,0x69,0x72,0x20,0x2a,0x20,0x5f,0x32,0x35,0x5f,0x76,0x6f,0x6c,0x75,0x6d,0x65,
+    0x5f,0x65,0x78,0x74,0x65,0x6e,0x74,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x6c,0x6f,0x67,0x32,0x28,
+    0x6d,0x61,0x78,0x28,0x72,0x61,0x79,0x5f,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,
+    0x20,0x2a,0x20,0x5f,0x32,0x35,0x5f,0x6c,0x6f,0x64,0x5f,0x73,0x63,0x61,0x6c,0x65,
+    0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x2c,0x20,
+    0x5f,0x32,0x35,0x5f,0x6d,0x61,0x78,0x5f,0x6c,0x6f,0x64,0x29,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x5f,0x76,0x6f,
+    0x6c,0x75,0x6d,0x65,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x2c,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x6c,0x6f,0x64,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x5f,0x32,0x35,0x5f,0x62,0x72,0x69,0x63,0x6b,0x65,0x64,0x20,
+    0x3d,0x3d,0x20,0x30,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x2e,0x53,0x61,
+    0x6d,0x70,0x6c,0x65,0x4c,0x65,0x76,0x65,0x6c,0x28,0x76,0x6f,0x6c,0x75,0x6d,0x65,
+    0x5f,0x73,0x6d,0x70,0x2c,0x20,0x70,0x2c,0x20,0x6c,0x6f,0x64,0x29,0x2e,0x72,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x33,0x20,
+    0x76,0x6f,0x78,0x65,0x6c,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,0x28,
+    0x69,0x6e,0x74,0x33,0x29,0x28,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x70,0x20,0x2a,0x20,
+    0x28,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x29,0x28,0x5f,0x32,0x35,0x5f,0x76,0x6f,
+    0x6c,0x75,0x6d,0x65,0x5f,0x64,0x69,0x6d,0x73,0x29,0x29,0x29,0x29,0x29,0x2c,0x20,
+    0x69,0x6e,0x74,0x33,0x28,0x30,0x2c,0x20,0x30,0x2c,0x20,0x30,0x29,0x2c,0x20,0x5f,
+    0x32,0x35,0x5f,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x64,0x69,0x6d,0x73,0x20,0x2d,
+    0x20,0x69,0x6e,0x74,0x33,0x28,0x31,0x2c,0x20,0x31,0x2c,0x20,0x31,0x29,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x65,0x6e,0x74,0x72,
+    0x79,0x20,0x3d,0x20,0x62,0x72,0x69,0x63,0x6b,0x5f,0x74,0x61,0x62,0x6c,0x65,0x2e,
+    0x4c,0x6f,0x61,0x64,0x28,0x69,0x6e,0x74,0x34,0x28,0x76,0x6f,0x78,0x65,0x6c,0x20,
+    0x2f,0x20,0x5f,0x32,0x35,0x5f,0x62,0x72,0x69,0x63,0x6b,0x5f,0x73,0x69,0x7a,0x65,
+    0x2c,0x20,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x62,
+    0x72,0x69,0x63,0x6b,0x5f,0x6c,0x65,0x76,0x65,0x6c,0x20,0x3d,0x20,0x69,0x6e,0x74,
+    0x28,0x65,0x6e,0x74,0x72,0x79,0x2e,0x61,0x20,0x2a,0x20,0x32,0x35,0x35,0x2e,0x30,
+    0x66,0x20,0x2b,0x20,0x30,0x2e,0x35,0x66,0x29,0x20,0x2d,0x20,0x31,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x62,0x72,0x69,0x63,0x6b,0x5f,0x6c,0x65,0x76,
+    0x65,0x6c,0x20,0x3c,0x20,0x30,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x2e,0x30,0x66,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x33,0x20,0x63,0x6f,
+    0x61,0x72,0x73,0x65,0x20,0x3d,0x20,0x76,0x6f,0x78,0x65,0x6c,0x20,0x3e,0x3e,0x20,
+    0x62,0x72,0x69,0x63,0x6b,0x5f,0x6c,0x65,0x76,0x65,0x6c,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x6e,0x74,0x33,0x20,0x73,0x6c,0x6f,0x74,0x20,0x3d,0x20,0x28,0x28,0x69,
+    0x6e,0x74,0x33,0x29,0x28,0x65,0x6e,0x74,0x72,0x79,0x2e,0x72,0x67,0x62,0x20,0x2a,
+    0x20,0x32,0x35,0x35,0x2e,0x30,0x66,0x20,0x2b,0x20,0x30,0x2e,0x35,0x66,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x62,0x72,0x69,
+    0x63,0x6b,0x5f,0x61,0x74,0x6c,0x61,0x73,0x2e,0x4c,0x6f,0x61,0x64,0x28,0x69,0x6e,
+    0x74,0x34,0x28,0x73,0x6c,0x6f,0x74,0x20,0x2a,0x20,0x5f,0x32,0x35,0x5f,0x62,0x72,
+    0x69,0x63,0x6b,0x5f,0x73,0x69,0x7a,0x65,0x20,0x2b,0x20,0x28,0x63,0x6f,0x61,0x72,
+    0x73,0x65,0x20,0x2d,0x20,0x28,0x63,0x6f,0x61,0x72,0x73,0x65,0x20,0x2f,0x20,0x5f,
+    0x32,0x35,0x5f,0x62,0x72,0x69,0x63,0x6b,0x5f,0x73,0x69,0x7a,0x65,0x29,0x20,0x2a,
+    0x20,0x5f,0x32,0x35,0x5f,0x62,0x72,0x69,0x63,0x6b,0x5f,0x73,0x69,0x7a,0x65,0x29,
+    0x2c,0x20,0x30,0x29,0x29,0x2e,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x73,0x6b,0x69,0x70,0x5f,0x65,0x6d,0x70,0x74,0x79,0x28,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x20,0x70,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x2c,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x65,0x79,0x65,0x2c,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x29,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x63,0x65,0x6c,0x6c,0x5f,0x73,0x63,
+    0x61,0x6c,0x65,0x20,0x3d,0x20,0x28,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x29,0x28,
     0x5f,0x32,0x35,0x5f,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x64,0x69,0x6d,0x73,0x29,
-    0x20,0x2a,0x20,0x61,0x62,0x73,0x28,0x5f,0x31,0x30,0x39,0x29,0x29,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x35,0x30,0x20,0x3d,0x20,
-    0x6d,0x69,0x6e,0x28,0x5f,0x31,0x34,0x31,0x2e,0x78,0x2c,0x20,0x6d,0x69,0x6e,0x28,
-    0x5f,0x31,0x34,0x31,0x2e,0x79,0x2c,0x20,0x5f,0x31,0x34,0x31,0x2e,0x7a,0x29,0x29,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,
-    0x3d,0x20,0x30,0x2e,0x30,0x66,0x2e,0x78,0x78,0x78,0x78,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x20,0x3d,0x20,0x74,0x72,0x61,0x6e,
-    0x73,0x66,0x6f,0x72,0x6d,0x65,0x64,0x5f,0x65,0x79,0x65,0x20,0x2b,0x20,0x28,0x5f,
-    0x31,0x30,0x39,0x20,0x2a,0x20,0x5f,0x31,0x32,0x39,0x29,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x6f,0x72,0x20,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x20,0x3d,0x20,
-    0x5f,0x31,0x32,0x39,0x3b,0x20,0x74,0x20,0x3c,0x20,0x74,0x5f,0x68,0x69,0x74,0x2e,
-    0x79,0x3b,0x20,0x74,0x20,0x2b,0x3d,0x20,0x5f,0x31,0x35,0x30,0x29,0x0a,0x20,0x20,
-    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x34,0x20,0x5f,0x31,0x38,0x36,0x20,0x3d,0x20,0x76,0x6f,0x6c,0x75,0x6d,0x65,
-    0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x73,
-    0x6d,0x70,0x2c,0x20,0x70,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x38,0x37,0x20,0x3d,0x20,0x5f,0x31,0x38,
-    0x36,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x20,0x5f,0x32,0x31,0x35,0x20,0x3d,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,
-    0x6c,0x6f,0x72,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x32,0x32,0x33,0x20,0x3d,0x20,0x46,0x72,0x61,
-    0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x32,0x32,0x35,0x20,0x3d,0x20,0x5f,0x32,
-    0x32,0x33,0x2e,0x78,0x79,0x7a,0x20,0x2b,0x20,0x28,0x66,0x6c,0x6f,0x61,0x74,0x34,
-    0x28,0x63,0x6f,0x6c,0x6f,0x72,0x6d,0x61,0x70,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,
-    0x28,0x63,0x6f,0x6c,0x6f,0x72,0x6d,0x61,0x70,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x32,0x28,0x6d,0x61,0x64,0x28,0x5f,0x31,0x38,0x37,0x2c,0x20,
-    0x30,0x2e,0x39,0x39,0x39,0x30,0x30,0x30,0x30,0x31,0x32,0x38,0x37,0x34,0x36,0x30,
-    0x33,0x32,0x37,0x31,0x34,0x38,0x34,0x33,0x37,0x35,0x66,0x2c,0x20,0x30,0x2e,0x30,
-    0x30,0x30,0x35,0x30,0x30,0x30,0x30,0x30,0x30,0x32,0x33,0x37,0x34,0x38,0x37,0x32,
-    0x35,0x36,0x35,0x32,0x36,0x39,0x34,0x37,0x30,0x32,0x31,0x34,0x38,0x34,0x33,0x37,
-    0x35,0x66,0x29,0x2c,0x20,0x30,0x2e,0x35,0x66,0x29,0x29,0x2e,0x78,0x79,0x7a,0x2c,
-    0x20,0x5f,0x31,0x38,0x37,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x28,0x28,0x31,
-    0x2e,0x30,0x66,0x20,0x2d,0x20,0x5f,0x32,0x31,0x35,0x29,0x20,0x2a,0x20,0x5f,0x31,
-    0x38,0x37,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x46,0x72,
-    0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x78,0x20,0x3d,0x20,0x5f,0x32,0x32,0x35,
-    0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,
-    0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x79,0x20,0x3d,0x20,0x5f,0x32,0x32,0x35,0x2e,0x79,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,
-    0x6c,0x6f,0x72,0x2e,0x7a,0x20,0x3d,0x20,0x5f,0x32,0x32,0x35,0x2e,0x7a,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,
-    0x72,0x2e,0x77,0x20,0x3d,0x20,0x6d,0x61,0x64,0x28,0x31,0x2e,0x30,0x66,0x20,0x2d,
-    0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x77,0x2c,0x20,0x5f,0x31,
-    0x38,0x37,0x2c,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x77,0x29,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x46,0x72,
-    0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x77,0x20,0x3e,0x3d,0x20,0x30,0x2e,0x39,
-    0x38,0x30,0x30,0x30,0x30,0x30,0x31,0x39,0x30,0x37,0x33,0x34,0x38,0x36,0x33,0x32,
-    0x38,0x31,0x32,0x35,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x72,0x65,
-    0x61,0x6b,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x20,0x2b,0x3d,0x20,0x28,0x5f,0x31,0x30,0x39,
-    0x20,0x2a,0x20,0x5f,0x31,0x35,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x32,0x20,0x3d,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x78,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x78,
+    0x29,0x20,0x2f,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x5f,0x32,0x35,0x5f,0x63,0x65,
+    0x6c,0x6c,0x5f,0x73,0x69,0x7a,0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,
+    0x74,0x33,0x20,0x63,0x65,0x6c,0x6c,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,
+    0x28,0x28,0x69,0x6e,0x74,0x33,0x29,0x28,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x70,0x20,
+    0x2a,0x20,0x63,0x65,0x6c,0x6c,0x5f,0x73,0x63,0x61,0x6c,0x65,0x29,0x29,0x29,0x2c,
+    0x20,0x69,0x6e,0x74,0x33,0x28,0x30,0x2c,0x20,0x30,0x2c,0x20,0x30,0x29,0x2c,0x20,
+    0x5f,0x32,0x35,0x5f,0x63,0x65,0x6c,0x6c,0x5f,0x64,0x69,0x6d,0x73,0x20,0x2d,0x20,
+    0x69,0x6e,0x74,0x33,0x28,0x31,0x2c,0x20,0x31,0x2c,0x20,0x31,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6f,0x63,0x63,0x75,0x70,0x61,0x6e,0x63,
+    0x79,0x2e,0x4c,0x6f,0x61,0x64,0x28,0x69,0x6e,0x74,0x34,0x28,0x63,0x65,0x6c,0x6c,
+    0x2c,0x20,0x30,0x29,0x29,0x2e,0x72,0x20,0x3e,0x20,0x30,0x2e,0x30,0x66,0x29,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x65,0x78,0x69,0x74,0x5f,0x66,0x61,0x63,0x65,0x20,0x3d,
+    0x20,0x28,0x28,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x29,0x28,0x63,0x65,0x6c,0x6c,
+    0x29,0x29,0x20,0x2b,0x20,0x73,0x74,0x65,0x70,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x28,0x30,0x2e,0x30,0x66,0x2c,0x20,0x30,0x2e,0x30,0x66,0x2c,0x20,0x30,0x2e,0x30,
+    0x66,0x29,0x2c,0x20,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x29,0x29,0x20,0x2f,0x20,
+    0x63,0x65,0x6c,0x6c,0x5f,0x73,0x63,0x61,0x6c,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x74,0x5f,0x65,0x78,0x69,0x74,0x20,0x3d,0x20,
+    0x28,0x65,0x78,0x69,0x74,0x5f,0x66,0x61,0x63,0x65,0x20,0x2d,0x20,0x65,0x79,0x65,
+    0x29,0x20,0x2f,0x20,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x69,0x6e,0x28,0x74,0x5f,0x65,0x78,
+    0x69,0x74,0x2e,0x78,0x2c,0x20,0x6d,0x69,0x6e,0x28,0x74,0x5f,0x65,0x78,0x69,0x74,
+    0x2e,0x79,0x2c,0x20,0x74,0x5f,0x65,0x78,0x69,0x74,0x2e,0x7a,0x29,0x29,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,
+    0x65,0x72,0x5f,0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x28,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x66,0x72,0x6f,0x6e,0x74,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x62,0x61,
+    0x63,0x6b,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x65,0x72,0x5f,0x74,0x61,0x62,0x6c,0x65,0x2e,
+    0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x74,0x72,0x61,0x6e,0x73,0x66,0x65,0x72,0x5f,
+    0x73,0x6d,0x70,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x66,0x72,0x6f,0x6e,
+    0x74,0x2c,0x20,0x62,0x61,0x63,0x6b,0x29,0x20,0x2a,0x20,0x28,0x32,0x35,0x35,0x2e,
+    0x30,0x66,0x20,0x2f,0x20,0x32,0x35,0x36,0x2e,0x30,0x66,0x29,0x20,0x2b,0x20,0x30,
+    0x2e,0x35,0x66,0x20,0x2f,0x20,0x32,0x35,0x36,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x77,0x61,0x6e,0x67,0x5f,0x68,0x61,0x73,
+    0x68,0x28,0x69,0x6e,0x74,0x20,0x73,0x65,0x65,0x64,0x29,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x73,0x65,0x65,0x64,0x20,0x3d,0x20,0x28,0x73,0x65,0x65,0x64,0x20,0x5e,
+    0x20,0x36,0x31,0x29,0x20,0x5e,0x20,0x28,0x73,0x65,0x65,0x64,0x20,0x3e,0x3e,0x20,
+    0x31,0x36,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x65,0x65,0x64,0x20,0x2a,0x3d,
+    0x20,0x39,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x65,0x65,0x64,0x20,0x3d,0x20,0x73,
+    0x65,0x65,0x64,0x20,0x5e,0x20,0x28,0x73,0x65,0x65,0x64,0x20,0x3e,0x3e,0x20,0x34,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x65,0x65,0x64,0x20,0x2a,0x3d,0x20,0x30,
+    0x78,0x32,0x37,0x64,0x34,0x65,0x62,0x32,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,
+    0x65,0x65,0x64,0x20,0x3d,0x20,0x73,0x65,0x65,0x64,0x20,0x5e,0x20,0x28,0x73,0x65,
+    0x65,0x64,0x20,0x3e,0x3e,0x20,0x31,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x73,0x65,0x65,0x64,
+    0x20,0x25,0x20,0x32,0x31,0x34,0x37,0x34,0x38,0x33,0x36,0x34,0x37,0x29,0x20,0x2f,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x32,0x31,0x34,0x37,0x34,0x38,0x33,0x36,0x34,
+    0x37,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6c,0x69,0x6e,
+    0x65,0x61,0x72,0x5f,0x74,0x6f,0x5f,0x73,0x72,0x67,0x62,0x28,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x78,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x78,
+    0x20,0x3c,0x3d,0x20,0x30,0x2e,0x30,0x30,0x33,0x31,0x33,0x30,0x38,0x66,0x29,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x31,0x32,0x2e,0x39,0x32,0x66,0x20,0x2a,0x20,0x78,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x31,0x2e,
+    0x30,0x35,0x35,0x66,0x20,0x2a,0x20,0x70,0x6f,0x77,0x28,0x78,0x2c,0x20,0x31,0x2e,
+    0x66,0x20,0x2f,0x20,0x32,0x2e,0x34,0x66,0x29,0x20,0x2d,0x20,0x30,0x2e,0x30,0x35,
+    0x35,0x66,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x66,0x72,0x61,0x67,
+    0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x20,0x3d,0x20,0x6e,
+    0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x76,0x72,0x61,0x79,0x5f,0x64,0x69,
+    0x72,0x29,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x74,0x5f,0x68,0x69,0x74,0x20,0x3d,0x20,0x69,0x6e,0x74,0x65,0x72,0x73,0x65,0x63,
+    0x74,0x5f,0x62,0x6f,0x78,0x28,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x65,
+    0x64,0x5f,0x65,0x79,0x65,0x2c,0x20,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x5f,0x68,0x69,0x74,0x2e,0x78,
+    0x20,0x3e,0x20,0x74,0x5f,0x68,0x69,0x74,0x2e,0x79,0x29,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x74,0x5f,0x68,0x69,0x74,0x2e,0x78,
+    0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x74,0x5f,0x68,0x69,0x74,0x2e,0x78,0x2c,0x20,
+    0x30,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x32,
+    0x20,0x73,0x63,0x65,0x6e,0x65,0x5f,0x70,0x69,0x78,0x65,0x6c,0x20,0x3d,0x20,0x6d,
+    0x69,0x6e,0x28,0x28,0x28,0x69,0x6e,0x74,0x32,0x29,0x28,0x67,0x6c,0x5f,0x46,0x72,
+    0x61,0x67,0x43,0x6f,0x6f,0x72,0x64,0x2e,0x78,0x79,0x20,0x2a,0x20,0x5f,0x32,0x35,
+    0x5f,0x73,0x63,0x65,0x6e,0x65,0x5f,0x73,0x63,0x61,0x6c,0x65,0x29,0x29,0x2c,0x20,
+    0x5f,0x32,0x35,0x5f,0x73,0x63,0x65,0x6e,0x65,0x5f,0x73,0x69,0x7a,0x65,0x20,0x2d,
+    0x20,0x69,0x6e,0x74,0x32,0x28,0x31,0x2c,0x20,0x31,0x29,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6d,0x65,0x73,0x68,0x5f,0x64,0x69,0x73,
+    0x74,0x61,0x6e,0x63,0x65,0x20,0x3d,0x20,0x73,0x63,0x65,0x6e,0x65,0x5f,0x64,0x69,
+    0x73,0x74,0x61,0x6e,0x63,0x65,0x2e,0x4c,0x6f,0x61,0x64,0x28,0x69,0x6e,0x74,0x33,
+    0x28,0x73,0x63,0x65,0x6e,0x65,0x5f,0x70,0x69,0x78,0x65,0x6c,0x2c,0x20,0x30,0x29,
+    0x29,0x2e,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x74,0x5f,0x68,0x69,0x74,0x2e,0x79,
+    0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,0x74,0x5f,0x68,0x69,0x74,0x2e,0x79,0x2c,0x20,
+    0x6d,0x65,0x73,0x68,0x5f,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x20,0x2f,0x20,
+    0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x20,0x2a,
+    0x20,0x5f,0x32,0x35,0x5f,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x65,0x78,0x74,0x65,
+    0x6e,0x74,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x5f,
+    0x68,0x69,0x74,0x2e,0x78,0x20,0x3e,0x3d,0x20,0x74,0x5f,0x68,0x69,0x74,0x2e,0x79,
+    0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x69,0x73,0x63,
+    0x61,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x64,0x74,0x5f,0x76,0x65,0x63,0x20,0x3d,0x20,
+    0x31,0x2e,0x30,0x66,0x20,0x2f,0x20,0x28,0x28,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x29,0x28,0x5f,0x32,0x35,0x5f,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x64,0x69,0x6d,
+    0x73,0x29,0x29,0x20,0x2a,0x20,0x61,0x62,0x73,0x28,0x72,0x61,0x79,0x5f,0x64,0x69,
+    0x72,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,
+    0x74,0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,0x64,0x74,0x5f,0x76,0x65,0x63,0x2e,0x78,
+    0x2c,0x20,0x6d,0x69,0x6e,0x28,0x64,0x74,0x5f,0x76,0x65,0x63,0x2e,0x79,0x2c,0x20,
+    0x64,0x74,0x5f,0x76,0x65,0x63,0x2e,0x7a,0x29,0x29,0x3b,0x0a,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6d,0x69,0x6e,0x5f,0x73,0x74,0x65,0x70,0x20,
+    0x3d,0x20,0x5f,0x32,0x35,0x5f,0x6d,0x61,0x72,0x63,0x68,0x2e,0x78,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6d,0x61,0x78,0x5f,0x73,0x74,0x65,
+    0x70,0x20,0x3d,0x20,0x5f,0x32,0x35,0x5f,0x6d,0x61,0x72,0x63,0x68,0x2e,0x79,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x65,0x66,0x69,0x6e,
+    0x65,0x5f,0x6f,0x70,0x61,0x63,0x69,0x74,0x79,0x20,0x3d,0x20,0x5f,0x32,0x35,0x5f,
+    0x6d,0x61,0x72,0x63,0x68,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x61,0x6c,0x70,0x68,0x61,0x5f,0x63,0x75,0x74,0x6f,0x66,0x66,0x20,
+    0x3d,0x20,0x5f,0x32,0x35,0x5f,0x6d,0x61,0x72,0x63,0x68,0x2e,0x77,0x3b,0x0a,0x0a,
+    0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x30,0x2e,0x30,0x66,0x2c,0x20,0x30,0x2e,0x30,
+    0x66,0x2c,0x20,0x30,0x2e,0x30,0x66,0x2c,0x20,0x30,0x2e,0x30,0x66,0x29,0x3b,0x0a,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x74,0x65,0x70,0x73,
+    0x20,0x3d,0x20,0x28,0x74,0x5f,0x68,0x69,0x74,0x2e,0x79,0x20,0x2d,0x20,0x74,0x5f,
+    0x68,0x69,0x74,0x2e,0x78,0x29,0x20,0x2f,0x20,0x64,0x74,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x20,0x3d,0x20,0x5f,0x32,0x35,0x5f,0x6a,
+    0x69,0x74,0x74,0x65,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x73,0x74,0x72,0x69,0x64,0x65,0x20,0x3d,0x20,0x31,0x2e,0x30,0x66,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x72,0x65,0x76,0x5f,0x76,
+    0x61,0x6c,0x20,0x3d,0x20,0x2d,0x31,0x2e,0x30,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x73,0x20,0x3c,0x20,0x73,0x74,0x65,0x70,0x73,
+    0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x74,0x20,0x3d,0x20,0x74,0x5f,0x68,0x69,0x74,0x2e,0x78,0x20,0x2b,0x20,
+    0x73,0x20,0x2a,0x20,0x64,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x20,0x3d,0x20,0x74,0x72,0x61,0x6e,0x73,
+    0x66,0x6f,0x72,0x6d,0x65,0x64,0x5f,0x65,0x79,0x65,0x20,0x2b,0x20,0x74,0x20,0x2a,
+    0x20,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x5f,0x73,0x6b,0x69,0x70,0x20,
+    0x3d,0x20,0x73,0x6b,0x69,0x70,0x5f,0x65,0x6d,0x70,0x74,0x79,0x28,0x70,0x2c,0x20,
+    0x74,0x2c,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x65,0x64,0x5f,0x65,
+    0x79,0x65,0x2c,0x20,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x5f,0x73,0x6b,0x69,0x70,
+    0x20,0x3e,0x20,0x74,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x73,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x66,0x6c,0x6f,0x6f,
+    0x72,0x28,0x28,0x74,0x5f,0x73,0x6b,0x69,0x70,0x20,0x2d,0x20,0x74,0x5f,0x68,0x69,
+    0x74,0x2e,0x78,0x29,0x20,0x2f,0x20,0x64,0x74,0x20,0x2d,0x20,0x5f,0x32,0x35,0x5f,
+    0x6a,0x69,0x74,0x74,0x65,0x72,0x29,0x20,0x2b,0x20,0x5f,0x32,0x35,0x5f,0x6a,0x69,
+    0x74,0x74,0x65,0x72,0x2c,0x20,0x73,0x20,0x2b,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x74,0x72,
+    0x69,0x64,0x65,0x20,0x3d,0x20,0x31,0x2e,0x30,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x65,0x76,0x5f,0x76,0x61,0x6c,
+    0x20,0x3d,0x20,0x2d,0x31,0x2e,0x30,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x61,0x6c,0x20,0x3d,0x20,0x63,
+    0x6c,0x61,0x6d,0x70,0x28,0x73,0x61,0x6d,0x70,0x6c,0x65,0x5f,0x76,0x6f,0x6c,0x75,
+    0x6d,0x65,0x28,0x70,0x2c,0x20,0x72,0x61,0x79,0x5f,0x6c,0x6f,0x64,0x28,0x74,0x2c,
+    0x20,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x29,0x29,0x20,0x2a,0x20,0x5f,0x32,0x35,
+    0x5f,0x76,0x61,0x6c,0x75,0x65,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x2b,0x20,0x5f,
+    0x32,0x35,0x5f,0x76,0x61,0x6c,0x75,0x65,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x2c,
+    0x20,0x30,0x2e,0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x66,0x61,0x69,0x6e,
+    0x74,0x20,0x3d,0x20,0x76,0x61,0x6c,0x20,0x3c,0x3d,0x20,0x72,0x65,0x66,0x69,0x6e,
+    0x65,0x5f,0x6f,0x70,0x61,0x63,0x69,0x74,0x79,0x20,0x26,0x26,0x20,0x61,0x62,0x73,
+    0x28,0x76,0x61,0x6c,0x20,0x2d,0x20,0x70,0x72,0x65,0x76,0x5f,0x76,0x61,0x6c,0x29,
+    0x20,0x3c,0x3d,0x20,0x72,0x65,0x66,0x69,0x6e,0x65,0x5f,0x6f,0x70,0x61,0x63,0x69,
+    0x74,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x73,0x74,0x72,0x69,0x64,0x65,0x20,0x3e,0x20,0x6d,0x69,0x6e,0x5f,0x73,0x74,0x65,
+    0x70,0x20,0x26,0x26,0x20,0x21,0x66,0x61,0x69,0x6e,0x74,0x29,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x20,0x2d,0x3d,0x20,
+    0x73,0x74,0x72,0x69,0x64,0x65,0x20,0x2d,0x20,0x6d,0x69,0x6e,0x5f,0x73,0x74,0x65,
+    0x70,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,
+    0x74,0x72,0x69,0x64,0x65,0x20,0x3d,0x20,0x6d,0x69,0x6e,0x5f,0x73,0x74,0x65,0x70,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,
+    0x6e,0x74,0x69,0x6e,0x75,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x20,0x3d,0x20,0x74,0x72,0x61,0x6e,
+    0x73,0x66,0x65,0x72,0x5f,0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x28,0x70,0x72,0x65,
+    0x76,0x5f,0x76,0x61,0x6c,0x20,0x3c,0x20,0x30,0x2e,0x30,0x66,0x20,0x3f,0x20,0x76,
+    0x61,0x6c,0x20,0x3a,0x20,0x70,0x72,0x65,0x76,0x5f,0x76,0x61,0x6c,0x2c,0x20,0x76,
+    0x61,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x61,0x6c,0x70,0x68,0x61,0x20,0x3d,0x20,0x31,0x2e,0x30,0x66,0x20,
+    0x2d,0x20,0x70,0x6f,0x77,0x28,0x31,0x2e,0x30,0x66,0x20,0x2d,0x20,0x73,0x65,0x67,
+    0x6d,0x65,0x6e,0x74,0x2e,0x61,0x2c,0x20,0x73,0x74,0x72,0x69,0x64,0x65,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,
+    0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x2e,
+    0x72,0x67,0x62,0x20,0x2a,0x20,0x28,0x61,0x6c,0x70,0x68,0x61,0x20,0x2f,0x20,0x6d,
+    0x61,0x78,0x28,0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x2e,0x61,0x2c,0x20,0x31,0x65,
+    0x2d,0x36,0x29,0x29,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x46,
+    0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x72,0x67,0x62,0x20,0x2b,0x3d,0x20,
+    0x28,0x31,0x2e,0x30,0x66,0x20,0x2d,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,
+    0x72,0x2e,0x61,0x29,0x20,0x2a,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,
+    0x61,0x20,0x2b,0x3d,0x20,0x28,0x31,0x2e,0x30,0x66,0x20,0x2d,0x20,0x46,0x72,0x61,
+    0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x61,0x29,0x20,0x2a,0x20,0x61,0x6c,0x70,0x68,
+    0x61,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x61,0x20,0x3e,0x3d,0x20,0x61,
+    0x6c,0x70,0x68,0x61,0x5f,0x63,0x75,0x74,0x6f,0x66,0x66,0x29,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x72,0x65,0x61,0x6b,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x70,0x72,0x65,0x76,0x5f,0x76,0x61,0x6c,0x20,0x3d,0x20,0x76,
+    0x61,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x74,0x72,0x69,
+    0x64,0x65,0x20,0x3d,0x20,0x66,0x61,0x69,0x6e,0x74,0x20,0x3f,0x20,0x6d,0x69,0x6e,
+    0x28,0x73,0x74,0x72,0x69,0x64,0x65,0x20,0x2a,0x20,0x32,0x2e,0x30,0x66,0x2c,0x20,
+    0x6d,0x61,0x78,0x5f,0x73,0x74,0x65,0x70,0x29,0x20,0x3a,0x20,0x6d,0x69,0x6e,0x5f,
+    0x73,0x74,0x65,0x70,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x20,
+    0x2b,0x3d,0x20,0x73,0x74,0x72,0x69,0x64,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x72,
     0x20,0x3d,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x5f,0x74,0x6f,0x5f,0x73,0x72,0x67,
-    0x62,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,
-    0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x79,0x20,0x3d,0x20,0x6c,
-    0x69,0x6e,0x65,0x61,0x72,0x5f,0x74,0x6f,0x5f,0x73,0x72,0x67,0x62,0x28,0x70,0x61,
-    0x72,0x61,0x6d,0x5f,0x33,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x46,0x72,0x61,0x67,
-    0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x46,0x72,0x61,
-    0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x7a,0x20,0x3d,0x20,0x6c,0x69,0x6e,0x65,0x61,
-    0x72,0x5f,0x74,0x6f,0x5f,0x73,0x72,0x67,0x62,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x34,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,
-    0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,
-    0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,
-    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,
-    0x20,0x20,0x20,0x20,0x76,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x20,0x3d,0x20,0x73,
-    0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x72,0x61,0x79,0x5f,
-    0x64,0x69,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,
-    0x72,0x6d,0x65,0x64,0x5f,0x65,0x79,0x65,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,
-    0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,
-    0x65,0x64,0x5f,0x65,0x79,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,
-    0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,
-    0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,
-    0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x46,
-    0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x46,0x72,0x61,0x67,0x43,
-    0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
-    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,
-    0x0a,0x00,
+    0x62,0x28,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x72,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x67,0x20,
+    0x3d,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x5f,0x74,0x6f,0x5f,0x73,0x72,0x67,0x62,
+    0x28,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x67,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x62,0x20,0x3d,
+    0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x5f,0x74,0x6f,0x5f,0x73,0x72,0x67,0x62,0x28,
+    0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x62,0x29,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,
+    0x70,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,
+    0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,
+    0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,
+    0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6f,0x72,0x64,0x20,0x3d,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x46,0x72,0x61,0x67,
+    0x43,0x6f,0x6f,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x46,0x72,
+    0x61,0x67,0x43,0x6f,0x6f,0x72,0x64,0x2e,0x77,0x20,0x3d,0x20,0x31,0x2e,0x30,0x20,
+    0x2f,0x20,0x67,0x6c,0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6f,0x72,0x64,0x2e,0x77,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x20,0x3d,
+    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x72,0x61,
+    0x79,0x5f,0x64,0x69,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x74,0x72,0x61,0x6e,0x73,
+    0x66,0x6f,0x72,0x6d,0x65,0x64,0x5f,0x65,0x79,0x65,0x20,0x3d,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,
+    0x72,0x6d,0x65,0x64,0x5f,0x65,0x79,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,
+    0x61,0x67,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,
+    0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,
+    0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,
+    0x2e,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x46,0x72,0x61,
+    0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,
+    0x0a,0x7d,0x0a,0x00,
 };
 /*
     #include <metal_stdlib>
@@ -810,7 +1462,7 @@ static const uint8_t fs_volume_source_hlsl5[3074] = {
     struct main0_out
     {
         float3 vray_dir [[user(locn0)]];
-        float3 transformed_eye [[user(locn1)]];
+        float3 transformed_eye [[user(locn1), flat]];
         float4 gl_Position [[position]];
     };
 
@@ -822,14 +1474,15 @@ static const uint8_t fs_volume_source_hlsl5[3074] = {
     vertex main0_out main0(main0_in in [[stage_in]], constant vs_vol_params& _20 [[buffer(0)]])
     {
         main0_out out = {};
-        out.gl_Position = _20.proj_view * float4(fma(in.pos, _20.volume_scale, _20.volume_translation), 1.0);
+        out.gl_Position = (_20.proj_view * float4(in.pos * _20.volume_scale + _20.volume_translation, 1.0));
+
         out.transformed_eye = (_20.eye_pos - _20.volume_translation) / _20.volume_scale;
         out.vray_dir = in.pos - out.transformed_eye;
         return out;
     }
 
 */
-static const uint8_t vs_volume_source_metal_macos[773] = {
+static const uint8_t vs_volume_source_metal_macos[779] = {
     0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
     0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
     0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
@@ -848,37 +1501,37 @@ static const uint8_t vs_volume_source_metal_macos[773] = {
     0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,
     0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,
     0x6f,0x72,0x6d,0x65,0x64,0x5f,0x65,0x79,0x65,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,
-    0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
-    0x6e,0x20,0x5b,0x5b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5d,0x5d,0x3b,0x0a,
-    0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,
-    0x5f,0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
-    0x20,0x70,0x6f,0x73,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
-    0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x65,0x72,0x74,0x65,
-    0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,
-    0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,0x5b,0x5b,
-    0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,
-    0x74,0x61,0x6e,0x74,0x20,0x76,0x73,0x5f,0x76,0x6f,0x6c,0x5f,0x70,0x61,0x72,0x61,
-    0x6d,0x73,0x26,0x20,0x5f,0x32,0x30,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,
-    0x28,0x30,0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,
-    0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,
-    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x5f,0x32,0x30,0x2e,0x70,0x72,0x6f,0x6a,0x5f,
-    0x76,0x69,0x65,0x77,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x66,0x6d,
-    0x61,0x28,0x69,0x6e,0x2e,0x70,0x6f,0x73,0x2c,0x20,0x5f,0x32,0x30,0x2e,0x76,0x6f,
-    0x6c,0x75,0x6d,0x65,0x5f,0x73,0x63,0x61,0x6c,0x65,0x2c,0x20,0x5f,0x32,0x30,0x2e,
-    0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x69,
-    0x6f,0x6e,0x29,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,
-    0x75,0x74,0x2e,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x65,0x64,0x5f,0x65,
-    0x79,0x65,0x20,0x3d,0x20,0x28,0x5f,0x32,0x30,0x2e,0x65,0x79,0x65,0x5f,0x70,0x6f,
-    0x73,0x20,0x2d,0x20,0x5f,0x32,0x30,0x2e,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x74,
-    0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x69,0x6f,0x6e,0x29,0x20,0x2f,0x20,0x5f,0x32,
-    0x30,0x2e,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x73,0x63,0x61,0x6c,0x65,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,
-    0x20,0x3d,0x20,0x69,0x6e,0x2e,0x70,0x6f,0x73,0x20,0x2d,0x20,0x6f,0x75,0x74,0x2e,
-    0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x65,0x64,0x5f,0x65,0x79,0x65,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,
-    0x0a,0x7d,0x0a,0x0a,0x00,
+    0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x2c,0x20,0x66,0x6c,0x61,0x74,0x5d,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x70,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,
+    0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x6f,0x73,0x20,0x5b,0x5b,0x61,0x74,0x74,
+    0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,
+    0x0a,0x76,0x65,0x72,0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,
+    0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,
+    0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,
+    0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x76,0x73,0x5f,0x76,0x6f,
+    0x6c,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x32,0x30,0x20,0x5b,0x5b,
+    0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,
+    0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,
+    0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x28,0x5f,0x32,
+    0x30,0x2e,0x70,0x72,0x6f,0x6a,0x5f,0x76,0x69,0x65,0x77,0x20,0x2a,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x28,0x69,0x6e,0x2e,0x70,0x6f,0x73,0x20,0x2a,0x20,0x5f,0x32,
+    0x30,0x2e,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x2b,
+    0x20,0x5f,0x32,0x30,0x2e,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x74,0x72,0x61,0x6e,
+    0x73,0x6c,0x61,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,
+    0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,
+    0x72,0x6d,0x65,0x64,0x5f,0x65,0x79,0x65,0x20,0x3d,0x20,0x28,0x5f,0x32,0x30,0x2e,
+    0x65,0x79,0x65,0x5f,0x70,0x6f,0x73,0x20,0x2d,0x20,0x5f,0x32,0x30,0x2e,0x76,0x6f,
+    0x6c,0x75,0x6d,0x65,0x5f,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x69,0x6f,0x6e,
+    0x29,0x20,0x2f,0x20,0x5f,0x32,0x30,0x2e,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x73,
+    0x63,0x61,0x6c,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x72,
+    0x61,0x79,0x5f,0x64,0x69,0x72,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x70,0x6f,0x73,0x20,
+    0x2d,0x20,0x6f,0x75,0x74,0x2e,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x65,
+    0x64,0x5f,0x65,0x79,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
 /*
     #pragma clang diagnostic ignored "-Wmissing-prototypes"
@@ -891,11 +1544,21 @@ static const uint8_t vs_volume_source_metal_macos[773] = {
     struct fs_vol_params
     {
         packed_int3 volume_dims;
-        float dt_scale;
-        float near_clip;
-        float far_clip;
+        int bricked;
+        int brick_size;
         float3 new_box_min;
-        float3 new_box_max;
+        packed_float3 new_box_max;
+        float lod_scale;
+        packed_float3 volume_extent;
+        float max_lod;
+        packed_int3 cell_dims;
+        int cell_size;
+        float value_scale;
+        float value_offset;
+        float4 march;
+        float jitter;
+        float2 scene_scale;
+        int2 scene_size;
     };
 
     struct main0_out
@@ -910,75 +1573,151 @@ static const uint8_t vs_volume_source_metal_macos[773] = {
     };
 
     static inline __attribute__((always_inline))
-    float2 intersect_box(thread const float3& orig, thread const float3& dir, constant fs_vol_params& _25)
-    {
-        float3 _38 = float3(1.0) / dir;
-        float3 _44 = (_25.new_box_min - orig) * _38;
-        float3 _50 = (_25.new_box_max - orig) * _38;
-        float3 _54 = fast::min(_44, _50);
-        float3 _58 = fast::max(_44, _50);
-        return float2(fast::max(_54.x, fast::max(_54.y, _54.z)), fast::min(_58.x, fast::min(_58.y, _58.z)));
+    float2 intersect_box(float3 orig, float3 dir, constant fs_vol_params& _25, texture3d<float> volume, texture2d<float> transfer_table, texture3d<float> brick_table, texture3d<float> brick_atlas, texture3d<float> occupancy, texture2d<float> scene_distance, sampler volume_smp, sampler transfer_smp, sampler scene_smp) {
+        float3 box_min = _25.new_box_min;
+        float3 box_max = float3(_25.new_box_max);
+        float3 inv_dir = 1.0 / dir;
+        float3 tmin_tmp = (box_min - orig) * inv_dir;
+        float3 tmax_tmp = (box_max - orig) * inv_dir;
+        float3 tmin = min(tmin_tmp, tmax_tmp);
+        float3 tmax = max(tmin_tmp, tmax_tmp);
+        float t0 = max(tmin.x, max(tmin.y, tmin.z));
+        float t1 = min(tmax.x, min(tmax.y, tmax.z));
+        return float2(t0, t1);
     }
 
     static inline __attribute__((always_inline))
-    float linear_to_srgb(thread const float& x)
-    {
-        if (x <= 0.003130800090730190277099609375)
-        {
-            return 12.9200000762939453125 * x;
+    float ray_lod(float t, float3 ray_dir, constant fs_vol_params& _25, texture3d<float> volume, texture2d<float> transfer_table, texture3d<float> brick_table, texture3d<float> brick_atlas, texture3d<float> occupancy, texture2d<float> scene_distance, sampler volume_smp, sampler transfer_smp, sampler scene_smp) {
+        float ray_distance = t * length(ray_dir * float3(_25.volume_extent));
+        return clamp(log2(max(ray_distance * _25.lod_scale, 1.0)), 0.0, _25.max_lod);
+    }
+
+    static inline __attribute__((always_inline))
+    float sample_volume(float3 p, float lod, constant fs_vol_params& _25, texture3d<float> volume, texture2d<float> transfer_table, texture3d<float> brick_table, texture3d<float> brick_atlas, texture3d<float> occupancy, texture2d<float> scene_distance, sampler volume_smp, sampler transfer_smp, sampler scene_smp) {
+        if (_25.bricked == 0) {
+            return volume.sample(volume_smp, p, level(lod)).r;
+        }
+        int3 voxel = clamp(int3(floor(p * float3(int3(_25.volume_dims)))), int3(0, 0, 0), int3(_25.volume_dims) - int3(1, 1, 1));
+        float4 entry = brick_table.read(uint3(voxel / _25.brick_size), 0);
+        int brick_level = int(entry.a * 255.0 + 0.5) - 1;
+        if (brick_level < 0) {
+            return 0.0;
+        }
+        int3 coarse = voxel >> brick_level;
+        int3 slot = int3(entry.rgb * 255.0 + 0.5);
+        return brick_atlas.read(uint3(slot * _25.brick_size + (coarse - (coarse / _25.brick_size) * _25.brick_size)), 0).r;
+    }
+
+    static inline __attribute__((always_inline))
+    float skip_empty(float3 p, float t, float3 eye, float3 ray_dir, constant fs_vol_params& _25, texture3d<float> volume, texture2d<float> transfer_table, texture3d<float> brick_table, texture3d<float> brick_atlas, texture3d<float> occupancy, texture2d<float> scene_distance, sampler volume_smp, sampler transfer_smp, sampler scene_smp) {
+        float3 cell_scale = float3(int3(_25.volume_dims)) / float(_25.cell_size);
+        int3 cell = clamp(int3(floor(p * cell_scale)), int3(0, 0, 0), int3(_25.cell_dims) - int3(1, 1, 1));
+        if (occupancy.read(uint3(cell), 0).r > 0.0) {
+            return t;
         }
-        return fma(1.05499994754791259765625, pow(x, 0.4166666567325592041015625), -0.054999999701976776123046875);
+        float3 exit_face = (float3(cell) + step(float3(0.0, 0.0, 0.0), ray_dir)) / cell_scale;
+        float3 t_exit = (exit_face - eye) / ray_dir;
+        return min(t_exit.x, min(t_exit.y, t_exit.z));
+    }
+
+    static inline __attribute__((always_inline))
+    float4 transfer_segment(float front, float back, constant fs_vol_params& _25, texture3d<float> volume, texture2d<float> transfer_table, texture3d<float> brick_table, texture3d<float> brick_atlas, texture3d<float> occupancy, texture2d<float> scene_distance, sampler volume_smp, sampler transfer_smp, sampler scene_smp) {
+        return transfer_table.sample(transfer_smp, float2(front, back) * (255.0 / 256.0) + 0.5 / 256.0);
     }
 
-    fragment main0_out main0(main0_in in [[stage_in]], constant fs_vol_params& _25 [[buffer(0)]], texture3d<float> volume [[texture(0)]], texture2d<float> colormap [[texture(1)]], sampler volume_smp [[sampler(0)]], sampler colormap_smp [[sampler(1)]])
+    static inline __attribute__((always_inline))
+    float wang_hash(int seed) {
+        seed = (seed ^ 61) ^ (seed >> 16);
+        seed *= 9;
+        seed = seed ^ (seed >> 4);
+        seed *= 0x27d4eb2d;
+        seed = seed ^ (seed >> 15);
+        return float(seed % 2147483647) / float(2147483647);
+    }
+
+    static inline __attribute__((always_inline))
+    float linear_to_srgb(float x) {
+        if (x <= 0.0031308f) {
+            return 12.92f * x;
+        }
+        return 1.055f * pow(x, 1.f / 2.4f) - 0.055f;
+    }
+
+    fragment main0_out main0(main0_in in [[stage_in]], constant fs_vol_params& _25 [[buffer(0)]], texture3d<float> volume [[texture(0)]], texture2d<float> transfer_table [[texture(1)]], texture3d<float> brick_table [[texture(2)]], texture3d<float> brick_atlas [[texture(3)]], texture3d<float> occupancy [[texture(4)]], texture2d<float> scene_distance [[texture(5)]], sampler volume_smp [[sampler(0)]], sampler transfer_smp [[sampler(1)]], sampler scene_smp [[sampler(2)]], float4 gl_FragCoord [[position]])
     {
         main0_out out = {};
-        float3 _109 = fast::normalize(in.vray_dir);
-        float3 param = in.transformed_eye;
-        float3 param_1 = _109;
-        float2 _117 = intersect_box(param, param_1, _25);
-        float2 t_hit = _117;
-        if (_117.x > _117.y)
-        {
+        float3 ray_dir = normalize(in.vray_dir);
+
+        float2 t_hit = intersect_box(in.transformed_eye, ray_dir, _25, volume, transfer_table, brick_table, brick_atlas, occupancy, scene_distance, volume_smp, transfer_smp, scene_smp);
+        if (t_hit.x > t_hit.y) {
+            discard_fragment();
+        }
+        t_hit.x = max(t_hit.x, 0.0);
+
+        int2 scene_pixel = min(int2(gl_FragCoord.xy * _25.scene_scale), _25.scene_size - int2(1, 1));
+        float mesh_distance = scene_distance.read(uint2(scene_pixel), 0).r;
+        t_hit.y = min(t_hit.y, mesh_distance / length(ray_dir * float3(_25.volume_extent)));
+        if (t_hit.x >= t_hit.y) {
             discard_fragment();
         }
-        float2 _274 = t_hit;
-        float _129 = fast::max(_274.x, 0.0);
-        float2 _276 = _274;
-        _276.x = _129;
-        t_hit = _276;
-        float3 _141 = float3(1.0) / (float3(int3(_25.volume_dims)) * abs(_109));
-        float _150 = fast::min(_141.x, fast::min(_141.y, _141.z));
-        out.FragColor = float4(0.0);
-        float3 p = in.transformed_eye + (_109 * _129);
-        for (float t = _129; t < t_hit.y; t += _150)
-        {
-            float4 _186 = volume.sample(volume_smp, p);
-            float _187 = _186.x;
-            float _215 = out.FragColor.w;
-            float4 _223 = out.FragColor;
-            float3 _225 = _223.xyz + (float4(colormap.sample(colormap_smp, float2(fma(_187, 0.999000012874603271484375, 0.0005000000237487256526947021484375), 0.5)).xyz, _187).xyz * ((1.0 - _215) * _187));
-            out.FragColor.x = _225.x;
-            out.FragColor.y = _225.y;
-            out.FragColor.z = _225.z;
-            out.FragColor.w = fma(1.0 - out.FragColor.w, _187, out.FragColor.w);
-            if (out.FragColor.w >= 0.980000019073486328125)
-            {
+
+        float3 dt_vec = 1.0 / (float3(int3(_25.volume_dims)) * abs(ray_dir));
+        float dt = min(dt_vec.x, min(dt_vec.y, dt_vec.z));
+
+        float min_step = _25.march.x;
+        float max_step = _25.march.y;
+        float refine_opacity = _25.march.z;
+        float alpha_cutoff = _25.march.w;
+
+        out.FragColor = float4(0.0, 0.0, 0.0, 0.0);
+
+        float steps = (t_hit.y - t_hit.x) / dt;
+        float s = _25.jitter;
+        float stride = 1.0;
+        float prev_val = -1.0;
+        while (s < steps) {
+            float t = t_hit.x + s * dt;
+            float3 p = in.transformed_eye + t * ray_dir;
+
+            float t_skip = skip_empty(p, t, in.transformed_eye, ray_dir, _25, volume, transfer_table, brick_table, brick_atlas, occupancy, scene_distance, volume_smp, transfer_smp, scene_smp);
+            if (t_skip > t) {
+                s = max(floor((t_skip - t_hit.x) / dt - _25.jitter) + _25.jitter, s + 1.0);
+                stride = 1.0;
+                prev_val = -1.0;
+                continue;
+            }
+
+            float val = clamp(sample_volume(p, ray_lod(t, ray_dir, _25, volume, transfer_table, brick_table, brick_atlas, occupancy, scene_distance, volume_smp, transfer_smp, scene_smp), _25, volume, transfer_table, brick_table, brick_atlas, occupancy, scene_distance, volume_smp, transfer_smp, scene_smp) * _25.value_scale + _25.value_offset, 0.0, 1.0);
+
+            bool faint = val <= refine_opacity && abs(val - prev_val) <= refine_opacity;
+            if (stride > min_step && !faint) {
+                s -= stride - min_step;
+                stride = min_step;
+                continue;
+            }
+
+            float4 segment = transfer_segment(prev_val < 0.0 ? val : prev_val, val, _25, volume, transfer_table, brick_table, brick_atlas, occupancy, scene_distance, volume_smp, transfer_smp, scene_smp);
+            float alpha = 1.0 - pow(1.0 - segment.a, stride);
+            float3 color = segment.rgb * (alpha / max(segment.a, 1e-6));
+
+            out.FragColor.rgb += (1.0 - out.FragColor.a) * color;
+            out.FragColor.a += (1.0 - out.FragColor.a) * alpha;
+
+            if (out.FragColor.a >= alpha_cutoff) {
                 break;
             }
-            p += (_109 * _150);
+            prev_val = val;
+            stride = faint ? min(stride * 2.0, max_step) : min_step;
+            s += stride;
         }
-        float param_2 = out.FragColor.x;
-        out.FragColor.x = linear_to_srgb(param_2);
-        float param_3 = out.FragColor.y;
-        out.FragColor.y = linear_to_srgb(param_3);
-        float param_4 = out.FragColor.z;
-        out.FragColor.z = linear_to_srgb(param_4);
+        out.FragColor.r = linear_to_srgb(out.FragColor.r);
+        out.FragColor.g = linear_to_srgb(out.FragColor.g);
+        out.FragColor.b = linear_to_srgb(out.FragColor.b);
         return out;
     }
 
 */
-static const uint8_t fs_volume_source_metal_macos[3113] = {
+static const uint8_t fs_volume_source_metal_macos[8261] = {
     0x23,0x70,0x72,0x61,0x67,0x6d,0x61,0x20,0x63,0x6c,0x61,0x6e,0x67,0x20,0x64,0x69,
     0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x20,0x69,0x67,0x6e,0x6f,0x72,0x65,0x64,
     0x20,0x22,0x2d,0x57,0x6d,0x69,0x73,0x73,0x69,0x6e,0x67,0x2d,0x70,0x72,0x6f,0x74,
@@ -990,190 +1729,512 @@ static const uint8_t fs_volume_source_metal_macos[3113] = {
     0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x76,0x6f,0x6c,0x5f,0x70,
     0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x70,0x61,0x63,0x6b,
     0x65,0x64,0x5f,0x69,0x6e,0x74,0x33,0x20,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x64,
-    0x69,0x6d,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,
-    0x74,0x5f,0x73,0x63,0x61,0x6c,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x20,0x6e,0x65,0x61,0x72,0x5f,0x63,0x6c,0x69,0x70,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x66,0x61,0x72,0x5f,0x63,0x6c,0x69,0x70,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x6e,0x65,0x77,
-    0x5f,0x62,0x6f,0x78,0x5f,0x6d,0x69,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
-    0x6f,0x61,0x74,0x33,0x20,0x6e,0x65,0x77,0x5f,0x62,0x6f,0x78,0x5f,0x6d,0x61,0x78,
+    0x69,0x6d,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x62,0x72,0x69,
+    0x63,0x6b,0x65,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x62,0x72,
+    0x69,0x63,0x6b,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x6e,0x65,0x77,0x5f,0x62,0x6f,0x78,0x5f,0x6d,0x69,0x6e,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x61,0x63,0x6b,0x65,0x64,0x5f,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x20,0x6e,0x65,0x77,0x5f,0x62,0x6f,0x78,0x5f,0x6d,0x61,0x78,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6c,0x6f,0x64,0x5f,0x73,
+    0x63,0x61,0x6c,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x61,0x63,0x6b,0x65,0x64,
+    0x5f,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x65,
+    0x78,0x74,0x65,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x6d,0x61,0x78,0x5f,0x6c,0x6f,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x61,
+    0x63,0x6b,0x65,0x64,0x5f,0x69,0x6e,0x74,0x33,0x20,0x63,0x65,0x6c,0x6c,0x5f,0x64,
+    0x69,0x6d,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x63,0x65,0x6c,
+    0x6c,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x5f,0x73,0x63,0x61,0x6c,0x65,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x5f,0x6f,
+    0x66,0x66,0x73,0x65,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x6d,0x61,0x72,0x63,0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x6a,0x69,0x74,0x74,0x65,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x73,0x63,0x65,0x6e,0x65,0x5f,0x73,0x63,0x61,0x6c,
+    0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x32,0x20,0x73,0x63,0x65,0x6e,
+    0x65,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,
+    0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,
+    0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x63,0x6f,0x6c,0x6f,0x72,0x28,0x30,0x29,0x5d,0x5d,
     0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,
-    0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x34,0x20,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,
-    0x63,0x6f,0x6c,0x6f,0x72,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,
-    0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x0a,
-    0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x72,0x61,
-    0x79,0x5f,0x64,0x69,0x72,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,
-    0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x33,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x65,0x64,0x5f,0x65,0x79,
-    0x65,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x2c,
-    0x20,0x66,0x6c,0x61,0x74,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x61,
+    0x6e,0x30,0x5f,0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x76,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x20,0x5b,0x5b,0x75,0x73,
+    0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,
+    0x6d,0x65,0x64,0x5f,0x65,0x79,0x65,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,
+    0x6f,0x63,0x6e,0x31,0x29,0x2c,0x20,0x66,0x6c,0x61,0x74,0x5d,0x5d,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,
+    0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x69,0x6e,0x74,0x65,0x72,0x73,0x65,0x63,0x74,
+    0x5f,0x62,0x6f,0x78,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x6f,0x72,0x69,0x67,
+    0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x64,0x69,0x72,0x2c,0x20,0x63,0x6f,
+    0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x66,0x73,0x5f,0x76,0x6f,0x6c,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x32,0x35,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x33,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x76,0x6f,0x6c,0x75,
+    0x6d,0x65,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,
+    0x6f,0x61,0x74,0x3e,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x65,0x72,0x5f,0x74,0x61,
+    0x62,0x6c,0x65,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x33,0x64,0x3c,0x66,
+    0x6c,0x6f,0x61,0x74,0x3e,0x20,0x62,0x72,0x69,0x63,0x6b,0x5f,0x74,0x61,0x62,0x6c,
+    0x65,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x33,0x64,0x3c,0x66,0x6c,0x6f,
+    0x61,0x74,0x3e,0x20,0x62,0x72,0x69,0x63,0x6b,0x5f,0x61,0x74,0x6c,0x61,0x73,0x2c,
+    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x33,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,
+    0x3e,0x20,0x6f,0x63,0x63,0x75,0x70,0x61,0x6e,0x63,0x79,0x2c,0x20,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x73,0x63,
+    0x65,0x6e,0x65,0x5f,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x2c,0x20,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x20,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x73,0x6d,0x70,
+    0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,
+    0x65,0x72,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,
+    0x73,0x63,0x65,0x6e,0x65,0x5f,0x73,0x6d,0x70,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x62,0x6f,0x78,0x5f,0x6d,0x69,0x6e,0x20,
+    0x3d,0x20,0x5f,0x32,0x35,0x2e,0x6e,0x65,0x77,0x5f,0x62,0x6f,0x78,0x5f,0x6d,0x69,
+    0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x62,0x6f,
+    0x78,0x5f,0x6d,0x61,0x78,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x5f,
+    0x32,0x35,0x2e,0x6e,0x65,0x77,0x5f,0x62,0x6f,0x78,0x5f,0x6d,0x61,0x78,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x69,0x6e,0x76,0x5f,
+    0x64,0x69,0x72,0x20,0x3d,0x20,0x31,0x2e,0x30,0x20,0x2f,0x20,0x64,0x69,0x72,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x74,0x6d,0x69,0x6e,
+    0x5f,0x74,0x6d,0x70,0x20,0x3d,0x20,0x28,0x62,0x6f,0x78,0x5f,0x6d,0x69,0x6e,0x20,
+    0x2d,0x20,0x6f,0x72,0x69,0x67,0x29,0x20,0x2a,0x20,0x69,0x6e,0x76,0x5f,0x64,0x69,
+    0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x74,0x6d,
+    0x61,0x78,0x5f,0x74,0x6d,0x70,0x20,0x3d,0x20,0x28,0x62,0x6f,0x78,0x5f,0x6d,0x61,
+    0x78,0x20,0x2d,0x20,0x6f,0x72,0x69,0x67,0x29,0x20,0x2a,0x20,0x69,0x6e,0x76,0x5f,
+    0x64,0x69,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,
+    0x74,0x6d,0x69,0x6e,0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,0x74,0x6d,0x69,0x6e,0x5f,
+    0x74,0x6d,0x70,0x2c,0x20,0x74,0x6d,0x61,0x78,0x5f,0x74,0x6d,0x70,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x74,0x6d,0x61,0x78,0x20,
+    0x3d,0x20,0x6d,0x61,0x78,0x28,0x74,0x6d,0x69,0x6e,0x5f,0x74,0x6d,0x70,0x2c,0x20,
+    0x74,0x6d,0x61,0x78,0x5f,0x74,0x6d,0x70,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x74,0x30,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x74,0x6d,
+    0x69,0x6e,0x2e,0x78,0x2c,0x20,0x6d,0x61,0x78,0x28,0x74,0x6d,0x69,0x6e,0x2e,0x79,
+    0x2c,0x20,0x74,0x6d,0x69,0x6e,0x2e,0x7a,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x31,0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,0x74,
+    0x6d,0x61,0x78,0x2e,0x78,0x2c,0x20,0x6d,0x69,0x6e,0x28,0x74,0x6d,0x61,0x78,0x2e,
+    0x79,0x2c,0x20,0x74,0x6d,0x61,0x78,0x2e,0x7a,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x74,
+    0x30,0x2c,0x20,0x74,0x31,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,
+    0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,
+    0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x61,
+    0x79,0x5f,0x6c,0x6f,0x64,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x2c,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x20,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x2c,0x20,0x63,
+    0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x66,0x73,0x5f,0x76,0x6f,0x6c,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x32,0x35,0x2c,0x20,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x33,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x76,0x6f,0x6c,
+    0x75,0x6d,0x65,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,
+    0x6c,0x6f,0x61,0x74,0x3e,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x65,0x72,0x5f,0x74,
+    0x61,0x62,0x6c,0x65,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x33,0x64,0x3c,
+    0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x62,0x72,0x69,0x63,0x6b,0x5f,0x74,0x61,0x62,
+    0x6c,0x65,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x33,0x64,0x3c,0x66,0x6c,
+    0x6f,0x61,0x74,0x3e,0x20,0x62,0x72,0x69,0x63,0x6b,0x5f,0x61,0x74,0x6c,0x61,0x73,
+    0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x33,0x64,0x3c,0x66,0x6c,0x6f,0x61,
+    0x74,0x3e,0x20,0x6f,0x63,0x63,0x75,0x70,0x61,0x6e,0x63,0x79,0x2c,0x20,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x73,
+    0x63,0x65,0x6e,0x65,0x5f,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x2c,0x20,0x73,
+    0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x73,0x6d,
+    0x70,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x74,0x72,0x61,0x6e,0x73,
+    0x66,0x65,0x72,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,
+    0x20,0x73,0x63,0x65,0x6e,0x65,0x5f,0x73,0x6d,0x70,0x29,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x61,0x79,0x5f,0x64,0x69,0x73,0x74,
+    0x61,0x6e,0x63,0x65,0x20,0x3d,0x20,0x74,0x20,0x2a,0x20,0x6c,0x65,0x6e,0x67,0x74,
+    0x68,0x28,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x28,0x5f,0x32,0x35,0x2e,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x65,0x78,
+    0x74,0x65,0x6e,0x74,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x6c,0x6f,0x67,0x32,0x28,0x6d,0x61,
+    0x78,0x28,0x72,0x61,0x79,0x5f,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x20,0x2a,
+    0x20,0x5f,0x32,0x35,0x2e,0x6c,0x6f,0x64,0x5f,0x73,0x63,0x61,0x6c,0x65,0x2c,0x20,
+    0x31,0x2e,0x30,0x29,0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x5f,0x32,0x35,0x2e,
+    0x6d,0x61,0x78,0x5f,0x6c,0x6f,0x64,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,
     0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,
     0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,
-    0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x32,
-    0x20,0x69,0x6e,0x74,0x65,0x72,0x73,0x65,0x63,0x74,0x5f,0x62,0x6f,0x78,0x28,0x74,
-    0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x33,0x26,0x20,0x6f,0x72,0x69,0x67,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,
-    0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x26,0x20,0x64,
-    0x69,0x72,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x66,0x73,0x5f,
-    0x76,0x6f,0x6c,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x32,0x35,0x29,
-    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x33,
-    0x38,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x31,0x2e,0x30,0x29,0x20,
-    0x2f,0x20,0x64,0x69,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x33,0x20,0x5f,0x34,0x34,0x20,0x3d,0x20,0x28,0x5f,0x32,0x35,0x2e,0x6e,0x65,0x77,
-    0x5f,0x62,0x6f,0x78,0x5f,0x6d,0x69,0x6e,0x20,0x2d,0x20,0x6f,0x72,0x69,0x67,0x29,
-    0x20,0x2a,0x20,0x5f,0x33,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x33,0x20,0x5f,0x35,0x30,0x20,0x3d,0x20,0x28,0x5f,0x32,0x35,0x2e,0x6e,0x65,
-    0x77,0x5f,0x62,0x6f,0x78,0x5f,0x6d,0x61,0x78,0x20,0x2d,0x20,0x6f,0x72,0x69,0x67,
-    0x29,0x20,0x2a,0x20,0x5f,0x33,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x33,0x20,0x5f,0x35,0x34,0x20,0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,
-    0x6d,0x69,0x6e,0x28,0x5f,0x34,0x34,0x2c,0x20,0x5f,0x35,0x30,0x29,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x35,0x38,0x20,0x3d,0x20,
-    0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,0x61,0x78,0x28,0x5f,0x34,0x34,0x2c,0x20,0x5f,
-    0x35,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,0x61,0x78,
-    0x28,0x5f,0x35,0x34,0x2e,0x78,0x2c,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,0x61,
-    0x78,0x28,0x5f,0x35,0x34,0x2e,0x79,0x2c,0x20,0x5f,0x35,0x34,0x2e,0x7a,0x29,0x29,
-    0x2c,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,0x69,0x6e,0x28,0x5f,0x35,0x38,0x2e,
-    0x78,0x2c,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,0x69,0x6e,0x28,0x5f,0x35,0x38,
-    0x2e,0x79,0x2c,0x20,0x5f,0x35,0x38,0x2e,0x7a,0x29,0x29,0x29,0x3b,0x0a,0x7d,0x0a,
+    0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x5f,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x28,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x70,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6c,0x6f,
+    0x64,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x66,0x73,0x5f,0x76,
+    0x6f,0x6c,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x32,0x35,0x2c,0x20,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x33,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,
+    0x20,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,
+    0x65,0x72,0x5f,0x74,0x61,0x62,0x6c,0x65,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x33,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x62,0x72,0x69,0x63,0x6b,
+    0x5f,0x74,0x61,0x62,0x6c,0x65,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x33,
+    0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x62,0x72,0x69,0x63,0x6b,0x5f,0x61,
+    0x74,0x6c,0x61,0x73,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x33,0x64,0x3c,
+    0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x6f,0x63,0x63,0x75,0x70,0x61,0x6e,0x63,0x79,
+    0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,
+    0x74,0x3e,0x20,0x73,0x63,0x65,0x6e,0x65,0x5f,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,
+    0x65,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x76,0x6f,0x6c,0x75,0x6d,
+    0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x74,
+    0x72,0x61,0x6e,0x73,0x66,0x65,0x72,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x20,0x73,0x63,0x65,0x6e,0x65,0x5f,0x73,0x6d,0x70,0x29,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x32,0x35,0x2e,0x62,0x72,
+    0x69,0x63,0x6b,0x65,0x64,0x20,0x3d,0x3d,0x20,0x30,0x29,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x6f,0x6c,
+    0x75,0x6d,0x65,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x76,0x6f,0x6c,0x75,0x6d,
+    0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x70,0x2c,0x20,0x6c,0x65,0x76,0x65,0x6c,0x28,
+    0x6c,0x6f,0x64,0x29,0x29,0x2e,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x6e,0x74,0x33,0x20,0x76,0x6f,0x78,0x65,0x6c,0x20,0x3d,0x20,
+    0x63,0x6c,0x61,0x6d,0x70,0x28,0x69,0x6e,0x74,0x33,0x28,0x66,0x6c,0x6f,0x6f,0x72,
+    0x28,0x70,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x69,0x6e,0x74,0x33,
+    0x28,0x5f,0x32,0x35,0x2e,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x64,0x69,0x6d,0x73,
+    0x29,0x29,0x29,0x29,0x2c,0x20,0x69,0x6e,0x74,0x33,0x28,0x30,0x2c,0x20,0x30,0x2c,
+    0x20,0x30,0x29,0x2c,0x20,0x69,0x6e,0x74,0x33,0x28,0x5f,0x32,0x35,0x2e,0x76,0x6f,
+    0x6c,0x75,0x6d,0x65,0x5f,0x64,0x69,0x6d,0x73,0x29,0x20,0x2d,0x20,0x69,0x6e,0x74,
+    0x33,0x28,0x31,0x2c,0x20,0x31,0x2c,0x20,0x31,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x65,0x6e,0x74,0x72,0x79,0x20,0x3d,0x20,
+    0x62,0x72,0x69,0x63,0x6b,0x5f,0x74,0x61,0x62,0x6c,0x65,0x2e,0x72,0x65,0x61,0x64,
+    0x28,0x75,0x69,0x6e,0x74,0x33,0x28,0x76,0x6f,0x78,0x65,0x6c,0x20,0x2f,0x20,0x5f,
+    0x32,0x35,0x2e,0x62,0x72,0x69,0x63,0x6b,0x5f,0x73,0x69,0x7a,0x65,0x29,0x2c,0x20,
+    0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x62,0x72,0x69,0x63,
+    0x6b,0x5f,0x6c,0x65,0x76,0x65,0x6c,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x65,0x6e,
+    0x74,0x72,0x79,0x2e,0x61,0x20,0x2a,0x20,0x32,0x35,0x35,0x2e,0x30,0x20,0x2b,0x20,
+    0x30,0x2e,0x35,0x29,0x20,0x2d,0x20,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,
+    0x20,0x28,0x62,0x72,0x69,0x63,0x6b,0x5f,0x6c,0x65,0x76,0x65,0x6c,0x20,0x3c,0x20,
+    0x30,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x6e,0x74,0x33,0x20,0x63,0x6f,0x61,0x72,0x73,0x65,0x20,0x3d,
+    0x20,0x76,0x6f,0x78,0x65,0x6c,0x20,0x3e,0x3e,0x20,0x62,0x72,0x69,0x63,0x6b,0x5f,
+    0x6c,0x65,0x76,0x65,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x33,0x20,
+    0x73,0x6c,0x6f,0x74,0x20,0x3d,0x20,0x69,0x6e,0x74,0x33,0x28,0x65,0x6e,0x74,0x72,
+    0x79,0x2e,0x72,0x67,0x62,0x20,0x2a,0x20,0x32,0x35,0x35,0x2e,0x30,0x20,0x2b,0x20,
+    0x30,0x2e,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x62,0x72,0x69,0x63,0x6b,0x5f,0x61,0x74,0x6c,0x61,0x73,0x2e,0x72,0x65,0x61,
+    0x64,0x28,0x75,0x69,0x6e,0x74,0x33,0x28,0x73,0x6c,0x6f,0x74,0x20,0x2a,0x20,0x5f,
+    0x32,0x35,0x2e,0x62,0x72,0x69,0x63,0x6b,0x5f,0x73,0x69,0x7a,0x65,0x20,0x2b,0x20,
+    0x28,0x63,0x6f,0x61,0x72,0x73,0x65,0x20,0x2d,0x20,0x28,0x63,0x6f,0x61,0x72,0x73,
+    0x65,0x20,0x2f,0x20,0x5f,0x32,0x35,0x2e,0x62,0x72,0x69,0x63,0x6b,0x5f,0x73,0x69,
+    0x7a,0x65,0x29,0x20,0x2a,0x20,0x5f,0x32,0x35,0x2e,0x62,0x72,0x69,0x63,0x6b,0x5f,
+    0x73,0x69,0x7a,0x65,0x29,0x29,0x2c,0x20,0x30,0x29,0x2e,0x72,0x3b,0x0a,0x7d,0x0a,
     0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,
     0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,
     0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,
-    0x6f,0x61,0x74,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x5f,0x74,0x6f,0x5f,0x73,0x72,
-    0x67,0x62,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x78,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
-    0x69,0x66,0x20,0x28,0x78,0x20,0x3c,0x3d,0x20,0x30,0x2e,0x30,0x30,0x33,0x31,0x33,
-    0x30,0x38,0x30,0x30,0x30,0x39,0x30,0x37,0x33,0x30,0x31,0x39,0x30,0x32,0x37,0x37,
-    0x30,0x39,0x39,0x36,0x30,0x39,0x33,0x37,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
-    0x31,0x32,0x2e,0x39,0x32,0x30,0x30,0x30,0x30,0x30,0x37,0x36,0x32,0x39,0x33,0x39,
-    0x34,0x35,0x33,0x31,0x32,0x35,0x20,0x2a,0x20,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6d,0x61,
-    0x28,0x31,0x2e,0x30,0x35,0x34,0x39,0x39,0x39,0x39,0x34,0x37,0x35,0x34,0x37,0x39,
-    0x31,0x32,0x35,0x39,0x37,0x36,0x35,0x36,0x32,0x35,0x2c,0x20,0x70,0x6f,0x77,0x28,
-    0x78,0x2c,0x20,0x30,0x2e,0x34,0x31,0x36,0x36,0x36,0x36,0x36,0x35,0x36,0x37,0x33,
-    0x32,0x35,0x35,0x39,0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x29,0x2c,
-    0x20,0x2d,0x30,0x2e,0x30,0x35,0x34,0x39,0x39,0x39,0x39,0x39,0x39,0x37,0x30,0x31,
-    0x39,0x37,0x36,0x37,0x37,0x36,0x31,0x32,0x33,0x30,0x34,0x36,0x38,0x37,0x35,0x29,
-    0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x20,0x6d,0x61,
-    0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,
-    0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,
-    0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,
-    0x20,0x66,0x73,0x5f,0x76,0x6f,0x6c,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,
-    0x5f,0x32,0x35,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,
+    0x6f,0x61,0x74,0x20,0x73,0x6b,0x69,0x70,0x5f,0x65,0x6d,0x70,0x74,0x79,0x28,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,
+    0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x65,0x79,0x65,0x2c,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x2c,0x20,0x63,0x6f,
+    0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x66,0x73,0x5f,0x76,0x6f,0x6c,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x32,0x35,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x33,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x76,0x6f,0x6c,0x75,
+    0x6d,0x65,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,
+    0x6f,0x61,0x74,0x3e,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x65,0x72,0x5f,0x74,0x61,
+    0x62,0x6c,0x65,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x33,0x64,0x3c,0x66,
+    0x6c,0x6f,0x61,0x74,0x3e,0x20,0x62,0x72,0x69,0x63,0x6b,0x5f,0x74,0x61,0x62,0x6c,
+    0x65,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x33,0x64,0x3c,0x66,0x6c,0x6f,
+    0x61,0x74,0x3e,0x20,0x62,0x72,0x69,0x63,0x6b,0x5f,0x61,0x74,0x6c,0x61,0x73,0x2c,
+    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x33,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,
+    0x3e,0x20,0x6f,0x63,0x63,0x75,0x70,0x61,0x6e,0x63,0x79,0x2c,0x20,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x73,0x63,
+    0x65,0x6e,0x65,0x5f,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x2c,0x20,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x20,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x73,0x6d,0x70,
+    0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,
+    0x65,0x72,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,
+    0x73,0x63,0x65,0x6e,0x65,0x5f,0x73,0x6d,0x70,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x63,0x65,0x6c,0x6c,0x5f,0x73,0x63,0x61,
+    0x6c,0x65,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x69,0x6e,0x74,0x33,
+    0x28,0x5f,0x32,0x35,0x2e,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x64,0x69,0x6d,0x73,
+    0x29,0x29,0x20,0x2f,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x5f,0x32,0x35,0x2e,0x63,
+    0x65,0x6c,0x6c,0x5f,0x73,0x69,0x7a,0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x6e,0x74,0x33,0x20,0x63,0x65,0x6c,0x6c,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,
+    0x28,0x69,0x6e,0x74,0x33,0x28,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x70,0x20,0x2a,0x20,
+    0x63,0x65,0x6c,0x6c,0x5f,0x73,0x63,0x61,0x6c,0x65,0x29,0x29,0x2c,0x20,0x69,0x6e,
+    0x74,0x33,0x28,0x30,0x2c,0x20,0x30,0x2c,0x20,0x30,0x29,0x2c,0x20,0x69,0x6e,0x74,
+    0x33,0x28,0x5f,0x32,0x35,0x2e,0x63,0x65,0x6c,0x6c,0x5f,0x64,0x69,0x6d,0x73,0x29,
+    0x20,0x2d,0x20,0x69,0x6e,0x74,0x33,0x28,0x31,0x2c,0x20,0x31,0x2c,0x20,0x31,0x29,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6f,0x63,0x63,0x75,0x70,
+    0x61,0x6e,0x63,0x79,0x2e,0x72,0x65,0x61,0x64,0x28,0x75,0x69,0x6e,0x74,0x33,0x28,
+    0x63,0x65,0x6c,0x6c,0x29,0x2c,0x20,0x30,0x29,0x2e,0x72,0x20,0x3e,0x20,0x30,0x2e,
+    0x30,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x65,0x78,0x69,0x74,0x5f,0x66,0x61,0x63,
+    0x65,0x20,0x3d,0x20,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x63,0x65,0x6c,0x6c,
+    0x29,0x20,0x2b,0x20,0x73,0x74,0x65,0x70,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,
+    0x30,0x2e,0x30,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x30,0x2e,0x30,0x29,0x2c,0x20,
+    0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x29,0x29,0x20,0x2f,0x20,0x63,0x65,0x6c,0x6c,
+    0x5f,0x73,0x63,0x61,0x6c,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x74,0x5f,0x65,0x78,0x69,0x74,0x20,0x3d,0x20,0x28,0x65,0x78,0x69,
+    0x74,0x5f,0x66,0x61,0x63,0x65,0x20,0x2d,0x20,0x65,0x79,0x65,0x29,0x20,0x2f,0x20,
+    0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x6d,0x69,0x6e,0x28,0x74,0x5f,0x65,0x78,0x69,0x74,0x2e,0x78,
+    0x2c,0x20,0x6d,0x69,0x6e,0x28,0x74,0x5f,0x65,0x78,0x69,0x74,0x2e,0x79,0x2c,0x20,
+    0x74,0x5f,0x65,0x78,0x69,0x74,0x2e,0x7a,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,
+    0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,
+    0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x65,0x72,0x5f,0x73,0x65,0x67,0x6d,
+    0x65,0x6e,0x74,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x66,0x72,0x6f,0x6e,0x74,0x2c,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x62,0x61,0x63,0x6b,0x2c,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x61,0x6e,0x74,0x20,0x66,0x73,0x5f,0x76,0x6f,0x6c,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x26,0x20,0x5f,0x32,0x35,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x33,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x76,0x6f,0x6c,0x75,0x6d,
+    0x65,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,
+    0x61,0x74,0x3e,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x65,0x72,0x5f,0x74,0x61,0x62,
+    0x6c,0x65,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x33,0x64,0x3c,0x66,0x6c,
+    0x6f,0x61,0x74,0x3e,0x20,0x62,0x72,0x69,0x63,0x6b,0x5f,0x74,0x61,0x62,0x6c,0x65,
+    0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x33,0x64,0x3c,0x66,0x6c,0x6f,0x61,
+    0x74,0x3e,0x20,0x62,0x72,0x69,0x63,0x6b,0x5f,0x61,0x74,0x6c,0x61,0x73,0x2c,0x20,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x33,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,
+    0x20,0x6f,0x63,0x63,0x75,0x70,0x61,0x6e,0x63,0x79,0x2c,0x20,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x73,0x63,0x65,
+    0x6e,0x65,0x5f,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x2c,0x20,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x20,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x73,0x6d,0x70,0x2c,
+    0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x65,
+    0x72,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x73,
+    0x63,0x65,0x6e,0x65,0x5f,0x73,0x6d,0x70,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x65,0x72,0x5f,
+    0x74,0x61,0x62,0x6c,0x65,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x74,0x72,0x61,
+    0x6e,0x73,0x66,0x65,0x72,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x28,0x66,0x72,0x6f,0x6e,0x74,0x2c,0x20,0x62,0x61,0x63,0x6b,0x29,0x20,0x2a,
+    0x20,0x28,0x32,0x35,0x35,0x2e,0x30,0x20,0x2f,0x20,0x32,0x35,0x36,0x2e,0x30,0x29,
+    0x20,0x2b,0x20,0x30,0x2e,0x35,0x20,0x2f,0x20,0x32,0x35,0x36,0x2e,0x30,0x29,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,
+    0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,
+    0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,
+    0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x77,0x61,0x6e,0x67,0x5f,0x68,0x61,0x73,0x68,
+    0x28,0x69,0x6e,0x74,0x20,0x73,0x65,0x65,0x64,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x73,0x65,0x65,0x64,0x20,0x3d,0x20,0x28,0x73,0x65,0x65,0x64,0x20,0x5e,0x20,
+    0x36,0x31,0x29,0x20,0x5e,0x20,0x28,0x73,0x65,0x65,0x64,0x20,0x3e,0x3e,0x20,0x31,
+    0x36,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x65,0x65,0x64,0x20,0x2a,0x3d,0x20,
+    0x39,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x65,0x65,0x64,0x20,0x3d,0x20,0x73,0x65,
+    0x65,0x64,0x20,0x5e,0x20,0x28,0x73,0x65,0x65,0x64,0x20,0x3e,0x3e,0x20,0x34,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x65,0x65,0x64,0x20,0x2a,0x3d,0x20,0x30,0x78,
+    0x32,0x37,0x64,0x34,0x65,0x62,0x32,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x65,
+    0x65,0x64,0x20,0x3d,0x20,0x73,0x65,0x65,0x64,0x20,0x5e,0x20,0x28,0x73,0x65,0x65,
+    0x64,0x20,0x3e,0x3e,0x20,0x31,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x73,0x65,0x65,0x64,0x20,
+    0x25,0x20,0x32,0x31,0x34,0x37,0x34,0x38,0x33,0x36,0x34,0x37,0x29,0x20,0x2f,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x28,0x32,0x31,0x34,0x37,0x34,0x38,0x33,0x36,0x34,0x37,
+    0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,
+    0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,
+    0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x5f,
+    0x74,0x6f,0x5f,0x73,0x72,0x67,0x62,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x78,0x29,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x78,0x20,0x3c,0x3d,0x20,
+    0x30,0x2e,0x30,0x30,0x33,0x31,0x33,0x30,0x38,0x66,0x29,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x31,0x32,0x2e,
+    0x39,0x32,0x66,0x20,0x2a,0x20,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x31,0x2e,0x30,0x35,0x35,0x66,
+    0x20,0x2a,0x20,0x70,0x6f,0x77,0x28,0x78,0x2c,0x20,0x31,0x2e,0x66,0x20,0x2f,0x20,
+    0x32,0x2e,0x34,0x66,0x29,0x20,0x2d,0x20,0x30,0x2e,0x30,0x35,0x35,0x66,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,
+    0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,
+    0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x69,0x6e,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x66,
+    0x73,0x5f,0x76,0x6f,0x6c,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x32,
+    0x35,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,
+    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x33,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,
+    0x3e,0x20,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,
+    0x65,0x72,0x5f,0x74,0x61,0x62,0x6c,0x65,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x28,0x31,0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x33,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x62,0x72,0x69,0x63,0x6b,0x5f,
+    0x74,0x61,0x62,0x6c,0x65,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,
+    0x32,0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x33,0x64,0x3c,
+    0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x62,0x72,0x69,0x63,0x6b,0x5f,0x61,0x74,0x6c,
+    0x61,0x73,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x33,0x29,0x5d,
     0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x33,0x64,0x3c,0x66,0x6c,0x6f,
-    0x61,0x74,0x3e,0x20,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x20,0x5b,0x5b,0x74,0x65,0x78,
-    0x74,0x75,0x72,0x65,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,
-    0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x63,0x6f,0x6c,0x6f,
-    0x72,0x6d,0x61,0x70,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x31,
-    0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x76,0x6f,0x6c,
-    0x75,0x6d,0x65,0x5f,0x73,0x6d,0x70,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,
-    0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,
-    0x63,0x6f,0x6c,0x6f,0x72,0x6d,0x61,0x70,0x5f,0x73,0x6d,0x70,0x20,0x5b,0x5b,0x73,
-    0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x31,0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,
-    0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,
-    0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x33,0x20,0x5f,0x31,0x30,0x39,0x20,0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6e,
-    0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x69,0x6e,0x2e,0x76,0x72,0x61,0x79,
-    0x5f,0x64,0x69,0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x74,0x72,0x61,
-    0x6e,0x73,0x66,0x6f,0x72,0x6d,0x65,0x64,0x5f,0x65,0x79,0x65,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,
-    0x20,0x3d,0x20,0x5f,0x31,0x30,0x39,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x32,0x20,0x5f,0x31,0x31,0x37,0x20,0x3d,0x20,0x69,0x6e,0x74,0x65,0x72,
-    0x73,0x65,0x63,0x74,0x5f,0x62,0x6f,0x78,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x2c,0x20,0x5f,0x32,0x35,0x29,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x5f,0x68,0x69,0x74,0x20,
-    0x3d,0x20,0x5f,0x31,0x31,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
-    0x5f,0x31,0x31,0x37,0x2e,0x78,0x20,0x3e,0x20,0x5f,0x31,0x31,0x37,0x2e,0x79,0x29,
-    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,
-    0x69,0x73,0x63,0x61,0x72,0x64,0x5f,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x28,
-    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x32,0x20,0x5f,0x32,0x37,0x34,0x20,0x3d,0x20,0x74,0x5f,0x68,0x69,0x74,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x32,0x39,
-    0x20,0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,0x61,0x78,0x28,0x5f,0x32,0x37,
-    0x34,0x2e,0x78,0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x32,0x37,0x36,0x20,0x3d,0x20,0x5f,0x32,0x37,
-    0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x32,0x37,0x36,0x2e,0x78,0x20,0x3d,0x20,
-    0x5f,0x31,0x32,0x39,0x3b,0x0a,0x20,0x20,0x20,0x20,0x74,0x5f,0x68,0x69,0x74,0x20,
-    0x3d,0x20,0x5f,0x32,0x37,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x33,0x20,0x5f,0x31,0x34,0x31,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
-    0x28,0x31,0x2e,0x30,0x29,0x20,0x2f,0x20,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,
-    0x69,0x6e,0x74,0x33,0x28,0x5f,0x32,0x35,0x2e,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,
-    0x64,0x69,0x6d,0x73,0x29,0x29,0x20,0x2a,0x20,0x61,0x62,0x73,0x28,0x5f,0x31,0x30,
-    0x39,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,
-    0x31,0x35,0x30,0x20,0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,0x69,0x6e,0x28,
-    0x5f,0x31,0x34,0x31,0x2e,0x78,0x2c,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,0x69,
-    0x6e,0x28,0x5f,0x31,0x34,0x31,0x2e,0x79,0x2c,0x20,0x5f,0x31,0x34,0x31,0x2e,0x7a,
-    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x46,0x72,0x61,0x67,
-    0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x30,
-    0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,
-    0x70,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,
-    0x65,0x64,0x5f,0x65,0x79,0x65,0x20,0x2b,0x20,0x28,0x5f,0x31,0x30,0x39,0x20,0x2a,
-    0x20,0x5f,0x31,0x32,0x39,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,
-    0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x20,0x3d,0x20,0x5f,0x31,0x32,0x39,0x3b,
-    0x20,0x74,0x20,0x3c,0x20,0x74,0x5f,0x68,0x69,0x74,0x2e,0x79,0x3b,0x20,0x74,0x20,
-    0x2b,0x3d,0x20,0x5f,0x31,0x35,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x31,
-    0x38,0x36,0x20,0x3d,0x20,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x2e,0x73,0x61,0x6d,0x70,
-    0x6c,0x65,0x28,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x70,
-    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x20,0x5f,0x31,0x38,0x37,0x20,0x3d,0x20,0x5f,0x31,0x38,0x36,0x2e,0x78,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,
-    0x31,0x35,0x20,0x3d,0x20,0x6f,0x75,0x74,0x2e,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,
-    0x6f,0x72,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,
-    0x6f,0x61,0x74,0x34,0x20,0x5f,0x32,0x32,0x33,0x20,0x3d,0x20,0x6f,0x75,0x74,0x2e,
-    0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x32,0x32,0x35,0x20,0x3d,
-    0x20,0x5f,0x32,0x32,0x33,0x2e,0x78,0x79,0x7a,0x20,0x2b,0x20,0x28,0x66,0x6c,0x6f,
-    0x61,0x74,0x34,0x28,0x63,0x6f,0x6c,0x6f,0x72,0x6d,0x61,0x70,0x2e,0x73,0x61,0x6d,
-    0x70,0x6c,0x65,0x28,0x63,0x6f,0x6c,0x6f,0x72,0x6d,0x61,0x70,0x5f,0x73,0x6d,0x70,
-    0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x66,0x6d,0x61,0x28,0x5f,0x31,0x38,
-    0x37,0x2c,0x20,0x30,0x2e,0x39,0x39,0x39,0x30,0x30,0x30,0x30,0x31,0x32,0x38,0x37,
-    0x34,0x36,0x30,0x33,0x32,0x37,0x31,0x34,0x38,0x34,0x33,0x37,0x35,0x2c,0x20,0x30,
-    0x2e,0x30,0x30,0x30,0x35,0x30,0x30,0x30,0x30,0x30,0x30,0x32,0x33,0x37,0x34,0x38,
-    0x37,0x32,0x35,0x36,0x35,0x32,0x36,0x39,0x34,0x37,0x30,0x32,0x31,0x34,0x38,0x34,
-    0x33,0x37,0x35,0x29,0x2c,0x20,0x30,0x2e,0x35,0x29,0x29,0x2e,0x78,0x79,0x7a,0x2c,
-    0x20,0x5f,0x31,0x38,0x37,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x28,0x28,0x31,
-    0x2e,0x30,0x20,0x2d,0x20,0x5f,0x32,0x31,0x35,0x29,0x20,0x2a,0x20,0x5f,0x31,0x38,
-    0x37,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,
-    0x2e,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x78,0x20,0x3d,0x20,0x5f,
-    0x32,0x32,0x35,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,
-    0x75,0x74,0x2e,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x79,0x20,0x3d,
-    0x20,0x5f,0x32,0x32,0x35,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x6f,0x75,0x74,0x2e,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x7a,
-    0x20,0x3d,0x20,0x5f,0x32,0x32,0x35,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,
-    0x2e,0x77,0x20,0x3d,0x20,0x66,0x6d,0x61,0x28,0x31,0x2e,0x30,0x20,0x2d,0x20,0x6f,
-    0x75,0x74,0x2e,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x77,0x2c,0x20,
-    0x5f,0x31,0x38,0x37,0x2c,0x20,0x6f,0x75,0x74,0x2e,0x46,0x72,0x61,0x67,0x43,0x6f,
-    0x6c,0x6f,0x72,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x69,0x66,0x20,0x28,0x6f,0x75,0x74,0x2e,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,
-    0x72,0x2e,0x77,0x20,0x3e,0x3d,0x20,0x30,0x2e,0x39,0x38,0x30,0x30,0x30,0x30,0x30,
-    0x31,0x39,0x30,0x37,0x33,0x34,0x38,0x36,0x33,0x32,0x38,0x31,0x32,0x35,0x29,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x72,0x65,0x61,0x6b,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,
-    0x20,0x2b,0x3d,0x20,0x28,0x5f,0x31,0x30,0x39,0x20,0x2a,0x20,0x5f,0x31,0x35,0x30,
-    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x6f,0x75,0x74,
-    0x2e,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x78,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x6f,0x75,0x74,0x2e,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,
-    0x78,0x20,0x3d,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x5f,0x74,0x6f,0x5f,0x73,0x72,
-    0x67,0x62,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,
-    0x20,0x6f,0x75,0x74,0x2e,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x79,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x46,0x72,0x61,0x67,0x43,0x6f,
-    0x6c,0x6f,0x72,0x2e,0x79,0x20,0x3d,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x5f,0x74,
-    0x6f,0x5f,0x73,0x72,0x67,0x62,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x29,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x34,0x20,0x3d,0x20,0x6f,0x75,0x74,0x2e,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,
-    0x6f,0x72,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x46,0x72,
-    0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x7a,0x20,0x3d,0x20,0x6c,0x69,0x6e,0x65,
-    0x61,0x72,0x5f,0x74,0x6f,0x5f,0x73,0x72,0x67,0x62,0x28,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
-    0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+    0x61,0x74,0x3e,0x20,0x6f,0x63,0x63,0x75,0x70,0x61,0x6e,0x63,0x79,0x20,0x5b,0x5b,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x34,0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x73,
+    0x63,0x65,0x6e,0x65,0x5f,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x20,0x5b,0x5b,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x35,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x20,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x73,0x6d,0x70,
+    0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,
+    0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x65,
+    0x72,0x5f,0x73,0x6d,0x70,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,
+    0x31,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x73,0x63,
+    0x65,0x6e,0x65,0x5f,0x73,0x6d,0x70,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,
+    0x72,0x28,0x32,0x29,0x5d,0x5d,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,
+    0x6c,0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6f,0x72,0x64,0x20,0x5b,0x5b,0x70,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,
+    0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x72,
+    0x61,0x79,0x5f,0x64,0x69,0x72,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,
+    0x7a,0x65,0x28,0x69,0x6e,0x2e,0x76,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x29,0x3b,
+    0x0a,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x5f,0x68,
+    0x69,0x74,0x20,0x3d,0x20,0x69,0x6e,0x74,0x65,0x72,0x73,0x65,0x63,0x74,0x5f,0x62,
+    0x6f,0x78,0x28,0x69,0x6e,0x2e,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x65,
+    0x64,0x5f,0x65,0x79,0x65,0x2c,0x20,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x2c,0x20,
+    0x5f,0x32,0x35,0x2c,0x20,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x2c,0x20,0x74,0x72,0x61,
+    0x6e,0x73,0x66,0x65,0x72,0x5f,0x74,0x61,0x62,0x6c,0x65,0x2c,0x20,0x62,0x72,0x69,
+    0x63,0x6b,0x5f,0x74,0x61,0x62,0x6c,0x65,0x2c,0x20,0x62,0x72,0x69,0x63,0x6b,0x5f,
+    0x61,0x74,0x6c,0x61,0x73,0x2c,0x20,0x6f,0x63,0x63,0x75,0x70,0x61,0x6e,0x63,0x79,
+    0x2c,0x20,0x73,0x63,0x65,0x6e,0x65,0x5f,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,
+    0x2c,0x20,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x74,0x72,
+    0x61,0x6e,0x73,0x66,0x65,0x72,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x73,0x63,0x65,0x6e,
+    0x65,0x5f,0x73,0x6d,0x70,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x74,0x5f,0x68,0x69,0x74,0x2e,0x78,0x20,0x3e,0x20,0x74,0x5f,0x68,0x69,0x74,0x2e,
+    0x79,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x69,0x73,
+    0x63,0x61,0x72,0x64,0x5f,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x28,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x74,0x5f,0x68,0x69,0x74,
+    0x2e,0x78,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x74,0x5f,0x68,0x69,0x74,0x2e,0x78,
+    0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x32,0x20,0x73,0x63,0x65,0x6e,0x65,0x5f,0x70,0x69,0x78,0x65,0x6c,0x20,0x3d,0x20,
+    0x6d,0x69,0x6e,0x28,0x69,0x6e,0x74,0x32,0x28,0x67,0x6c,0x5f,0x46,0x72,0x61,0x67,
+    0x43,0x6f,0x6f,0x72,0x64,0x2e,0x78,0x79,0x20,0x2a,0x20,0x5f,0x32,0x35,0x2e,0x73,
+    0x63,0x65,0x6e,0x65,0x5f,0x73,0x63,0x61,0x6c,0x65,0x29,0x2c,0x20,0x5f,0x32,0x35,
+    0x2e,0x73,0x63,0x65,0x6e,0x65,0x5f,0x73,0x69,0x7a,0x65,0x20,0x2d,0x20,0x69,0x6e,
+    0x74,0x32,0x28,0x31,0x2c,0x20,0x31,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x6d,0x65,0x73,0x68,0x5f,0x64,0x69,0x73,0x74,0x61,0x6e,
+    0x63,0x65,0x20,0x3d,0x20,0x73,0x63,0x65,0x6e,0x65,0x5f,0x64,0x69,0x73,0x74,0x61,
+    0x6e,0x63,0x65,0x2e,0x72,0x65,0x61,0x64,0x28,0x75,0x69,0x6e,0x74,0x32,0x28,0x73,
+    0x63,0x65,0x6e,0x65,0x5f,0x70,0x69,0x78,0x65,0x6c,0x29,0x2c,0x20,0x30,0x29,0x2e,
+    0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x74,0x5f,0x68,0x69,0x74,0x2e,0x79,0x20,0x3d,
+    0x20,0x6d,0x69,0x6e,0x28,0x74,0x5f,0x68,0x69,0x74,0x2e,0x79,0x2c,0x20,0x6d,0x65,
+    0x73,0x68,0x5f,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x20,0x2f,0x20,0x6c,0x65,
+    0x6e,0x67,0x74,0x68,0x28,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x20,0x2a,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x28,0x5f,0x32,0x35,0x2e,0x76,0x6f,0x6c,0x75,0x6d,0x65,
+    0x5f,0x65,0x78,0x74,0x65,0x6e,0x74,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x74,0x5f,0x68,0x69,0x74,0x2e,0x78,0x20,0x3e,0x3d,0x20,0x74,
+    0x5f,0x68,0x69,0x74,0x2e,0x79,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x5f,0x66,0x72,0x61,0x67,0x6d,0x65,
+    0x6e,0x74,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x64,0x74,0x5f,0x76,0x65,0x63,0x20,0x3d,
+    0x20,0x31,0x2e,0x30,0x20,0x2f,0x20,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x69,
+    0x6e,0x74,0x33,0x28,0x5f,0x32,0x35,0x2e,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x64,
+    0x69,0x6d,0x73,0x29,0x29,0x20,0x2a,0x20,0x61,0x62,0x73,0x28,0x72,0x61,0x79,0x5f,
+    0x64,0x69,0x72,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x64,0x74,0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,0x64,0x74,0x5f,0x76,0x65,0x63,
+    0x2e,0x78,0x2c,0x20,0x6d,0x69,0x6e,0x28,0x64,0x74,0x5f,0x76,0x65,0x63,0x2e,0x79,
+    0x2c,0x20,0x64,0x74,0x5f,0x76,0x65,0x63,0x2e,0x7a,0x29,0x29,0x3b,0x0a,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6d,0x69,0x6e,0x5f,0x73,0x74,0x65,
+    0x70,0x20,0x3d,0x20,0x5f,0x32,0x35,0x2e,0x6d,0x61,0x72,0x63,0x68,0x2e,0x78,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6d,0x61,0x78,0x5f,0x73,
+    0x74,0x65,0x70,0x20,0x3d,0x20,0x5f,0x32,0x35,0x2e,0x6d,0x61,0x72,0x63,0x68,0x2e,
+    0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x65,0x66,
+    0x69,0x6e,0x65,0x5f,0x6f,0x70,0x61,0x63,0x69,0x74,0x79,0x20,0x3d,0x20,0x5f,0x32,
+    0x35,0x2e,0x6d,0x61,0x72,0x63,0x68,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x61,0x6c,0x70,0x68,0x61,0x5f,0x63,0x75,0x74,0x6f,0x66,
+    0x66,0x20,0x3d,0x20,0x5f,0x32,0x35,0x2e,0x6d,0x61,0x72,0x63,0x68,0x2e,0x77,0x3b,
+    0x0a,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x46,0x72,0x61,0x67,0x43,0x6f,
+    0x6c,0x6f,0x72,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x30,0x2e,0x30,
+    0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x30,0x2e,0x30,0x29,
+    0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x74,0x65,
+    0x70,0x73,0x20,0x3d,0x20,0x28,0x74,0x5f,0x68,0x69,0x74,0x2e,0x79,0x20,0x2d,0x20,
+    0x74,0x5f,0x68,0x69,0x74,0x2e,0x78,0x29,0x20,0x2f,0x20,0x64,0x74,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x20,0x3d,0x20,0x5f,0x32,0x35,
+    0x2e,0x6a,0x69,0x74,0x74,0x65,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x73,0x74,0x72,0x69,0x64,0x65,0x20,0x3d,0x20,0x31,0x2e,0x30,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x72,0x65,0x76,0x5f,
+    0x76,0x61,0x6c,0x20,0x3d,0x20,0x2d,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x73,0x20,0x3c,0x20,0x73,0x74,0x65,0x70,0x73,
+    0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x74,0x20,0x3d,0x20,0x74,0x5f,0x68,0x69,0x74,0x2e,0x78,0x20,0x2b,0x20,
+    0x73,0x20,0x2a,0x20,0x64,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x74,0x72,
+    0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x65,0x64,0x5f,0x65,0x79,0x65,0x20,0x2b,0x20,
+    0x74,0x20,0x2a,0x20,0x72,0x61,0x79,0x5f,0x64,0x69,0x72,0x3b,0x0a,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x5f,0x73,0x6b,
+    0x69,0x70,0x20,0x3d,0x20,0x73,0x6b,0x69,0x70,0x5f,0x65,0x6d,0x70,0x74,0x79,0x28,
+    0x70,0x2c,0x20,0x74,0x2c,0x20,0x69,0x6e,0x2e,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,
+    0x72,0x6d,0x65,0x64,0x5f,0x65,0x79,0x65,0x2c,0x20,0x72,0x61,0x79,0x5f,0x64,0x69,
+    0x72,0x2c,0x20,0x5f,0x32,0x35,0x2c,0x20,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x2c,0x20,
+    0x74,0x72,0x61,0x6e,0x73,0x66,0x65,0x72,0x5f,0x74,0x61,0x62,0x6c,0x65,0x2c,0x20,
+    0x62,0x72,0x69,0x63,0x6b,0x5f,0x74,0x61,0x62,0x6c,0x65,0x2c,0x20,0x62,0x72,0x69,
+    0x63,0x6b,0x5f,0x61,0x74,0x6c,0x61,0x73,0x2c,0x20,0x6f,0x63,0x63,0x75,0x70,0x61,
+    0x6e,0x63,0x79,0x2c,0x20,0x73,0x63,0x65,0x6e,0x65,0x5f,0x64,0x69,0x73,0x74,0x61,
+    0x6e,0x63,0x65,0x2c,0x20,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x73,0x6d,0x70,0x2c,
+    0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x65,0x72,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x73,
+    0x63,0x65,0x6e,0x65,0x5f,0x73,0x6d,0x70,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x5f,0x73,0x6b,0x69,0x70,0x20,0x3e,0x20,
+    0x74,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x73,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x28,
+    0x74,0x5f,0x73,0x6b,0x69,0x70,0x20,0x2d,0x20,0x74,0x5f,0x68,0x69,0x74,0x2e,0x78,
+    0x29,0x20,0x2f,0x20,0x64,0x74,0x20,0x2d,0x20,0x5f,0x32,0x35,0x2e,0x6a,0x69,0x74,
+    0x74,0x65,0x72,0x29,0x20,0x2b,0x20,0x5f,0x32,0x35,0x2e,0x6a,0x69,0x74,0x74,0x65,
+    0x72,0x2c,0x20,0x73,0x20,0x2b,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x74,0x72,0x69,0x64,0x65,0x20,
+    0x3d,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x70,0x72,0x65,0x76,0x5f,0x76,0x61,0x6c,0x20,0x3d,0x20,0x2d,0x31,
+    0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x76,0x61,0x6c,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x73,
+    0x61,0x6d,0x70,0x6c,0x65,0x5f,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x28,0x70,0x2c,0x20,
+    0x72,0x61,0x79,0x5f,0x6c,0x6f,0x64,0x28,0x74,0x2c,0x20,0x72,0x61,0x79,0x5f,0x64,
+    0x69,0x72,0x2c,0x20,0x5f,0x32,0x35,0x2c,0x20,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x2c,
+    0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x65,0x72,0x5f,0x74,0x61,0x62,0x6c,0x65,0x2c,
+    0x20,0x62,0x72,0x69,0x63,0x6b,0x5f,0x74,0x61,0x62,0x6c,0x65,0x2c,0x20,0x62,0x72,
+    0x69,0x63,0x6b,0x5f,0x61,0x74,0x6c,0x61,0x73,0x2c,0x20,0x6f,0x63,0x63,0x75,0x70,
+    0x61,0x6e,0x63,0x79,0x2c,0x20,0x73,0x63,0x65,0x6e,0x65,0x5f,0x64,0x69,0x73,0x74,
+    0x61,0x6e,0x63,0x65,0x2c,0x20,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x5f,0x73,0x6d,0x70,
+    0x2c,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x65,0x72,0x5f,0x73,0x6d,0x70,0x2c,0x20,
+    0x73,0x63,0x65,0x6e,0x65,0x5f,0x73,0x6d,0x70,0x29,0x2c,0x20,0x5f,0x32,0x35,0x2c,
+    0x20,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x2c,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x65,
+    0x72,0x5f,0x74,0x61,0x62,0x6c,0x65,0x2c,0x20,0x62,0x72,0x69,0x63,0x6b,0x5f,0x74,
+    0x61,0x62,0x6c,0x65,0x2c,0x20,0x62,0x72,0x69,0x63,0x6b,0x5f,0x61,0x74,0x6c,0x61,
+    0x73,0x2c,0x20,0x6f,0x63,0x63,0x75,0x70,0x61,0x6e,0x63,0x79,0x2c,0x20,0x73,0x63,
+    0x65,0x6e,0x65,0x5f,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x2c,0x20,0x76,0x6f,
+    0x6c,0x75,0x6d,0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,
+    0x65,0x72,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x73,0x63,0x65,0x6e,0x65,0x5f,0x73,0x6d,
+    0x70,0x29,0x20,0x2a,0x20,0x5f,0x32,0x35,0x2e,0x76,0x61,0x6c,0x75,0x65,0x5f,0x73,
+    0x63,0x61,0x6c,0x65,0x20,0x2b,0x20,0x5f,0x32,0x35,0x2e,0x76,0x61,0x6c,0x75,0x65,
+    0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,
+    0x30,0x29,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,
+    0x6c,0x20,0x66,0x61,0x69,0x6e,0x74,0x20,0x3d,0x20,0x76,0x61,0x6c,0x20,0x3c,0x3d,
+    0x20,0x72,0x65,0x66,0x69,0x6e,0x65,0x5f,0x6f,0x70,0x61,0x63,0x69,0x74,0x79,0x20,
+    0x26,0x26,0x20,0x61,0x62,0x73,0x28,0x76,0x61,0x6c,0x20,0x2d,0x20,0x70,0x72,0x65,
+    0x76,0x5f,0x76,0x61,0x6c,0x29,0x20,0x3c,0x3d,0x20,0x72,0x65,0x66,0x69,0x6e,0x65,
+    0x5f,0x6f,0x70,0x61,0x63,0x69,0x74,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x73,0x74,0x72,0x69,0x64,0x65,0x20,0x3e,0x20,0x6d,
+    0x69,0x6e,0x5f,0x73,0x74,0x65,0x70,0x20,0x26,0x26,0x20,0x21,0x66,0x61,0x69,0x6e,
+    0x74,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x73,0x20,0x2d,0x3d,0x20,0x73,0x74,0x72,0x69,0x64,0x65,0x20,0x2d,0x20,0x6d,
+    0x69,0x6e,0x5f,0x73,0x74,0x65,0x70,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x73,0x74,0x72,0x69,0x64,0x65,0x20,0x3d,0x20,0x6d,0x69,
+    0x6e,0x5f,0x73,0x74,0x65,0x70,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x20,
+    0x3d,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x65,0x72,0x5f,0x73,0x65,0x67,0x6d,0x65,
+    0x6e,0x74,0x28,0x70,0x72,0x65,0x76,0x5f,0x76,0x61,0x6c,0x20,0x3c,0x20,0x30,0x2e,
+    0x30,0x20,0x3f,0x20,0x76,0x61,0x6c,0x20,0x3a,0x20,0x70,0x72,0x65,0x76,0x5f,0x76,
+    0x61,0x6c,0x2c,0x20,0x76,0x61,0x6c,0x2c,0x20,0x5f,0x32,0x35,0x2c,0x20,0x76,0x6f,
+    0x6c,0x75,0x6d,0x65,0x2c,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x65,0x72,0x5f,0x74,
+    0x61,0x62,0x6c,0x65,0x2c,0x20,0x62,0x72,0x69,0x63,0x6b,0x5f,0x74,0x61,0x62,0x6c,
+    0x65,0x2c,0x20,0x62,0x72,0x69,0x63,0x6b,0x5f,0x61,0x74,0x6c,0x61,0x73,0x2c,0x20,
+    0x6f,0x63,0x63,0x75,0x70,0x61,0x6e,0x63,0x79,0x2c,0x20,0x73,0x63,0x65,0x6e,0x65,
+    0x5f,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x2c,0x20,0x76,0x6f,0x6c,0x75,0x6d,
+    0x65,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x65,0x72,0x5f,
+    0x73,0x6d,0x70,0x2c,0x20,0x73,0x63,0x65,0x6e,0x65,0x5f,0x73,0x6d,0x70,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x61,
+    0x6c,0x70,0x68,0x61,0x20,0x3d,0x20,0x31,0x2e,0x30,0x20,0x2d,0x20,0x70,0x6f,0x77,
+    0x28,0x31,0x2e,0x30,0x20,0x2d,0x20,0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x2e,0x61,
+    0x2c,0x20,0x73,0x74,0x72,0x69,0x64,0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,
+    0x3d,0x20,0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x2e,0x72,0x67,0x62,0x20,0x2a,0x20,
+    0x28,0x61,0x6c,0x70,0x68,0x61,0x20,0x2f,0x20,0x6d,0x61,0x78,0x28,0x73,0x65,0x67,
+    0x6d,0x65,0x6e,0x74,0x2e,0x61,0x2c,0x20,0x31,0x65,0x2d,0x36,0x29,0x29,0x3b,0x0a,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x46,0x72,0x61,
+    0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x72,0x67,0x62,0x20,0x2b,0x3d,0x20,0x28,0x31,
+    0x2e,0x30,0x20,0x2d,0x20,0x6f,0x75,0x74,0x2e,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,
+    0x6f,0x72,0x2e,0x61,0x29,0x20,0x2a,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x46,0x72,0x61,0x67,0x43,
+    0x6f,0x6c,0x6f,0x72,0x2e,0x61,0x20,0x2b,0x3d,0x20,0x28,0x31,0x2e,0x30,0x20,0x2d,
+    0x20,0x6f,0x75,0x74,0x2e,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x61,
+    0x29,0x20,0x2a,0x20,0x61,0x6c,0x70,0x68,0x61,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6f,0x75,0x74,0x2e,0x46,0x72,0x61,0x67,
+    0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x61,0x20,0x3e,0x3d,0x20,0x61,0x6c,0x70,0x68,0x61,
+    0x5f,0x63,0x75,0x74,0x6f,0x66,0x66,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x72,0x65,0x61,0x6b,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x70,0x72,0x65,0x76,0x5f,0x76,0x61,0x6c,0x20,0x3d,0x20,0x76,0x61,0x6c,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x74,0x72,0x69,0x64,0x65,0x20,0x3d,
+    0x20,0x66,0x61,0x69,0x6e,0x74,0x20,0x3f,0x20,0x6d,0x69,0x6e,0x28,0x73,0x74,0x72,
+    0x69,0x64,0x65,0x20,0x2a,0x20,0x32,0x2e,0x30,0x2c,0x20,0x6d,0x61,0x78,0x5f,0x73,
+    0x74,0x65,0x70,0x29,0x20,0x3a,0x20,0x6d,0x69,0x6e,0x5f,0x73,0x74,0x65,0x70,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x20,0x2b,0x3d,0x20,0x73,0x74,
+    0x72,0x69,0x64,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x6f,0x75,0x74,0x2e,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x72,0x20,
+    0x3d,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x5f,0x74,0x6f,0x5f,0x73,0x72,0x67,0x62,
+    0x28,0x6f,0x75,0x74,0x2e,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x72,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x46,0x72,0x61,0x67,0x43,
+    0x6f,0x6c,0x6f,0x72,0x2e,0x67,0x20,0x3d,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x5f,
+    0x74,0x6f,0x5f,0x73,0x72,0x67,0x62,0x28,0x6f,0x75,0x74,0x2e,0x46,0x72,0x61,0x67,
+    0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x67,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,
+    0x74,0x2e,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x62,0x20,0x3d,0x20,
+    0x6c,0x69,0x6e,0x65,0x61,0x72,0x5f,0x74,0x6f,0x5f,0x73,0x72,0x67,0x62,0x28,0x6f,
+    0x75,0x74,0x2e,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x62,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x00,
 };
 static inline const sg_shader_desc* volume_shader_desc(sg_backend backend) {
     if (backend == SG_BACKEND_GLCORE) {
@@ -1186,31 +2247,70 @@ static inline const sg_shader_desc* volume_shader_desc(sg_backend backend) {
             desc.vs.entry = "main";
             desc.vs.uniform_blocks[0].size = 112;
             desc.vs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.vs.uniform_blocks[0].uniforms[0].name = "vs_vol_params";
-            desc.vs.uniform_blocks[0].uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
-            desc.vs.uniform_blocks[0].uniforms[0].array_count = 7;
+            desc.vs.uniform_blocks[0].uniforms[0].name = "_20.proj_view";
+            desc.vs.uniform_blocks[0].uniforms[0].type = SG_UNIFORMTYPE_MAT4;
+            desc.vs.uniform_blocks[0].uniforms[0].array_count = 0;
+            desc.vs.uniform_blocks[0].uniforms[1].name = "_20.eye_pos";
+            desc.vs.uniform_blocks[0].uniforms[1].type = SG_UNIFORMTYPE_FLOAT3;
+            desc.vs.uniform_blocks[0].uniforms[1].array_count = 0;
+            desc.vs.uniform_blocks[0].uniforms[2].name = "_20.volume_scale";
+            desc.vs.uniform_blocks[0].uniforms[2].type = SG_UNIFORMTYPE_FLOAT3;
+            desc.vs.uniform_blocks[0].uniforms[2].array_count = 0;
+            desc.vs.uniform_blocks[0].uniforms[3].name = "_20.volume_translation";
+            desc.vs.uniform_blocks[0].uniforms[3].type = SG_UNIFORMTYPE_FLOAT3;
+            desc.vs.uniform_blocks[0].uniforms[3].array_count = 0;
             desc.fs.source = (const char*)fs_volume_source_glsl430;
             desc.fs.entry = "main";
-            desc.fs.uniform_blocks[0].size = 64;
+            desc.fs.uniform_blocks[0].size = 160;
             desc.fs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
             desc.fs.uniform_blocks[0].uniforms[0].name = "_25.volume_dims";
             desc.fs.uniform_blocks[0].uniforms[0].type = SG_UNIFORMTYPE_INT3;
             desc.fs.uniform_blocks[0].uniforms[0].array_count = 0;
-            desc.fs.uniform_blocks[0].uniforms[1].name = "_25.dt_scale";
-            desc.fs.uniform_blocks[0].uniforms[1].type = SG_UNIFORMTYPE_FLOAT;
+            desc.fs.uniform_blocks[0].uniforms[1].name = "_25.bricked";
+            desc.fs.uniform_blocks[0].uniforms[1].type = SG_UNIFORMTYPE_INT;
             desc.fs.uniform_blocks[0].uniforms[1].array_count = 0;
-            desc.fs.uniform_blocks[0].uniforms[2].name = "_25.near_clip";
-            desc.fs.uniform_blocks[0].uniforms[2].type = SG_UNIFORMTYPE_FLOAT;
+            desc.fs.uniform_blocks[0].uniforms[2].name = "_25.brick_size";
+            desc.fs.uniform_blocks[0].uniforms[2].type = SG_UNIFORMTYPE_INT;
             desc.fs.uniform_blocks[0].uniforms[2].array_count = 0;
-            desc.fs.uniform_blocks[0].uniforms[3].name = "_25.far_clip";
-            desc.fs.uniform_blocks[0].uniforms[3].type = SG_UNIFORMTYPE_FLOAT;
+            desc.fs.uniform_blocks[0].uniforms[3].name = "_25.new_box_min";
+            desc.fs.uniform_blocks[0].uniforms[3].type = SG_UNIFORMTYPE_FLOAT3;
             desc.fs.uniform_blocks[0].uniforms[3].array_count = 0;
-            desc.fs.uniform_blocks[0].uniforms[4].name = "_25.new_box_min";
+            desc.fs.uniform_blocks[0].uniforms[4].name = "_25.new_box_max";
             desc.fs.uniform_blocks[0].uniforms[4].type = SG_UNIFORMTYPE_FLOAT3;
             desc.fs.uniform_blocks[0].uniforms[4].array_count = 0;
-            desc.fs.uniform_blocks[0].uniforms[5].name = "_25.new_box_max";
-            desc.fs.uniform_blocks[0].uniforms[5].type = SG_UNIFORMTYPE_FLOAT3;
+            desc.fs.uniform_blocks[0].uniforms[5].name = "_25.lod_scale";
+            desc.fs.uniform_blocks[0].uniforms[5].type = SG_UNIFORMTYPE_FLOAT;
             desc.fs.uniform_blocks[0].uniforms[5].array_count = 0;
+            desc.fs.uniform_blocks[0].uniforms[6].name = "_25.volume_extent";
+            desc.fs.uniform_blocks[0].uniforms[6].type = SG_UNIFORMTYPE_FLOAT3;
+            desc.fs.uniform_blocks[0].uniforms[6].array_count = 0;
+            desc.fs.uniform_blocks[0].uniforms[7].name = "_25.max_lod";
+            desc.fs.uniform_blocks[0].uniforms[7].type = SG_UNIFORMTYPE_FLOAT;
+            desc.fs.uniform_blocks[0].uniforms[7].array_count = 0;
+            desc.fs.uniform_blocks[0].uniforms[8].name = "_25.cell_dims";
+            desc.fs.uniform_blocks[0].uniforms[8].type = SG_UNIFORMTYPE_INT3;
+            desc.fs.uniform_blocks[0].uniforms[8].array_count = 0;
+            desc.fs.uniform_blocks[0].uniforms[9].name = "_25.cell_size";
+            desc.fs.uniform_blocks[0].uniforms[9].type = SG_UNIFORMTYPE_INT;
+            desc.fs.uniform_blocks[0].uniforms[9].array_count = 0;
+            desc.fs.uniform_blocks[0].uniforms[10].name = "_25.value_scale";
+            desc.fs.uniform_blocks[0].uniforms[10].type = SG_UNIFORMTYPE_FLOAT;
+            desc.fs.uniform_blocks[0].uniforms[10].array_count = 0;
+            desc.fs.uniform_blocks[0].uniforms[11].name = "_25.value_offset";
+            desc.fs.uniform_blocks[0].uniforms[11].type = SG_UNIFORMTYPE_FLOAT;
+            desc.fs.uniform_blocks[0].uniforms[11].array_count = 0;
+            desc.fs.uniform_blocks[0].uniforms[12].name = "_25.march";
+            desc.fs.uniform_blocks[0].uniforms[12].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.fs.uniform_blocks[0].uniforms[12].array_count = 0;
+            desc.fs.uniform_blocks[0].uniforms[13].name = "_25.jitter";
+            desc.fs.uniform_blocks[0].uniforms[13].type = SG_UNIFORMTYPE_FLOAT;
+            desc.fs.uniform_blocks[0].uniforms[13].array_count = 0;
+            desc.fs.uniform_blocks[0].uniforms[14].name = "_25.scene_scale";
+            desc.fs.uniform_blocks[0].uniforms[14].type = SG_UNIFORMTYPE_FLOAT2;
+            desc.fs.uniform_blocks[0].uniforms[14].array_count = 0;
+            desc.fs.uniform_blocks[0].uniforms[15].name = "_25.scene_size";
+            desc.fs.uniform_blocks[0].uniforms[15].type = SG_UNIFORMTYPE_INT2;
+            desc.fs.uniform_blocks[0].uniforms[15].array_count = 0;
             desc.fs.images[0].used = true;
             desc.fs.images[0].multisampled = false;
             desc.fs.images[0].image_type = SG_IMAGETYPE_3D;
@@ -1219,10 +2319,28 @@ static inline const sg_shader_desc* volume_shader_desc(sg_backend backend) {
             desc.fs.images[1].multisampled = false;
             desc.fs.images[1].image_type = SG_IMAGETYPE_2D;
             desc.fs.images[1].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.fs.images[2].used = true;
+            desc.fs.images[2].multisampled = false;
+            desc.fs.images[2].image_type = SG_IMAGETYPE_3D;
+            desc.fs.images[2].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.fs.images[3].used = true;
+            desc.fs.images[3].multisampled = false;
+            desc.fs.images[3].image_type = SG_IMAGETYPE_3D;
+            desc.fs.images[3].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.fs.images[4].used = true;
+            desc.fs.images[4].multisampled = false;
+            desc.fs.images[4].image_type = SG_IMAGETYPE_3D;
+            desc.fs.images[4].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.fs.images[5].used = true;
+            desc.fs.images[5].multisampled = false;
+            desc.fs.images[5].image_type = SG_IMAGETYPE_2D;
+            desc.fs.images[5].sample_type = SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT;
             desc.fs.samplers[0].used = true;
             desc.fs.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
             desc.fs.samplers[1].used = true;
             desc.fs.samplers[1].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.fs.samplers[2].used = true;
+            desc.fs.samplers[2].sampler_type = SG_SAMPLERTYPE_NONFILTERING;
             desc.fs.image_sampler_pairs[0].used = true;
             desc.fs.image_sampler_pairs[0].image_slot = 0;
             desc.fs.image_sampler_pairs[0].sampler_slot = 0;
@@ -1230,7 +2348,23 @@ static inline const sg_shader_desc* volume_shader_desc(sg_backend backend) {
             desc.fs.image_sampler_pairs[1].used = true;
             desc.fs.image_sampler_pairs[1].image_slot = 1;
             desc.fs.image_sampler_pairs[1].sampler_slot = 1;
-            desc.fs.image_sampler_pairs[1].glsl_name = "colormap_colormap_smp";
+            desc.fs.image_sampler_pairs[1].glsl_name = "transfer_table_transfer_smp";
+            desc.fs.image_sampler_pairs[2].used = true;
+            desc.fs.image_sampler_pairs[2].image_slot = 2;
+            desc.fs.image_sampler_pairs[2].sampler_slot = 0;
+            desc.fs.image_sampler_pairs[2].glsl_name = "brick_table_volume_smp";
+            desc.fs.image_sampler_pairs[3].used = true;
+            desc.fs.image_sampler_pairs[3].image_slot = 3;
+            desc.fs.image_sampler_pairs[3].sampler_slot = 0;
+            desc.fs.image_sampler_pairs[3].glsl_name = "brick_atlas_volume_smp";
+            desc.fs.image_sampler_pairs[4].used = true;
+            desc.fs.image_sampler_pairs[4].image_slot = 4;
+            desc.fs.image_sampler_pairs[4].sampler_slot = 0;
+            desc.fs.image_sampler_pairs[4].glsl_name = "occupancy_volume_smp";
+            desc.fs.image_sampler_pairs[5].used = true;
+            desc.fs.image_sampler_pairs[5].image_slot = 5;
+            desc.fs.image_sampler_pairs[5].sampler_slot = 2;
+            desc.fs.image_sampler_pairs[5].glsl_name = "scene_distance_scene_smp";
             desc.label = "volume_shader";
         }
         return &desc;
@@ -1250,7 +2384,7 @@ static inline const sg_shader_desc* volume_shader_desc(sg_backend backend) {
             desc.fs.source = (const char*)fs_volume_source_hlsl5;
             desc.fs.d3d11_target = "ps_5_0";
             desc.fs.entry = "main";
-            desc.fs.uniform_blocks[0].size = 64;
+            desc.fs.uniform_blocks[0].size = 160;
             desc.fs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
             desc.fs.images[0].used = true;
             desc.fs.images[0].multisampled = false;
@@ -1260,16 +2394,46 @@ static inline const sg_shader_desc* volume_shader_desc(sg_backend backend) {
             desc.fs.images[1].multisampled = false;
             desc.fs.images[1].image_type = SG_IMAGETYPE_2D;
             desc.fs.images[1].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.fs.images[2].used = true;
+            desc.fs.images[2].multisampled = false;
+            desc.fs.images[2].image_type = SG_IMAGETYPE_3D;
+            desc.fs.images[2].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.fs.images[3].used = true;
+            desc.fs.images[3].multisampled = false;
+            desc.fs.images[3].image_type = SG_IMAGETYPE_3D;
+            desc.fs.images[3].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.fs.images[4].used = true;
+            desc.fs.images[4].multisampled = false;
+            desc.fs.images[4].image_type = SG_IMAGETYPE_3D;
+            desc.fs.images[4].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.fs.images[5].used = true;
+            desc.fs.images[5].multisampled = false;
+            desc.fs.images[5].image_type = SG_IMAGETYPE_2D;
+            desc.fs.images[5].sample_type = SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT;
             desc.fs.samplers[0].used = true;
             desc.fs.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
             desc.fs.samplers[1].used = true;
             desc.fs.samplers[1].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.fs.samplers[2].used = true;
+            desc.fs.samplers[2].sampler_type = SG_SAMPLERTYPE_NONFILTERING;
             desc.fs.image_sampler_pairs[0].used = true;
             desc.fs.image_sampler_pairs[0].image_slot = 0;
             desc.fs.image_sampler_pairs[0].sampler_slot = 0;
             desc.fs.image_sampler_pairs[1].used = true;
             desc.fs.image_sampler_pairs[1].image_slot = 1;
             desc.fs.image_sampler_pairs[1].sampler_slot = 1;
+            desc.fs.image_sampler_pairs[2].used = true;
+            desc.fs.image_sampler_pairs[2].image_slot = 2;
+            desc.fs.image_sampler_pairs[2].sampler_slot = 0;
+            desc.fs.image_sampler_pairs[3].used = true;
+            desc.fs.image_sampler_pairs[3].image_slot = 3;
+            desc.fs.image_sampler_pairs[3].sampler_slot = 0;
+            desc.fs.image_sampler_pairs[4].used = true;
+            desc.fs.image_sampler_pairs[4].image_slot = 4;
+            desc.fs.image_sampler_pairs[4].sampler_slot = 0;
+            desc.fs.image_sampler_pairs[5].used = true;
+            desc.fs.image_sampler_pairs[5].image_slot = 5;
+            desc.fs.image_sampler_pairs[5].sampler_slot = 2;
             desc.label = "volume_shader";
         }
         return &desc;
@@ -1285,7 +2449,7 @@ static inline const sg_shader_desc* volume_shader_desc(sg_backend backend) {
             desc.vs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
             desc.fs.source = (const char*)fs_volume_source_metal_macos;
             desc.fs.entry = "main0";
-            desc.fs.uniform_blocks[0].size = 64;
+            desc.fs.uniform_blocks[0].size = 160;
             desc.fs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
             desc.fs.images[0].used = true;
             desc.fs.images[0].multisampled = false;
@@ -1295,16 +2459,46 @@ static inline const sg_shader_desc* volume_shader_desc(sg_backend backend) {
             desc.fs.images[1].multisampled = false;
             desc.fs.images[1].image_type = SG_IMAGETYPE_2D;
             desc.fs.images[1].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.fs.images[2].used = true;
+            desc.fs.images[2].multisampled = false;
+            desc.fs.images[2].image_type = SG_IMAGETYPE_3D;
+            desc.fs.images[2].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.fs.images[3].used = true;
+            desc.fs.images[3].multisampled = false;
+            desc.fs.images[3].image_type = SG_IMAGETYPE_3D;
+            desc.fs.images[3].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.fs.images[4].used = true;
+            desc.fs.images[4].multisampled = false;
+            desc.fs.images[4].image_type = SG_IMAGETYPE_3D;
+            desc.fs.images[4].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.fs.images[5].used = true;
+            desc.fs.images[5].multisampled = false;
+            desc.fs.images[5].image_type = SG_IMAGETYPE_2D;
+            desc.fs.images[5].sample_type = SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT;
             desc.fs.samplers[0].used = true;
             desc.fs.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
             desc.fs.samplers[1].used = true;
             desc.fs.samplers[1].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.fs.samplers[2].used = true;
+            desc.fs.samplers[2].sampler_type = SG_SAMPLERTYPE_NONFILTERING;
             desc.fs.image_sampler_pairs[0].used = true;
             desc.fs.image_sampler_pairs[0].image_slot = 0;
             desc.fs.image_sampler_pairs[0].sampler_slot = 0;
             desc.fs.image_sampler_pairs[1].used = true;
             desc.fs.image_sampler_pairs[1].image_slot = 1;
             desc.fs.image_sampler_pairs[1].sampler_slot = 1;
+            desc.fs.image_sampler_pairs[2].used = true;
+            desc.fs.image_sampler_pairs[2].image_slot = 2;
+            desc.fs.image_sampler_pairs[2].sampler_slot = 0;
+            desc.fs.image_sampler_pairs[3].used = true;
+            desc.fs.image_sampler_pairs[3].image_slot = 3;
+            desc.fs.image_sampler_pairs[3].sampler_slot = 0;
+            desc.fs.image_sampler_pairs[4].used = true;
+            desc.fs.image_sampler_pairs[4].image_slot = 4;
+            desc.fs.image_sampler_pairs[4].sampler_slot = 0;
+            desc.fs.image_sampler_pairs[5].used = true;
+            desc.fs.image_sampler_pairs[5].image_slot = 5;
+            desc.fs.image_sampler_pairs[5].sampler_slot = 2;
             desc.label = "volume_shader";
         }
         return &desc;
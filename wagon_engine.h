@@ -4,8 +4,24 @@
 #include <assert.h>
 #include <stdbool.h>
 #include <string.h>
+#include <float.h>
 #include <libgen.h>
 #include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <zlib.h>
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
 
 #define HANDMADE_MATH_IMPLEMENTATION
 #define HANDMADE_MATH_NO_SSE
@@ -30,6 +46,8 @@
 
 #include "shader/cube.glsl.h"
 #include "shader/volume.glsl.h"
+#include "shader/composite.glsl.h"
+#include "shader/distance.glsl.h"
 // #include "shader/phong.glsl.h"
 
 static void wagon_run();  // Add this line to declare the function
@@ -39,206 +57,4540 @@ static void wagon_run();  // Add this line to declare the function
 #define TOSTRING(x) STRINGIFY(x)
 #define HEADER_FILE TOSTRING(__FILE__)
 
+// Logging
+// Lines above log_level are dropped. Errors are always worth printing, info is a line or so per file loaded, and
+// debug dumps whole buffers, which is only bearable for small files
+typedef enum {
+    LOG_LEVEL_ERROR,
+    LOG_LEVEL_INFO,
+    LOG_LEVEL_DEBUG
+} log_level_t;
+
+static log_level_t log_level = LOG_LEVEL_ERROR;
+
+#define LOG_PRINTF(level, ...) ((level) <= log_level ? (void)printf(__VA_ARGS__) : (void)0)
+
 // ECS
-// TODO this is all ugly
-#define NUM_COMPONENTS 32
-#define VOLUME_DIMENSIONS 50
+#define VOLUME_DIMENSIONS 50 // Default edge length for volumes created without explicit dimensions
+
+// Voxel types
+// Each type is uploaded as is to a single channel texture: uint8 and uint16 as R8 and R16, which the shader reads
+// normalized to 0..1, half and float as R16F and R32F, which it reads as the values themselves
+typedef enum {
+    VOLUME_UINT8,
+    VOLUME_UINT16,
+    VOLUME_HALF,
+    VOLUME_FLOAT,
+} volume_type_t;
+
+static size_t volume_type_size(volume_type_t type) {
+    return type == VOLUME_UINT8 ? 1 : type == VOLUME_FLOAT ? 4 : 2;
+}
+
+static sg_pixel_format volume_pixel_format(volume_type_t type) {
+    switch (type) {
+        case VOLUME_UINT16: return SG_PIXELFORMAT_R16;
+        case VOLUME_HALF: return SG_PIXELFORMAT_R16F;
+        case VOLUME_FLOAT: return SG_PIXELFORMAT_R32F;
+        default: return SG_PIXELFORMAT_R8;
+    }
+}
+
+// Stored value the shader reads as 1.0
+static float volume_type_unit(volume_type_t type) {
+    return type == VOLUME_UINT8 ? 255.0f : type == VOLUME_UINT16 ? 65535.0f : 1.0f;
+}
+
+static inline float half_to_float(uint16_t h) {
+    uint32_t sign = (uint32_t)(h & 0x8000) << 16;
+    uint32_t exponent = (h >> 10) & 0x1f;
+    uint32_t mantissa = h & 0x3ff;
+    if (exponent == 0) {
+        float v = mantissa * (1.0f / 16777216.0f); // Denormal, mantissa * 2^-24
+        return sign ? -v : v;
+    }
+    uint32_t bits = sign | (exponent == 31 ? 0x7f800000 | mantissa << 13 : (exponent + 112) << 23 | mantissa << 13);
+    float v;
+    memcpy(&v, &bits, 4);
+    return v;
+}
+
+// Rounds to nearest even, like the GPU
+static inline uint16_t float_to_half(float f) {
+    uint32_t bits;
+    memcpy(&bits, &f, 4);
+    uint16_t sign = (bits >> 16) & 0x8000;
+    uint32_t magnitude = bits & 0x7fffffff;
+    if (magnitude > 0x7f800000) {
+        return sign | 0x7e00; // NaN
+    }
+    if (magnitude >= 0x477ff000) {
+        return sign | 0x7c00; // Rounds past the largest half, 65504
+    }
+    if (magnitude < 0x38800000) {
+        // Denormal, in steps of 2^-24
+        float v;
+        memcpy(&v, &magnitude, 4);
+        return sign | (uint16_t)nearbyintf(v * 16777216.0f);
+    }
+    magnitude -= 112u << 23; // Rebias the exponent
+    magnitude += 0xfff + ((magnitude >> 13) & 1);
+    return sign | (uint16_t)(magnitude >> 13);
+}
+
+// Voxel i as a float, in stored units (0..255 for uint8, 0..65535 for uint16)
+static inline float volume_load(const uint8_t* voxels, size_t i, volume_type_t type) {
+    switch (type) {
+        case VOLUME_UINT8: return voxels[i];
+        case VOLUME_UINT16: { uint16_t v; memcpy(&v, &voxels[i * 2], 2); return v; }
+        case VOLUME_HALF: { uint16_t v; memcpy(&v, &voxels[i * 2], 2); return half_to_float(v); }
+        default: { float v; memcpy(&v, &voxels[i * 4], 4); return v; }
+    }
+}
+
+// Store v as voxel i, rounding and clamping for the integer types
+static inline void volume_store(uint8_t* voxels, size_t i, volume_type_t type, float v) {
+    if (type == VOLUME_UINT8 || type == VOLUME_UINT16) {
+        float unit = volume_type_unit(type);
+        v = v > 0.0f ? (v < unit ? v + 0.5f : unit) : 0.0f;
+    }
+    switch (type) {
+        case VOLUME_UINT8: voxels[i] = (uint8_t)v; break;
+        case VOLUME_UINT16: { uint16_t u = (uint16_t)v; memcpy(&voxels[i * 2], &u, 2); break; }
+        case VOLUME_HALF: { uint16_t u = float_to_half(v); memcpy(&voxels[i * 2], &u, 2); break; }
+        default: memcpy(&voxels[i * 4], &v, 4); break;
+    }
+}
+
+// Parallel loops
+// CPU passes over whole volumes split their work across short-lived threads, one per core
+#define PARALLEL_MAX_THREADS 64
+
+typedef void (*parallel_fn_t)(void* user, int begin, int end);
+
+typedef struct {
+    parallel_fn_t fn;
+    void* user;
+    int begin;
+    int end;
+} parallel_range_t;
+
+static void* parallel_range_run(void* arg) {
+    parallel_range_t* range = (parallel_range_t*)arg;
+    range->fn(range->user, range->begin, range->end);
+    return NULL;
+}
+
+// Number of threads parallel_for uses by default
+int parallel_thread_count(void) {
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    return cores < 1 ? 1 : cores > PARALLEL_MAX_THREADS ? PARALLEL_MAX_THREADS : (int)cores;
+}
+
+// Split [0, count) into one contiguous range per thread and run fn on each, the calling thread taking the first.
+// threads <= 0 means parallel_thread_count(). Returns once every range is done
+void parallel_for(int count, int threads, parallel_fn_t fn, void* user) {
+    if (threads <= 0) {
+        threads = parallel_thread_count();
+    }
+    threads = threads < count ? threads : count;
+    threads = threads < PARALLEL_MAX_THREADS ? threads : PARALLEL_MAX_THREADS;
+    if (threads <= 1) {
+        if (count > 0) {
+            fn(user, 0, count);
+        }
+        return;
+    }
+    parallel_range_t ranges[PARALLEL_MAX_THREADS];
+    pthread_t workers[PARALLEL_MAX_THREADS];
+    bool started[PARALLEL_MAX_THREADS] = { false };
+    for (int i = 0; i < threads; i++) {
+        ranges[i] = (parallel_range_t){ fn, user, (int)((long long)count * i / threads), (int)((long long)count * (i + 1) / threads) };
+    }
+    // Ranges a thread couldn't be started for run here instead
+    for (int i = 1; i < threads; i++) {
+        started[i] = pthread_create(&workers[i], NULL, parallel_range_run, &ranges[i]) == 0;
+    }
+    for (int i = 0; i < threads; i++) {
+        if (i == 0 || !started[i]) {
+            parallel_range_run(&ranges[i]);
+        }
+    }
+    for (int i = 1; i < threads; i++) {
+        if (started[i]) {
+            pthread_join(workers[i], NULL);
+        }
+    }
+}
+
+// Volume mips
+// Each mip level halves the level above it along every axis (rounding down, like the GPU expects), reducing
+// 2x2x2 blocks of voxels to either their mean or their max. Max keeps thin bright structures visible from far away,
+// mean gives a smoother picture
+typedef enum {
+    VOLUME_REDUCE_MEAN,
+    VOLUME_REDUCE_MAX
+} volume_reduce_t;
+
+static int volume_mip_dim(int dim) {
+    return dim > 1 ? dim / 2 : 1;
+}
+
+// Number of mip levels down to a single voxel
+int volume_mip_count(int width, int height, int depth) {
+    int longest = width > height ? width : height;
+    longest = longest > depth ? longest : depth;
+    int levels = 1;
+    while (longest > 1 && levels < SG_MAX_MIPMAPS) {
+        longest /= 2;
+        levels++;
+    }
+    return levels;
+}
+
+// Reduce the rows at (y, z), (y + 1, z), (y, z + 1) and (y + 1, z + 1) into one row of the next level
+static void volume_reduce_row(const uint8_t* a, const uint8_t* b, const uint8_t* c, const uint8_t* d, uint8_t* dst, int src_width, int dst_width, volume_reduce_t mode) {
+    int x = 0;
+#if defined(__ARM_NEON)
+    const int pairs = src_width / 2 < dst_width ? src_width / 2 : dst_width; // Output voxels with both inputs inside the row
+    if (mode == VOLUME_REDUCE_MAX) {
+        for (; x + 16 <= pairs; x += 16) {
+            // vld2 splits even and odd voxels, so each lane holds one 2x1x1 pair
+            uint8x16x2_t ra = vld2q_u8(a + 2 * x), rb = vld2q_u8(b + 2 * x);
+            uint8x16x2_t rc = vld2q_u8(c + 2 * x), rd = vld2q_u8(d + 2 * x);
+            uint8x16_t m = vmaxq_u8(vmaxq_u8(ra.val[0], ra.val[1]), vmaxq_u8(rb.val[0], rb.val[1]));
+            m = vmaxq_u8(m, vmaxq_u8(vmaxq_u8(rc.val[0], rc.val[1]), vmaxq_u8(rd.val[0], rd.val[1])));
+            vst1q_u8(dst + x, m);
+        }
+    } else {
+        for (; x + 16 <= pairs; x += 16) {
+            // Pairwise widening adds, the sum of 8 voxels still fits in 16 bits
+            uint16x8_t lo = vpaddlq_u8(vld1q_u8(a + 2 * x));
+            uint16x8_t hi = vpaddlq_u8(vld1q_u8(a + 2 * x + 16));
+            lo = vpadalq_u8(lo, vld1q_u8(b + 2 * x));
+            hi = vpadalq_u8(hi, vld1q_u8(b + 2 * x + 16));
+            lo = vpadalq_u8(lo, vld1q_u8(c + 2 * x));
+            hi = vpadalq_u8(hi, vld1q_u8(c + 2 * x + 16));
+            lo = vpadalq_u8(lo, vld1q_u8(d + 2 * x));
+            hi = vpadalq_u8(hi, vld1q_u8(d + 2 * x + 16));
+            vst1q_u8(dst + x, vcombine_u8(vrshrn_n_u16(lo, 3), vrshrn_n_u16(hi, 3)));
+        }
+    }
+#elif defined(__SSE2__)
+    const int pairs = src_width / 2 < dst_width ? src_width / 2 : dst_width;
+    const __m128i low_bytes = _mm_set1_epi16(0x00ff);
+    if (mode == VOLUME_REDUCE_MAX) {
+        for (; x + 16 <= pairs; x += 16) {
+            __m128i lo = _mm_max_epu8(_mm_max_epu8(_mm_loadu_si128((const __m128i*)(a + 2 * x)), _mm_loadu_si128((const __m128i*)(b + 2 * x))),
+                                      _mm_max_epu8(_mm_loadu_si128((const __m128i*)(c + 2 * x)), _mm_loadu_si128((const __m128i*)(d + 2 * x))));
+            __m128i hi = _mm_max_epu8(_mm_max_epu8(_mm_loadu_si128((const __m128i*)(a + 2 * x + 16)), _mm_loadu_si128((const __m128i*)(b + 2 * x + 16))),
+                                      _mm_max_epu8(_mm_loadu_si128((const __m128i*)(c + 2 * x + 16)), _mm_loadu_si128((const __m128i*)(d + 2 * x + 16))));
+            // Max of the even and odd voxel in each 16 bit lane, then pack back to bytes
+            lo = _mm_max_epi16(_mm_and_si128(lo, low_bytes), _mm_srli_epi16(lo, 8));
+            hi = _mm_max_epi16(_mm_and_si128(hi, low_bytes), _mm_srli_epi16(hi, 8));
+            _mm_storeu_si128((__m128i*)(dst + x), _mm_packus_epi16(lo, hi));
+        }
+    } else {
+        const uint8_t* rows[4] = { a, b, c, d };
+        for (; x + 16 <= pairs; x += 16) {
+            __m128i lo = _mm_set1_epi16(4); // Rounding
+            __m128i hi = lo;
+            for (int r = 0; r < 4; r++) {
+                __m128i vlo = _mm_loadu_si128((const __m128i*)(rows[r] + 2 * x));
+                __m128i vhi = _mm_loadu_si128((const __m128i*)(rows[r] + 2 * x + 16));
+                lo = _mm_add_epi16(lo, _mm_add_epi16(_mm_and_si128(vlo, low_bytes), _mm_srli_epi16(vlo, 8)));
+                hi = _mm_add_epi16(hi, _mm_add_epi16(_mm_and_si128(vhi, low_bytes), _mm_srli_epi16(vhi, 8)));
+            }
+            _mm_storeu_si128((__m128i*)(dst + x), _mm_packus_epi16(_mm_srli_epi16(lo, 3), _mm_srli_epi16(hi, 3)));
+        }
+    }
+#endif
+    // Scalar tail, which also handles a row of width 1
+    for (; x < dst_width; x++) {
+        int x0 = 2 * x;
+        int x1 = x0 + 1 < src_width ? x0 + 1 : src_width - 1;
+        if (mode == VOLUME_REDUCE_MAX) {
+            uint8_t m = a[x0];
+            m = HMM_MAX(m, a[x1]); m = HMM_MAX(m, b[x0]); m = HMM_MAX(m, b[x1]);
+            m = HMM_MAX(m, c[x0]); m = HMM_MAX(m, c[x1]); m = HMM_MAX(m, d[x0]); m = HMM_MAX(m, d[x1]);
+            dst[x] = m;
+        } else {
+            dst[x] = (uint8_t)((a[x0] + a[x1] + b[x0] + b[x1] + c[x0] + c[x1] + d[x0] + d[x1] + 4) >> 3);
+        }
+    }
+}
+
+// volume_reduce_row for the wider types, one voxel at a time
+static void volume_reduce_row_wide(const uint8_t* a, const uint8_t* b, const uint8_t* c, const uint8_t* d, uint8_t* dst, int src_width, int dst_width, volume_reduce_t mode, volume_type_t type) {
+    for (int x = 0; x < dst_width; x++) {
+        int x0 = 2 * x;
+        int x1 = x0 + 1 < src_width ? x0 + 1 : src_width - 1;
+        float v[8] = {
+            volume_load(a, x0, type), volume_load(a, x1, type), volume_load(b, x0, type), volume_load(b, x1, type),
+            volume_load(c, x0, type), volume_load(c, x1, type), volume_load(d, x0, type), volume_load(d, x1, type),
+        };
+        float r = v[0];
+        for (int i = 1; i < 8; i++) {
+            r = mode == VOLUME_REDUCE_MAX ? (v[i] > r ? v[i] : r) : r + v[i];
+        }
+        volume_store(dst, x, type, mode == VOLUME_REDUCE_MAX ? r : r * 0.125f);
+    }
+}
+
+// Reduce the box [x0, x1) x [y0, y1) x [z0, z1) of the next mip level of a width x height x depth volume from src into dst
+void volume_reduce_region(const uint8_t* src, int width, int height, int depth, uint8_t* dst,
+                          int x0, int y0, int z0, int x1, int y1, int z1, volume_reduce_t mode, volume_type_t type) {
+    const int dst_width = volume_mip_dim(width);
+    const int dst_height = volume_mip_dim(height);
+    const size_t slice = (size_t)width * height;
+    const size_t size = volume_type_size(type);
+    for (int z = z0; z < z1; z++) {
+        // Axes of size 1 reuse the same row twice
+        size_t sz0 = (size_t)(2 * z) * slice;
+        size_t sz1 = (size_t)(2 * z + 1 < depth ? 2 * z + 1 : depth - 1) * slice;
+        for (int y = y0; y < y1; y++) {
+            size_t sy0 = (size_t)(2 * y) * width + 2 * x0;
+            size_t sy1 = (size_t)(2 * y + 1 < height ? 2 * y + 1 : height - 1) * width + 2 * x0;
+            uint8_t* row = &dst[(((size_t)z * dst_height + y) * dst_width + x0) * size];
+            if (type == VOLUME_UINT8) {
+                volume_reduce_row(&src[sz0 + sy0], &src[sz0 + sy1], &src[sz1 + sy0], &src[sz1 + sy1], row, width - 2 * x0, x1 - x0, mode);
+            } else {
+                volume_reduce_row_wide(&src[(sz0 + sy0) * size], &src[(sz0 + sy1) * size], &src[(sz1 + sy0) * size], &src[(sz1 + sy1) * size],
+                                       row, width - 2 * x0, x1 - x0, mode, type);
+            }
+        }
+    }
+}
+
+// Reduce a width x height x depth volume into dst, which must hold the next mip level's voxels
+void volume_reduce(const uint8_t* src, int width, int height, int depth, uint8_t* dst, volume_reduce_t mode, volume_type_t type) {
+    volume_reduce_region(src, width, height, depth, dst, 0, 0, 0,
+                         volume_mip_dim(width), volume_mip_dim(height), volume_mip_dim(depth), mode, type);
+}
+
+// Step a box [box[0..2], box[3..5]) and the dimensions it lives in down to the next mip level,
+// growing the box to every voxel that reads from it
+static void volume_mip_box(int box[6], int* width, int* height, int* depth) {
+    int next[3] = { volume_mip_dim(*width), volume_mip_dim(*height), volume_mip_dim(*depth) };
+    for (int axis = 0; axis < 3; axis++) {
+        box[axis] /= 2;
+        box[axis + 3] = (box[axis + 3] + 1) / 2 < next[axis] ? (box[axis + 3] + 1) / 2 : next[axis];
+    }
+    *width = next[0];
+    *height = next[1];
+    *depth = next[2];
+}
+
+// Allocate the mip chain of a volume. levels[0] is set to the volume itself and the rest share one allocation,
+// released with free(levels[1]). Returns the number of levels, or 0 if out of memory
+int volume_alloc_mips(uint8_t* volume, volume_type_t type, int width, int height, int depth, uint8_t* levels[SG_MAX_MIPMAPS]) {
+    int count = volume_mip_count(width, height, depth);
+    size_t sizes[SG_MAX_MIPMAPS];
+    size_t total = 0;
+    size_t end = 0; // Furthest byte past the chain's start a whole-image upload claims to read
+    for (int i = 1, w = width, h = height, d = depth; i < count; i++) {
+        w = volume_mip_dim(w);
+        h = volume_mip_dim(h);
+        d = volume_mip_dim(d);
+        sizes[i] = (size_t)w * h * d * volume_type_size(type);
+        size_t claimed = (size_t)w * h * depth * volume_type_size(type);
+        end = total + claimed > end ? total + claimed : end;
+        total += sizes[i];
+    }
+    memset(levels, 0, SG_MAX_MIPMAPS * sizeof(uint8_t*));
+    levels[0] = volume;
+    if (count == 1) {
+        return 1;
+    }
+    // Whole-image uploads pass sokol_gfx's validation, which expects every level of a 3D image to have as many slices
+    // as the top one, so the chain gets room for that. Only the real level sizes are ever read
+    total = end;
+    uint8_t* chain = (uint8_t*)calloc(total, 1);
+    if (!chain) {
+        return 0;
+    }
+    for (int i = 1; i < count; i++) {
+        levels[i] = chain;
+        chain += sizes[i];
+    }
+    return count;
+}
+
+// Redo the parts of a mip chain that depend on the box [x0, x1) x [y0, y1) x [z0, z1) of level 0
+void volume_update_mips(uint8_t* levels[SG_MAX_MIPMAPS], int count, volume_type_t type, int width, int height, int depth,
+                        int x0, int y0, int z0, int x1, int y1, int z1, volume_reduce_t mode) {
+    int box[6] = { x0, y0, z0, x1, y1, z1 };
+    for (int i = 1; i < count; i++) {
+        const uint8_t* src = levels[i - 1];
+        int w = width, h = height, d = depth;
+        volume_mip_box(box, &width, &height, &depth);
+        if (box[0] >= box[3] || box[1] >= box[4] || box[2] >= box[5]) {
+            break; // Only changed voxels the smaller levels leave out
+        }
+        volume_reduce_region(src, w, h, d, levels[i], box[0], box[1], box[2], box[3], box[4], box[5], mode, type);
+    }
+}
+
+// Block compression
+// Compressed volumes are kept on the GPU as BC4: every slice is cut into 4x4 blocks of voxels, each stored in 8 bytes as
+// two endpoint values and a 3-bit index per voxel into a palette spanned by them. That is 4 bits per voxel, half of R8,
+// and the GPU decodes it for free while sampling. Blocks never cross slices, so z filtering and mips work as usual
+#define BC4_BLOCK_BYTES 8
+
+// Bytes of blocks covering one width x height slice
+size_t bc4_slice_size(int width, int height) {
+    return (size_t)((width + 3) / 4) * ((height + 3) / 4) * BC4_BLOCK_BYTES;
+}
+
+// The eight values a block can hold. Two orders: red0 > red1 interpolates six values between them,
+// otherwise four, with 0 and 255 as the last two
+static void bc4_palette(uint8_t red0, uint8_t red1, int palette[8]) {
+    palette[0] = red0;
+    palette[1] = red1;
+    if (red0 > red1) {
+        for (int i = 2; i < 8; i++) {
+            palette[i] = ((8 - i) * red0 + (i - 1) * red1 + 3) / 7;
+        }
+    } else {
+        for (int i = 2; i < 6; i++) {
+            palette[i] = ((6 - i) * red0 + (i - 1) * red1 + 2) / 5;
+        }
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+}
+
+// Write endpoints and indices as a block, returning the squared error of the pixels against its palette
+static int bc4_pack_block(const uint8_t pixels[16], uint8_t red0, uint8_t red1, uint8_t block[8]) {
+    int palette[8];
+    bc4_palette(red0, red1, palette);
+    uint8_t indices[16];
+    int error = 0;
+    if (red0 > red1) {
+        // Evenly spaced, so the nearest value is a multiply away. Step 0 is red1, step 7 red0
+        static const uint8_t step_index[8] = { 1, 7, 6, 5, 4, 3, 2, 0 };
+        const int step_scale = (7 * 65536 + (red0 - red1) / 2) / (red0 - red1);
+        for (int i = 0; i < 16; i++) {
+            indices[i] = step_index[((pixels[i] - red1) * step_scale + 32768) >> 16];
+            const int e = pixels[i] - palette[indices[i]];
+            error += e * e;
+        }
+    } else {
+        for (int i = 0; i < 16; i++) {
+            int best_error = INT32_MAX;
+            for (int p = 0; p < 8; p++) {
+                const int e = (pixels[i] - palette[p]) * (pixels[i] - palette[p]);
+                if (e < best_error) {
+                    indices[i] = (uint8_t)p;
+                    best_error = e;
+                }
+            }
+            error += best_error;
+        }
+    }
+    uint64_t bits = 0;
+    for (int i = 0; i < 16; i++) {
+        bits |= (uint64_t)indices[i] << (3 * i);
+    }
+    block[0] = red0;
+    block[1] = red1;
+    for (int i = 0; i < 6; i++) {
+        block[2 + i] = (uint8_t)(bits >> (8 * i));
+    }
+    return error;
+}
+
+// Encode 16 pixels (4 rows of 4) as one block. Endpoints at the block's min and max give six steps between them;
+// blocks touching 0 or 255, like the edge of a scan against air, also try fitting the rest with four steps,
+// since 0 and 255 come for free in that order
+void bc4_encode_block(const uint8_t pixels[16], uint8_t block[8]) {
+    uint8_t lo = 255, hi = 0, inner_lo = 255, inner_hi = 0;
+    bool extremes = false;
+    for (int i = 0; i < 16; i++) {
+        lo = pixels[i] < lo ? pixels[i] : lo;
+        hi = pixels[i] > hi ? pixels[i] : hi;
+        if (pixels[i] == 0 || pixels[i] == 255) {
+            extremes = true;
+        } else {
+            inner_lo = pixels[i] < inner_lo ? pixels[i] : inner_lo;
+            inner_hi = pixels[i] > inner_hi ? pixels[i] : inner_hi;
+        }
+    }
+    if (lo == hi) {
+        memset(block, 0, BC4_BLOCK_BYTES);
+        block[0] = block[1] = lo;
+        return;
+    }
+    int error = bc4_pack_block(pixels, hi, lo, block);
+    if (extremes && error > 0) {
+        uint8_t alternative[8];
+        if (inner_lo > inner_hi) {
+            inner_lo = inner_hi = 0; // Nothing but 0 and 255
+        }
+        if (bc4_pack_block(pixels, inner_lo, inner_hi, alternative) < error) {
+            memcpy(block, alternative, sizeof(alternative));
+        }
+    }
+}
+
+void bc4_decode_block(const uint8_t block[8], uint8_t pixels[16]) {
+    int palette[8];
+    bc4_palette(block[0], block[1], palette);
+    uint64_t bits = 0;
+    for (int i = 0; i < 6; i++) {
+        bits |= (uint64_t)block[2 + i] << (8 * i);
+    }
+    for (int i = 0; i < 16; i++) {
+        pixels[i] = (uint8_t)palette[(bits >> (3 * i)) & 7];
+    }
+}
+
+typedef struct {
+    const uint8_t* src;
+    uint8_t* dst;
+    int width, height;
+    int bx0, by0, bx1, by1, z0;
+} bc4_encode_job_t;
+
+static void bc4_encode_slices(void* user, int begin, int end) {
+    const bc4_encode_job_t* job = (const bc4_encode_job_t*)user;
+    const int blocks_x = (job->width + 3) / 4;
+    const size_t slice_size = bc4_slice_size(job->width, job->height);
+    for (int z = job->z0 + begin; z < job->z0 + end; z++) {
+        const uint8_t* slice = &job->src[(size_t)z * job->width * job->height];
+        for (int by = job->by0; by < job->by1; by++) {
+            for (int bx = job->bx0; bx < job->bx1; bx++) {
+                // Blocks hanging over the edge repeat the last row and column
+                uint8_t pixels[16];
+                if (bx * 4 + 4 <= job->width && by * 4 + 4 <= job->height) {
+                    for (int y = 0; y < 4; y++) {
+                        memcpy(&pixels[y * 4], &slice[(size_t)(by * 4 + y) * job->width + bx * 4], 4);
+                    }
+                } else {
+                    for (int y = 0; y < 4; y++) {
+                        int sy = HMM_MIN(by * 4 + y, job->height - 1);
+                        for (int x = 0; x < 4; x++) {
+                            int sx = HMM_MIN(bx * 4 + x, job->width - 1);
+                            pixels[y * 4 + x] = slice[(size_t)sy * job->width + sx];
+                        }
+                    }
+                }
+                bc4_encode_block(pixels, &job->dst[z * slice_size + ((size_t)by * blocks_x + bx) * BC4_BLOCK_BYTES]);
+            }
+        }
+    }
+}
+
+// Encode the blocks of a width x height x depth uint8 volume covering the box [x0, x1) x [y0, y1) x [z0, z1) into dst,
+// which holds depth slices of bc4_slice_size bytes. Slices are spread over threads (see parallel_for)
+void bc4_encode_region(const uint8_t* src, int width, int height, uint8_t* dst, int x0, int y0, int z0, int x1, int y1, int z1, int threads) {
+    bc4_encode_job_t job = { src, dst, width, height, x0 / 4, y0 / 4, (x1 + 3) / 4, (y1 + 3) / 4, z0 };
+    parallel_for(z1 - z0, threads, bc4_encode_slices, &job);
+}
+
+void bc4_encode_volume(const uint8_t* src, int width, int height, int depth, uint8_t* dst, int threads) {
+    bc4_encode_region(src, width, height, dst, 0, 0, 0, width, height, depth, threads);
+}
+
+// Decode a volume encoded by bc4_encode_volume back into width x height x depth voxels
+void bc4_decode_volume(const uint8_t* src, int width, int height, int depth, uint8_t* dst) {
+    const int blocks_x = (width + 3) / 4, blocks_y = (height + 3) / 4;
+    for (int z = 0; z < depth; z++) {
+        for (int by = 0; by < blocks_y; by++) {
+            for (int bx = 0; bx < blocks_x; bx++) {
+                uint8_t pixels[16];
+                bc4_decode_block(&src[(((size_t)z * blocks_y + by) * blocks_x + bx) * BC4_BLOCK_BYTES], pixels);
+                for (int y = 0; y < 4 && by * 4 + y < height; y++) {
+                    for (int x = 0; x < 4 && bx * 4 + x < width; x++) {
+                        dst[((size_t)z * height + by * 4 + y) * width + bx * 4 + x] = pixels[y * 4 + x];
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Allocate the blocks of every mip level of a width x height x depth volume in one allocation, released with
+// free(levels[0]). Like volume_alloc_mips, there is room for sokol_gfx's view of each level having the full depth,
+// since compressed images are immutable and always get created whole. Returns false if out of memory
+bool bc4_alloc_mips(int width, int height, int depth, int count, uint8_t* levels[SG_MAX_MIPMAPS]) {
+    size_t offsets[SG_MAX_MIPMAPS];
+    size_t total = 0, end = 0;
+    for (int i = 0, w = width, h = height, d = depth; i < count; i++) {
+        offsets[i] = total;
+        end = HMM_MAX(end, total + bc4_slice_size(w, h) * depth);
+        total += bc4_slice_size(w, h) * d;
+        w = volume_mip_dim(w);
+        h = volume_mip_dim(h);
+        d = volume_mip_dim(d);
+    }
+    memset(levels, 0, SG_MAX_MIPMAPS * sizeof(uint8_t*));
+    uint8_t* chain = (uint8_t*)calloc(end, 1);
+    if (!chain) {
+        return false;
+    }
+    for (int i = 0; i < count; i++) {
+        levels[i] = chain + offsets[i];
+    }
+    return true;
+}
+
+// Macro cells
+// A coarse grid over the volume holding the min and max voxel value of each MACRO_CELL_SIZE^3 cell. Checked against
+// the opacity each voxel value gets, it tells the ray marcher which cells are fully transparent so it can jump across them.
+// Values are in stored units, and are mapped through the volume's window before looking up their opacity.
+#define MACRO_CELL_SIZE 8
+
+typedef struct {
+    int cells_x, cells_y, cells_z;
+    float* minmax;      // Per cell: min then max voxel value, NaNs left out
+    uint8_t* occupancy; // Per cell: 255 if any voxel in it can be visible, 0 if rays can skip it
+} macro_grid_t;
+
+void macro_grid_free(macro_grid_t* grid) {
+    free(grid->minmax);
+    free(grid->occupancy);
+    memset(grid, 0, sizeof(*grid));
+}
+
+// Allocate the grid for a width x height x depth volume, with every cell occupied. Returns false if out of memory
+bool macro_grid_init(macro_grid_t* grid, int width, int height, int depth) {
+    macro_grid_free(grid);
+    grid->cells_x = (width + MACRO_CELL_SIZE - 1) / MACRO_CELL_SIZE;
+    grid->cells_y = (height + MACRO_CELL_SIZE - 1) / MACRO_CELL_SIZE;
+    grid->cells_z = (depth + MACRO_CELL_SIZE - 1) / MACRO_CELL_SIZE;
+    size_t count = (size_t)grid->cells_x * grid->cells_y * grid->cells_z;
+    grid->minmax = (float*)malloc(count * 2 * sizeof(float));
+    grid->occupancy = (uint8_t*)malloc(count);
+    if (!grid->minmax || !grid->occupancy) {
+        macro_grid_free(grid);
+        return false;
+    }
+    memset(grid->occupancy, 255, count);
+    return true;
+}
+
+// Recompute the min and max of the cells overlapping the box [x0, x1) x [y0, y1) x [z0, z1) of the volume
+void macro_grid_update(macro_grid_t* grid, const uint8_t* volume, volume_type_t type, int width, int height, int depth,
+                       int x0, int y0, int z0, int x1, int y1, int z1) {
+    // Whole cells get rescanned, since the voxels that changed may have been a cell's min or max
+    const int cx0 = x0 / MACRO_CELL_SIZE, cx1 = (x1 + MACRO_CELL_SIZE - 1) / MACRO_CELL_SIZE;
+    const int cy0 = y0 / MACRO_CELL_SIZE, cy1 = (y1 + MACRO_CELL_SIZE - 1) / MACRO_CELL_SIZE;
+    const int cz0 = z0 / MACRO_CELL_SIZE, cz1 = (z1 + MACRO_CELL_SIZE - 1) / MACRO_CELL_SIZE;
+    for (int cz = cz0; cz < cz1; cz++) {
+        for (int cy = cy0; cy < cy1; cy++) {
+            for (int cx = cx0; cx < cx1; cx++) {
+                float* cell = &grid->minmax[(((size_t)cz * grid->cells_y + cy) * grid->cells_x + cx) * 2];
+                cell[0] = INFINITY;
+                cell[1] = -INFINITY;
+            }
+        }
+    }
+
+    // Walk the rows under those cells, folding each run of MACRO_CELL_SIZE voxels into its cell
+    const int row_end = HMM_MIN(cx1 * MACRO_CELL_SIZE, width);
+    const int y_end = HMM_MIN(cy1 * MACRO_CELL_SIZE, height);
+    const int z_end = HMM_MIN(cz1 * MACRO_CELL_SIZE, depth);
+    for (int z = cz0 * MACRO_CELL_SIZE; z < z_end; z++) {
+        for (int y = cy0 * MACRO_CELL_SIZE; y < y_end; y++) {
+            const uint8_t* row = &volume[((size_t)z * height + y) * width * volume_type_size(type)];
+            float* cell = &grid->minmax[(((size_t)(z / MACRO_CELL_SIZE) * grid->cells_y + y / MACRO_CELL_SIZE) * grid->cells_x + cx0) * 2];
+            for (int run = cx0 * MACRO_CELL_SIZE; run < row_end; run += MACRO_CELL_SIZE, cell += 2) {
+                int run_end = HMM_MIN(run + MACRO_CELL_SIZE, width);
+                if (type == VOLUME_UINT8) {
+                    uint8_t lo = 255, hi = 0;
+                    for (int x = run; x < run_end; x++) {
+                        lo = HMM_MIN(lo, row[x]);
+                        hi = HMM_MAX(hi, row[x]);
+                    }
+                    cell[0] = HMM_MIN(cell[0], (float)lo);
+                    cell[1] = HMM_MAX(cell[1], (float)hi);
+                } else {
+                    float lo = cell[0], hi = cell[1];
+                    for (int x = run; x < run_end; x++) {
+                        float v = volume_load(row, x, type);
+                        lo = v < lo ? v : lo; // NaNs fail both
+                        hi = v > hi ? v : hi;
+                    }
+                    cell[0] = lo;
+                    cell[1] = hi;
+                }
+            }
+        }
+    }
+}
+
+// Build the min/max grid of a width x height x depth volume. Every cell starts out occupied until classified.
+// Returns false if out of memory
+bool macro_grid_build(macro_grid_t* grid, const uint8_t* volume, volume_type_t type, int width, int height, int depth) {
+    if (!macro_grid_init(grid, width, height, depth)) {
+        return false;
+    }
+    macro_grid_update(grid, volume, type, width, height, depth, 0, 0, 0, width, height, depth);
+    return true;
+}
+
+// Mark each cell empty or not, given the opacity (0 = invisible) of 256 steps across the window from
+// window_min to window_max. Values outside the window get the opacity of its nearest end
+void macro_grid_classify(macro_grid_t* grid, const uint8_t opacity[256], float window_min, float window_max) {
+    // visible[v] counts the steps below v with any opacity, so a cell can be seen iff it differs across its range
+    int visible[257];
+    visible[0] = 0;
+    for (int v = 0; v < 256; v++) {
+        visible[v + 1] = visible[v] + (opacity[v] > 0);
+    }
+    const float scale = window_max > window_min ? 255.0f / (window_max - window_min) : 0.0f;
+    size_t count = (size_t)grid->cells_x * grid->cells_y * grid->cells_z;
+    for (size_t i = 0; i < count; i++) {
+        float lo = grid->minmax[i * 2 + 0], hi = grid->minmax[i * 2 + 1];
+        if (!(lo <= hi)) {
+            grid->occupancy[i] = 0; // No voxels, or only NaNs
+            continue;
+        }
+        // Widen to whole steps, since the shader's lookup falls between them
+        float first = floorf((lo - window_min) * scale), last = ceilf((hi - window_min) * scale);
+        int a = first > 0.0f ? (first < 255.0f ? (int)first : 255) : 0;
+        int b = last > 0.0f ? (last < 255.0f ? (int)last : 255) : 0;
+        grid->occupancy[i] = visible[b + 1] - visible[a] > 0 ? 255 : 0;
+    }
+}
+
+// Opacity the volume shader gives 256 steps across the window, from the alpha of an RGBA8 colormap spread over it.
+// Rounded up, so anything slightly visible keeps its cells. Colormap texels are closer together than the steps, so
+// even a single texel peak of opacity has a step next to it that picks some of it up
+void volume_opacity_table(const uint8_t* colormap, int colormap_width, uint8_t opacity[256]) {
+    for (int v = 0; v < 256; v++) {
+        const float x = v / 255.0f * (colormap_width - 1);
+        const int i = HMM_MIN((int)x, colormap_width - 2);
+        const float f = x - i;
+        opacity[v] = (uint8_t)ceilf(colormap[i * 4 + 3] * (1.0f - f) + colormap[(i + 1) * 4 + 3] * f);
+    }
+}
+
+// Cell along one axis holding coordinate p in [0, 1] of an axis with size voxels
+static inline int macro_grid_coord(float p, int size, int cells) {
+    // Truncating is flooring once negatives are clamped away
+    float cell = p * size / MACRO_CELL_SIZE;
+    return cell < 0.0f ? 0 : (cell >= cells ? cells - 1 : (int)cell);
+}
+
+// Index of the cell holding p, a point in the [0, 1]^3 box of a width x height x depth volume
+int macro_grid_cell(const macro_grid_t* grid, int width, int height, int depth, hmm_vec3 p) {
+    int cx = macro_grid_coord(p.X, width, grid->cells_x);
+    int cy = macro_grid_coord(p.Y, height, grid->cells_y);
+    int cz = macro_grid_coord(p.Z, depth, grid->cells_z);
+    return (cz * grid->cells_y + cy) * grid->cells_x + cx;
+}
+
+// Cell along one axis of the sample i steps of dt along the ray, found exactly as macro_grid_cell would find it
+static inline int macro_grid_step_coord(int axis, int i, hmm_vec3 eye, hmm_vec3 dir, float t0, float dt, int size, int cells) {
+    // Multiplied and added separately, like HMM_AddVec3(eye, HMM_MultiplyVec3f(dir, t)), so they aren't fused
+    float t = t0 + i * dt;
+    float along = dir.Elements[axis] * t;
+    float p = eye.Elements[axis] + along;
+    return macro_grid_coord(p, size, cells);
+}
+
+// Steps of dt from t0 to where the ray leaves a cell through its far face along one axis
+static inline float macro_grid_step_face(int axis, int cell, hmm_vec3 eye, hmm_vec3 dir, float t0, float dt, int size) {
+    const float d = dir.Elements[axis];
+    return (((cell + (d > 0.0f)) * MACRO_CELL_SIZE / (float)size - eye.Elements[axis]) / d - t0) / dt;
+}
+
+// First step after step i whose sample is in another cell along one axis than cell, the one step i's sample is in,
+// or steps if there is none. face is where the ray leaves cell and per_cell how long a cell is, both in steps
+static int macro_grid_step_crossing(int axis, int i, int cell, float face, float per_cell, int steps, hmm_vec3 eye,
+                                    hmm_vec3 dir, float t0, float dt, int size, int cells) {
+    const float d = dir.Elements[axis];
+    if (d == 0.0f || (d > 0.0f ? cell == cells - 1 : cell == 0)) {
+        return steps;
+    }
+    int k = face < i + 1 ? i + 1 : (face >= steps ? steps : (int)face + 1);
+    // Only a step right at the face can end up on the wrong side of it through rounding, which is off by much less
+    // than a hundredth of a step and a ten thousandth of a cell, so look at the samples either side of one that close
+    const float before = fabsf(face - (k - 1)), after = fabsf(k - face);
+    if ((before < after ? before : after) < 0.01f + 0.0001f * per_cell) {
+        while (k > i + 1 && macro_grid_step_coord(axis, k - 1, eye, dir, t0, dt, size, cells) != cell) {
+            k--;
+        }
+        while (k < steps && macro_grid_step_coord(axis, k, eye, dir, t0, dt, size, cells) == cell) {
+            k++;
+        }
+    }
+    return k;
+}
+
+// CPU reference of the ray march in the volume shader, including the empty space skipping. The ray eye + t * dir is
+// marched from t0 to t1 in steps of dt through a width x height x depth volume spanning [0, 1]^3. With a grid, the ray
+// walks from cell to cell instead, looking up each cell's occupancy once and taking the steps inside it only if it's
+// occupied, so it samples exactly where a plain march lands in occupied cells. Writes the t of every sample the
+// shader would take to samples (up to max_samples, if not NULL) and returns how many there were. Pass a NULL grid
+// to march without skipping
+int macro_grid_march(const macro_grid_t* grid, int width, int height, int depth, hmm_vec3 eye, hmm_vec3 dir,
+                     float t0, float t1, float dt, float* samples, int max_samples) {
+    int count = 0;
+    const int steps = (int)ceilf((t1 - t0) / dt);
+    if (!grid) {
+        for (int i = 0; i < steps; i++, count++) {
+            if (samples && count < max_samples) {
+                samples[count] = t0 + i * dt;
+            }
+        }
+        return count;
+    }
+
+    // Per axis, the cell the current step is in, the first step in the next one, and where the ray leaves it
+    const int sizes[3] = { width, height, depth };
+    const int cells[3] = { grid->cells_x, grid->cells_y, grid->cells_z };
+    int cell[3], next[3];
+    float face[3], per_cell[3];
+    for (int axis = 0; axis < 3; axis++) {
+        cell[axis] = macro_grid_step_coord(axis, 0, eye, dir, t0, dt, sizes[axis], cells[axis]);
+        face[axis] = macro_grid_step_face(axis, cell[axis], eye, dir, t0, dt, sizes[axis]);
+        per_cell[axis] = MACRO_CELL_SIZE / (float)sizes[axis] / fabsf(dir.Elements[axis]) / dt;
+        next[axis] = macro_grid_step_crossing(axis, 0, cell[axis], face[axis], per_cell[axis], steps, eye, dir, t0, dt,
+                                              sizes[axis], cells[axis]);
+    }
+    for (int i = 0; i < steps;) {
+        // Steps i up to end all sample this cell
+        const int end = HMM_MIN(next[0], HMM_MIN(next[1], next[2]));
+        if (grid->occupancy[(cell[2] * grid->cells_y + cell[1]) * grid->cells_x + cell[0]] != 0) {
+            for (int k = i; k < end; k++, count++) {
+                if (samples && count < max_samples) {
+                    samples[count] = t0 + k * dt;
+                }
+            }
+        }
+        i = end;
+        for (int axis = 0; axis < 3 && i < steps; axis++) {
+            if (next[axis] != i) {
+                continue;
+            }
+            // Cells at least two steps long can't be stepped over, so this step is in the next one along
+            if (per_cell[axis] >= 2.0f) {
+                cell[axis] += dir.Elements[axis] > 0.0f ? 1 : -1;
+                face[axis] += per_cell[axis];
+            } else {
+                cell[axis] = macro_grid_step_coord(axis, i, eye, dir, t0, dt, sizes[axis], cells[axis]);
+                face[axis] = macro_grid_step_face(axis, cell[axis], eye, dir, t0, dt, sizes[axis]);
+            }
+            next[axis] = macro_grid_step_crossing(axis, i, cell[axis], face[axis], per_cell[axis], steps, eye, dir, t0,
+                                                  dt, sizes[axis], cells[axis]);
+        }
+    }
+    return count;
+}
+
+// Transfer functions
+// The volume shader colors the stretch between two samples by looking up the values at both ends in a pre-integrated
+// table, rather than coloring each sample on its own. Each entry is the color and opacity a single step picks up going
+// from one value to the other, integrated along the way, so big steps across sharp changes don't leave slab artefacts
+#define TRANSFER_TABLE_SIZE 256 // Entries along each axis, must match transfer_segment in the volume shader
+#define TRANSFER_SUBSTEPS 32   // Samples taken along each step while integrating
+
+typedef struct {
+    const uint8_t* colormap;
+    int colormap_width;
+    uint16_t* table;
+    int size;
+} transfer_job_t;
+
+static void preintegrate_rows(void* user, int begin, int end) {
+    const transfer_job_t* job = (const transfer_job_t*)user;
+    for (int back = begin; back < end; back++) {
+        for (int front = 0; front < job->size; front++) {
+            // Walk from the front value to the back value in substeps, each with 1 / TRANSFER_SUBSTEPS of the
+            // step's optical depth, compositing front to back
+            const float v0 = (float)front / (job->size - 1), v1 = (float)back / (job->size - 1);
+            float rgb[3] = { 0.0f, 0.0f, 0.0f };
+            float transmittance = 1.0f;
+            for (int k = 0; k < TRANSFER_SUBSTEPS; k++) {
+                const float v = v0 + (v1 - v0) * (k + 0.5f) / TRANSFER_SUBSTEPS;
+                const float x = v * (job->colormap_width - 1);
+                const int i = HMM_MIN((int)x, job->colormap_width - 2);
+                const float f = x - i;
+                const float opacity = (job->colormap[i * 4 + 3] * (1.0f - f) + job->colormap[(i + 1) * 4 + 3] * f) / 255.0f;
+                const float alpha = 1.0f - powf(1.0f - (HMM_MIN(opacity, 0.9999f)), 1.0f / TRANSFER_SUBSTEPS);
+                for (int c = 0; c < 3; c++) {
+                    const float color = (job->colormap[i * 4 + c] * (1.0f - f) + job->colormap[(i + 1) * 4 + c] * f) / 255.0f;
+                    rgb[c] += transmittance * alpha * color;
+                }
+                transmittance *= 1.0f - alpha;
+            }
+            uint16_t* entry = &job->table[((size_t)back * job->size + front) * 4];
+            for (int c = 0; c < 3; c++) {
+                entry[c] = float_to_half(rgb[c]);
+            }
+            entry[3] = float_to_half(1.0f - transmittance);
+        }
+    }
+}
+
+// Fill table (size x size RGBA16F texels, front value along x and back value along y) with the premultiplied color
+// and opacity of a step between every pair of values. Colors and the opacity of one step come from the RGBA8 colormap,
+// spread evenly from value 0 to 1. Rows are spread over threads (see parallel_for)
+void preintegrate_transfer_function(const uint8_t* colormap, int colormap_width, uint16_t* table, int size, int threads) {
+    transfer_job_t job = { colormap, colormap_width, table, size };
+    parallel_for(size, threads, preintegrate_rows, &job);
+}
+
+// Transfer functions are edited as a handful of points, and baked into a colormap texture-wide in between them
+#define TRANSFER_MAX_POINTS 16
+#define COLORMAP_WIDTH 260
+
+typedef struct {
+    float value;    // Where the point sits, 0 at the bottom of the window and 1 at the top
+    float color[3]; // Linear RGB
+    float opacity;  // Opacity of a single voxel step
+} transfer_point_t;
+
+typedef struct {
+    transfer_point_t points[TRANSFER_MAX_POINTS]; // In any order
+    int point_count;
+} transfer_function_t;
+
+static int compare_floats(const void* a, const void* b) {
+    float fa = *(const float*)a, fb = *(const float*)b;
+    return (fa > fb) - (fa < fb);
+}
+
+static int compare_transfer_points(const void* a, const void* b) {
+    float va = ((const transfer_point_t*)a)->value;
+    float vb = ((const transfer_point_t*)b)->value;
+    return (va > vb) - (va < vb);
+}
+
+// Bake a transfer function into an RGBA8 colormap spanning values 0 to 1, interpolating linearly between its points
+// and holding the first and last one's color and opacity past them
+void transfer_function_bake(const transfer_function_t* function, uint8_t* colormap, int colormap_width) {
+    transfer_point_t points[TRANSFER_MAX_POINTS];
+    const int count = function->point_count;
+    memcpy(points, function->points, count * sizeof(transfer_point_t));
+    qsort(points, count, sizeof(transfer_point_t), compare_transfer_points);
+    for (int i = 0, p = 0; i < colormap_width; i++) {
+        const float v = (float)i / (colormap_width - 1);
+        while (p < count && points[p].value < v) {
+            p++;
+        }
+        const transfer_point_t* a = &points[p > 0 ? p - 1 : 0];
+        const transfer_point_t* b = &points[p < count ? p : count - 1];
+        const float f = b->value > a->value ? (v - a->value) / (b->value - a->value) : 0.0f;
+        for (int c = 0; c < 3; c++) {
+            colormap[i * 4 + c] = (uint8_t)(HMM_Clamp(0.0f, a->color[c] + (b->color[c] - a->color[c]) * f, 1.0f) * 255.0f + 0.5f);
+        }
+        colormap[i * 4 + 3] = (uint8_t)(HMM_Clamp(0.0f, a->opacity + (b->opacity - a->opacity) * f, 1.0f) * 255.0f + 0.5f);
+    }
+}
+
+// The transfer function every volume is drawn with, and everything derived from it. Only rebuilt when it changes,
+// by update_transfer_table
+static struct {
+    transfer_function_t function;
+    bool changed;
+    uint32_t revision; // Goes up every time the table is rebuilt
+    uint8_t colormap[COLORMAP_WIDTH * 4]; // RGBA8
+    uint8_t opacity[256];                 // volume_opacity_table of the colormap, for classifying macro cells
+    uint16_t table[TRANSFER_TABLE_SIZE * TRANSFER_TABLE_SIZE * 4]; // Pre-integrated from the colormap, RGBA16F
+    sg_image table_img;
+} transfer = {
+    // Red and transparent at the bottom of the window to blue and opaque at the top
+    .function = {
+        .points = {
+            { .value = 0.0f, .color = { 1.0f, 0.0f, 0.0f }, .opacity = 0.0f },
+            { .value = 1.0f, .color = { 0.0f, 0.0f, 1.0f }, .opacity = 1.0f },
+        },
+        .point_count = 2,
+    },
+    .changed = true,
+};
+
+// Replace the transfer function, taking effect with the next draw
+void set_transfer_function(const transfer_function_t* function) {
+    assert(function->point_count > 0 && function->point_count <= TRANSFER_MAX_POINTS);
+    transfer.function = *function;
+    transfer.changed = true;
+}
+
+// Histograms
+// Counts of a volume's voxels in HISTOGRAM_BINS bins across a range of stored values, anything outside it landing in
+// the end bins. Big volumes are counted a few million voxels per frame so the UI never stalls on them
+#define HISTOGRAM_BINS 256
+#define HISTOGRAM_CHUNK 1024 // Voxels binned at a time
+
+typedef struct {
+    uint32_t counts[4][HISTOGRAM_BINS]; // Four copies, taking turns, so runs of voxels in one bin don't wait on each other
+    size_t done;  // Voxels counted so far
+    size_t total;
+    float lo, hi; // Range of stored values the bins span
+} volume_histogram_t;
+
+// Bin values (value - lo) * scale, clamped to the bins. NaN lands in bin 0
+static void histogram_bin_floats(const float* values, int count, float lo, float scale, int32_t* bins) {
+    int i = 0;
+#if defined(__ARM_NEON)
+    const float32x4_t lo4 = vdupq_n_f32(lo), scale4 = vdupq_n_f32(scale);
+    const float32x4_t zero = vdupq_n_f32(0.0f), top = vdupq_n_f32(HISTOGRAM_BINS - 1);
+    for (; i + 4 <= count; i += 4) {
+        float32x4_t x = vmulq_f32(vsubq_f32(vld1q_f32(&values[i]), lo4), scale4);
+        x = vminq_f32(vmaxq_f32(x, zero), top); // NaN stays NaN, which converts to 0
+        vst1q_s32(&bins[i], vcvtq_s32_f32(x));
+    }
+#elif defined(__SSE2__)
+    const __m128 lo4 = _mm_set1_ps(lo), scale4 = _mm_set1_ps(scale);
+    const __m128 zero = _mm_setzero_ps(), top = _mm_set1_ps(HISTOGRAM_BINS - 1);
+    for (; i + 4 <= count; i += 4) {
+        __m128 x = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&values[i]), lo4), scale4);
+        x = _mm_min_ps(_mm_max_ps(x, zero), top); // max gives its second operand for NaN
+        _mm_storeu_si128((__m128i*)&bins[i], _mm_cvttps_epi32(x));
+    }
+#endif
+    for (; i < count; i++) {
+        const float x = (values[i] - lo) * scale;
+        bins[i] = x > 0.0f ? (int32_t)(x < HISTOGRAM_BINS - 1 ? x : HISTOGRAM_BINS - 1) : 0;
+    }
+}
+
+// Widen count voxels from first on to floats, in stored units
+static void histogram_load_floats(const uint8_t* voxels, volume_type_t type, size_t first, int count, float* values) {
+    int i = 0;
+    if (type == VOLUME_FLOAT) {
+        memcpy(values, &voxels[first * 4], count * sizeof(float));
+        return;
+    }
+    if (type == VOLUME_UINT16) {
+        const uint8_t* src = &voxels[first * 2];
+#if defined(__ARM_NEON)
+        for (; i + 8 <= count; i += 8) {
+            uint16x8_t v = vreinterpretq_u16_u8(vld1q_u8(&src[i * 2]));
+            vst1q_f32(&values[i], vcvtq_f32_u32(vmovl_u16(vget_low_u16(v))));
+            vst1q_f32(&values[i + 4], vcvtq_f32_u32(vmovl_u16(vget_high_u16(v))));
+        }
+#elif defined(__SSE2__)
+        for (; i + 8 <= count; i += 8) {
+            __m128i v = _mm_loadu_si128((const __m128i*)&src[i * 2]);
+            _mm_storeu_ps(&values[i], _mm_cvtepi32_ps(_mm_unpacklo_epi16(v, _mm_setzero_si128())));
+            _mm_storeu_ps(&values[i + 4], _mm_cvtepi32_ps(_mm_unpackhi_epi16(v, _mm_setzero_si128())));
+        }
+#endif
+    }
+    for (; i < count; i++) {
+        values[i] = volume_load(voxels, first + i, type);
+    }
+}
+
+// Start counting total voxels into bins spanning stored values lo to hi
+void volume_histogram_begin(volume_histogram_t* histogram, size_t total, float lo, float hi) {
+    memset(histogram->counts, 0, sizeof(histogram->counts));
+    histogram->done = 0;
+    histogram->total = total;
+    histogram->lo = lo;
+    histogram->hi = hi > lo ? hi : lo + 1.0f;
+}
+
+// Count up to max_voxels more of the voxels, which must be the same ones every call. Returns true once all are in
+bool volume_histogram_step(volume_histogram_t* histogram, const uint8_t* voxels, volume_type_t type, size_t max_voxels) {
+    const float scale = HISTOGRAM_BINS / (histogram->hi - histogram->lo);
+    const size_t end = histogram->total - histogram->done > max_voxels ? histogram->done + max_voxels : histogram->total;
+    int32_t bins[HISTOGRAM_CHUNK];
+    if (type == VOLUME_UINT8) {
+        // Every uint8 value's bin, looked up per voxel
+        float values[256];
+        int32_t bin_of[256];
+        for (int v = 0; v < 256; v++) {
+            values[v] = (float)v;
+        }
+        histogram_bin_floats(values, 256, histogram->lo, scale, bin_of);
+        size_t i = histogram->done;
+        for (; i + 4 <= end; i += 4) {
+            histogram->counts[0][bin_of[voxels[i + 0]]]++;
+            histogram->counts[1][bin_of[voxels[i + 1]]]++;
+            histogram->counts[2][bin_of[voxels[i + 2]]]++;
+            histogram->counts[3][bin_of[voxels[i + 3]]]++;
+        }
+        for (; i < end; i++) {
+            histogram->counts[0][bin_of[voxels[i]]]++;
+        }
+    } else {
+        float values[HISTOGRAM_CHUNK];
+        for (size_t first = histogram->done; first < end; first += HISTOGRAM_CHUNK) {
+            const int count = end - first < HISTOGRAM_CHUNK ? (int)(end - first) : HISTOGRAM_CHUNK;
+            histogram_load_floats(voxels, type, first, count, values);
+            histogram_bin_floats(values, count, histogram->lo, scale, bins);
+            for (int i = 0; i < count; i++) {
+                histogram->counts[i & 3][bins[i]]++;
+            }
+        }
+    }
+    histogram->done = end;
+    return histogram->done == histogram->total;
+}
+
+// Total count of each bin so far
+void volume_histogram_bins(const volume_histogram_t* histogram, uint32_t bins[HISTOGRAM_BINS]) {
+    for (int i = 0; i < HISTOGRAM_BINS; i++) {
+        bins[i] = histogram->counts[0][i] + histogram->counts[1][i] + histogram->counts[2][i] + histogram->counts[3][i];
+    }
+}
+
+// Volume bricks
+// Volumes too big for a single 3D texture are split into BRICK_SIZE^3 bricks which are paged in from disk
+// on demand. Resident bricks live in slots of a fixed-size 3D atlas texture, and a page table texture with
+// one RGBA8 entry per brick tells the shader where (or if) each brick is resident.
+// Bricks also exist for coarser mip levels, where a level n brick covers 2^n x 2^n x 2^n level 0 bricks.
+// Each level 0 page table entry can point at whichever level the camera distance calls for.
+#define BRICK_SIZE 64
+#define BRICK_ATLAS_X 8 // Atlas size in bricks, 8 * 8 * 4 * 64^3 = 64MB of R8 voxels
+#define BRICK_ATLAS_Y 8
+#define BRICK_ATLAS_Z 4
+#define BRICK_MAX_LEVELS 8
+#define BRICK_LOADS 16 // Bricks read ahead of being uploaded, nearest first
+#define BRICK_UPLOADS_PER_FRAME 16
+
+// CPU side of the brick cache: which brick lives in which atlas slot.
+// No GPU calls in here, so the paging logic runs under SOKOL_DUMMY_BACKEND, where examples/bench checks it.
+typedef struct {
+    int grid_x, grid_y, grid_z;    // Level 0 bricks along each axis of the volume
+    int atlas_x, atlas_y, atlas_z; // Slots along each axis of the atlas
+    int levels;
+    int level_grid[BRICK_MAX_LEVELS][3]; // Bricks along each axis per level
+    int level_offset[BRICK_MAX_LEVELS];  // Index of each level's first brick
+    int brick_count;         // Bricks across all levels
+    int slot_count;
+    int32_t* brick_slot;     // Per brick: atlas slot holding it, or -1
+    int32_t* slot_brick;     // Per slot: brick living in it, or -1
+    uint64_t* slot_used;     // Per slot: frame in which the brick was last touched
+    int32_t* slot_prev;      // LRU list through the slots, most recently used at lru_head
+    int32_t* slot_next;
+    int32_t lru_head;
+    int32_t lru_tail;
+    uint8_t* page_table;     // Per level 0 brick RGBA8: atlas slot xyz, alpha level + 1 of the brick covering it, 0 if none
+    bool page_table_dirty;
+    uint64_t frame;
+    int resident_count;
+} brick_cache_t;
+
+static void brick_cache_unlink(brick_cache_t* cache, int32_t slot) {
+    int32_t prev = cache->slot_prev[slot];
+    int32_t next = cache->slot_next[slot];
+    if (prev >= 0) cache->slot_next[prev] = next; else cache->lru_head = next;
+    if (next >= 0) cache->slot_prev[next] = prev; else cache->lru_tail = prev;
+    cache->slot_prev[slot] = cache->slot_next[slot] = -1;
+}
+
+static void brick_cache_push_front(brick_cache_t* cache, int32_t slot) {
+    cache->slot_prev[slot] = -1;
+    cache->slot_next[slot] = cache->lru_head;
+    if (cache->lru_head >= 0) cache->slot_prev[cache->lru_head] = slot;
+    cache->lru_head = slot;
+    if (cache->lru_tail < 0) cache->lru_tail = slot;
+}
+
+void brick_cache_free(brick_cache_t* cache) {
+    free(cache->brick_slot);
+    free(cache->slot_brick);
+    free(cache->slot_used);
+    free(cache->slot_prev);
+    free(cache->slot_next);
+    free(cache->page_table);
+    memset(cache, 0, sizeof(*cache));
+}
+
+// Set up an empty cache for a grid of level 0 bricks (plus their coarser levels) and an atlas of slots.
+// Returns false if out of memory
+bool brick_cache_init(brick_cache_t* cache, int grid_x, int grid_y, int grid_z, int atlas_x, int atlas_y, int atlas_z) {
+    // Page table entries store slot coordinates in 8 bits each
+    assert(atlas_x <= 256 && atlas_y <= 256 && atlas_z <= 256);
+    memset(cache, 0, sizeof(*cache));
+    cache->grid_x = grid_x;
+    cache->grid_y = grid_y;
+    cache->grid_z = grid_z;
+    cache->atlas_x = atlas_x;
+    cache->atlas_y = atlas_y;
+    cache->atlas_z = atlas_z;
+    // Add levels until a single brick covers the whole volume
+    for (int level = 0; level < BRICK_MAX_LEVELS; level++) {
+        int* grid = cache->level_grid[level];
+        grid[0] = (grid_x + (1 << level) - 1) >> level;
+        grid[1] = (grid_y + (1 << level) - 1) >> level;
+        grid[2] = (grid_z + (1 << level) - 1) >> level;
+        cache->level_offset[level] = cache->brick_count;
+        cache->brick_count += grid[0] * grid[1] * grid[2];
+        cache->levels++;
+        if (grid[0] == 1 && grid[1] == 1 && grid[2] == 1) {
+            break;
+        }
+    }
+    cache->slot_count = atlas_x * atlas_y * atlas_z;
+    cache->brick_slot = (int32_t*)malloc(cache->brick_count * sizeof(int32_t));
+    cache->slot_brick = (int32_t*)malloc(cache->slot_count * sizeof(int32_t));
+    cache->slot_used = (uint64_t*)calloc(cache->slot_count, sizeof(uint64_t));
+    cache->slot_prev = (int32_t*)malloc(cache->slot_count * sizeof(int32_t));
+    cache->slot_next = (int32_t*)malloc(cache->slot_count * sizeof(int32_t));
+    cache->page_table = (uint8_t*)calloc((size_t)grid_x * grid_y * grid_z, 4);
+    if (!cache->brick_slot || !cache->slot_brick || !cache->slot_used || !cache->slot_prev || !cache->slot_next || !cache->page_table) {
+        brick_cache_free(cache);
+        return false;
+    }
+    for (int i = 0; i < cache->brick_count; i++) {
+        cache->brick_slot[i] = -1;
+    }
+    // All slots start out empty on the LRU list so they get handed out before anything is evicted
+    cache->lru_head = cache->lru_tail = -1;
+    for (int i = 0; i < cache->slot_count; i++) {
+        cache->slot_brick[i] = -1;
+        cache->slot_prev[i] = cache->slot_next[i] = -1;
+        brick_cache_push_front(cache, i);
+    }
+    cache->page_table_dirty = true;
+    return true;
+}
+
+int brick_cache_brick_index(const brick_cache_t* cache, int level, int bx, int by, int bz) {
+    const int* grid = cache->level_grid[level];
+    return cache->level_offset[level] + (bz * grid[1] + by) * grid[0] + bx;
+}
+
+// Inverse of brick_cache_brick_index
+void brick_cache_brick_coords(const brick_cache_t* cache, int brick, int* level, int* bx, int* by, int* bz) {
+    int l = cache->levels - 1;
+    while (brick < cache->level_offset[l]) {
+        l--;
+    }
+    const int* grid = cache->level_grid[l];
+    int local = brick - cache->level_offset[l];
+    *level = l;
+    *bx = local % grid[0];
+    *by = (local / grid[0]) % grid[1];
+    *bz = local / (grid[0] * grid[1]);
+}
+
+// Start a new frame. Bricks touched from here on are protected from eviction until the next call
+void brick_cache_begin_frame(brick_cache_t* cache) {
+    cache->frame++;
+}
+
+// Mark a brick as needed this frame. Returns its slot, or -1 if it isn't resident
+int brick_cache_touch(brick_cache_t* cache, int brick) {
+    int32_t slot = cache->brick_slot[brick];
+    if (slot >= 0) {
+        cache->slot_used[slot] = cache->frame;
+        brick_cache_unlink(cache, slot);
+        brick_cache_push_front(cache, slot);
+    }
+    return slot;
+}
+
+// Find a slot for a brick that isn't resident, evicting the least recently used brick if the atlas is full.
+// Bricks touched this frame are never evicted; returns -1 if every slot is in use by one of them.
+// The evicted brick (or -1) is written to evicted_brick if it's not NULL
+int brick_cache_acquire(brick_cache_t* cache, int brick, int* evicted_brick) {
+    assert(cache->brick_slot[brick] < 0);
+    if (evicted_brick) *evicted_brick = -1;
+
+    int32_t slot = cache->lru_tail;
+    if (slot < 0) {
+        return -1;
+    }
+    int32_t old = cache->slot_brick[slot];
+    if (old >= 0) {
+        if (cache->slot_used[slot] == cache->frame) {
+            return -1;
+        }
+        cache->brick_slot[old] = -1;
+        cache->resident_count--;
+        if (evicted_brick) *evicted_brick = old;
+    }
+
+    cache->slot_brick[slot] = brick;
+    cache->brick_slot[brick] = slot;
+    cache->slot_used[slot] = cache->frame;
+    brick_cache_unlink(cache, slot);
+    brick_cache_push_front(cache, slot);
+    cache->resident_count++;
+    return slot;
+}
+
+// Point every level 0 page table entry at a resident brick covering it: the level in wanted_level (one per level 0
+// brick, 255 for don't care) if it's there, otherwise the nearest coarser one, otherwise the nearest finer one.
+// Acquiring can evict bricks the table still points at, so call this after the last acquire of a frame
+void brick_cache_update_page_table(brick_cache_t* cache, const uint8_t* wanted_level) {
+    for (int bz = 0; bz < cache->grid_z; bz++) {
+        for (int by = 0; by < cache->grid_y; by++) {
+            for (int bx = 0; bx < cache->grid_x; bx++) {
+                int index = (bz * cache->grid_y + by) * cache->grid_x + bx;
+                int wanted = HMM_MIN(wanted_level[index], cache->levels - 1);
+                int32_t slot = -1;
+                int level = 0;
+                for (int l = wanted; l < cache->levels && slot < 0; l++) {
+                    slot = cache->brick_slot[brick_cache_brick_index(cache, l, bx >> l, by >> l, bz >> l)];
+                    level = l;
+                }
+                for (int l = wanted - 1; l >= 0 && slot < 0; l--) {
+                    slot = cache->brick_slot[brick_cache_brick_index(cache, l, bx >> l, by >> l, bz >> l)];
+                    level = l;
+                }
+
+                uint8_t entry[4] = { 0, 0, 0, 0 };
+                if (slot >= 0) {
+                    entry[0] = (uint8_t)(slot % cache->atlas_x);
+                    entry[1] = (uint8_t)((slot / cache->atlas_x) % cache->atlas_y);
+                    entry[2] = (uint8_t)(slot / (cache->atlas_x * cache->atlas_y));
+                    entry[3] = (uint8_t)(level + 1);
+                }
+                if (memcmp(&cache->page_table[index * 4], entry, 4) != 0) {
+                    memcpy(&cache->page_table[index * 4], entry, 4);
+                    cache->page_table_dirty = true;
+                }
+            }
+        }
+    }
+}
+
+// Modification time of a file, to tell whether what was built from it is still current
+static int64_t file_mtime_ns(const struct stat* info) {
+#if defined(__APPLE__)
+    return (int64_t)info->st_mtimespec.tv_sec * 1000000000 + info->st_mtimespec.tv_nsec;
+#else
+    return (int64_t)info->st_mtim.tv_sec * 1000000000 + info->st_mtim.tv_nsec;
+#endif
+}
+
+// Where bricks get read from. read_brick fills dst with BRICK_SIZE^3 voxels (x fastest) of the brick at (bx, by, bz)
+// on the given mip level, zero padding anything past the edge of the volume. Sources without stored mips build
+// coarser bricks with the given reduction. Bricks are read on a loader thread, one at a time; cancel (if set) may
+// be called from any thread to make a read in progress give up, ahead of closing the source
+typedef struct {
+    bool (*read_brick)(void* user, int level, int bx, int by, int bz, volume_reduce_t reduce, uint8_t* dst);
+    void (*cancel)(void* user);
+    void (*close)(void* user);
+    void* user;
+} brick_source_t;
+
+// Brick source reading straight from an uncompressed 8-bit raw volume file.
+// The file is mapped rather than read, since a coarse brick has to go through every voxel it covers. That only happens
+// once per brick: coarse bricks are kept in a file next to the volume (scan.raw.bricks) as they get built. It is this
+// header, a byte per coarse brick saying whether it's in yet, then the bricks from the next page boundary on, and
+// stays sparse until they are. It starts over whenever the volume's size or modification time, or the reduction
+// asked for, differs from what the header recorded
+#define BRICK_FILE_VERSION 1
+
+typedef struct {
+    char magic[4]; // "WBRK"
+    uint32_t version;
+    uint64_t source_size;
+    int64_t source_mtime_ns;
+    int32_t width, height, depth;
+    int32_t reduce;
+    uint64_t brick_count; // Coarse bricks, every level above 0
+    uint64_t data_offset;
+} brick_file_header_t;
+
+typedef struct {
+    int fd;
+    const uint8_t* data;
+    size_t size;
+    int width, height, depth;
+    uint8_t* children[BRICK_MAX_LEVELS]; // Per level scratch: 8 child bricks, then room for one more brick
+    atomic_bool cancelled;
+    int grid[3];                         // Level 0 bricks along each axis
+    int coarse_offset[BRICK_MAX_LEVELS]; // Index of each coarse level's first brick in the brick file
+    int bricks_fd;                       // Brick file, -1 without one, when coarse bricks get built every time
+    brick_file_header_t header;
+    uint8_t* built;                      // Per coarse brick: 1 once it's in the brick file
+} raw_brick_file_t;
+
+// Index of a coarse brick (level 1 and up) in the brick file, or -1 if it lies entirely past the edge of the volume
+static int raw_brick_coarse_index(const raw_brick_file_t* file, int level, int bx, int by, int bz) {
+    const int grid_x = (file->grid[0] + (1 << level) - 1) >> level;
+    const int grid_y = (file->grid[1] + (1 << level) - 1) >> level;
+    const int grid_z = (file->grid[2] + (1 << level) - 1) >> level;
+    if (bx >= grid_x || by >= grid_y || bz >= grid_z) {
+        return -1;
+    }
+    return file->coarse_offset[level] + (bz * grid_y + by) * grid_x + bx;
+}
+
+// Empty the brick file and start it over for bricks reduced with reduce. Drops it if it can't be written
+static void raw_brick_file_reset(raw_brick_file_t* file, volume_reduce_t reduce) {
+    const uint64_t size = file->header.data_offset + file->header.brick_count * BRICK_SIZE * BRICK_SIZE * BRICK_SIZE;
+    file->header.reduce = (int32_t)reduce;
+    memset(file->built, 0, file->header.brick_count);
+    // Truncating to nothing first leaves a hole where the old bricks were
+    if (ftruncate(file->bricks_fd, 0) != 0 || ftruncate(file->bricks_fd, (off_t)size) != 0 ||
+        pwrite(file->bricks_fd, &file->header, sizeof(file->header), 0) != (ssize_t)sizeof(file->header)) {
+        LOG_PRINTF(LOG_LEVEL_INFO, "Failed to write the brick file of a %dx%dx%d volume, coarse bricks will be built whenever they're needed\n",
+                   file->width, file->height, file->depth);
+        close(file->bricks_fd);
+        file->bricks_fd = -1;
+    }
+}
+
+// Open the brick file of the raw volume at path, with the given stat, keeping whatever coarse bricks are in it if it's current
+static void raw_brick_file_open(raw_brick_file_t* file, const char* path, const struct stat* source, int brick_count) {
+    char bricks_path[1100];
+    snprintf(bricks_path, sizeof(bricks_path), "%s.bricks", path);
+    file->header = (brick_file_header_t){
+        .magic = { 'W', 'B', 'R', 'K' },
+        .version = BRICK_FILE_VERSION,
+        .source_size = (uint64_t)source->st_size,
+        .source_mtime_ns = file_mtime_ns(source),
+        .width = file->width,
+        .height = file->height,
+        .depth = file->depth,
+        .reduce = VOLUME_REDUCE_MEAN,
+        .brick_count = (uint64_t)brick_count,
+        .data_offset = (sizeof(brick_file_header_t) + (uint64_t)brick_count + 4095) & ~(uint64_t)4095,
+    };
+    file->built = (uint8_t*)calloc(brick_count + 1, 1);
+    file->bricks_fd = file->built ? open(bricks_path, O_RDWR | O_CREAT, 0644) : -1;
+    if (file->bricks_fd < 0) {
+        LOG_PRINTF(LOG_LEVEL_INFO, "Can't keep coarse bricks in %s, they'll be built whenever they're needed\n", bricks_path);
+        return;
+    }
+    // The file holds the bricks of whichever reduction was asked for last
+    brick_file_header_t header;
+    bool current = pread(file->bricks_fd, &header, sizeof(header), 0) == (ssize_t)sizeof(header) &&
+                   (header.reduce == VOLUME_REDUCE_MEAN || header.reduce == VOLUME_REDUCE_MAX);
+    if (current) {
+        file->header.reduce = header.reduce;
+        current = memcmp(&header, &file->header, sizeof(header)) == 0 &&
+                  pread(file->bricks_fd, file->built, brick_count, sizeof(header)) == (ssize_t)brick_count;
+    }
+    if (!current) {
+        LOG_PRINTF(LOG_LEVEL_DEBUG, "Brick file %s is out of date or damaged\n", bricks_path);
+        raw_brick_file_reset(file, VOLUME_REDUCE_MEAN);
+    }
+}
+
+static bool raw_brick_read(void* user, int level, int bx, int by, int bz, volume_reduce_t reduce, uint8_t* dst) {
+    raw_brick_file_t* file = (raw_brick_file_t*)user;
+    const int size = BRICK_SIZE;
+    if (level == 0) {
+        memset(dst, 0, size * size * size);
+        int x0 = bx * size, y0 = by * size, z0 = bz * size;
+        int row = file->width - x0 < size ? file->width - x0 : size;
+        // Children of coarse bricks can lie entirely past the edge
+        for (int z = 0; row > 0 && z < size && z0 + z < file->depth; z++) {
+            for (int y = 0; y < size && y0 + y < file->height; y++) {
+                size_t offset = (((size_t)(z0 + z) * file->height + (y0 + y)) * file->width) + x0;
+                memcpy(&dst[(z * size + y) * size], &file->data[offset], row);
+            }
+        }
+        return true;
+    }
+    if (atomic_load_explicit(&file->cancelled, memory_order_relaxed)) {
+        return false;
+    }
+
+    // Coarser bricks built before come straight from the brick file
+    const size_t brick_bytes = (size_t)size * size * size;
+    const int index = raw_brick_coarse_index(file, level, bx, by, bz);
+    if (index < 0) {
+        memset(dst, 0, brick_bytes);
+        return true;
+    }
+    const off_t offset = (off_t)(file->header.data_offset + (uint64_t)index * brick_bytes);
+    if (file->bricks_fd >= 0 && (int32_t)reduce != file->header.reduce) {
+        raw_brick_file_reset(file, reduce);
+    }
+    if (file->bricks_fd >= 0 && file->built[index] && pread(file->bricks_fd, dst, brick_bytes, offset) == (ssize_t)brick_bytes) {
+        return true;
+    }
+
+    // The rest are reduced from their eight children, one level at a time
+    uint8_t* children = file->children[level];
+    if (!children) {
+        children = file->children[level] = (uint8_t*)malloc(brick_bytes * 9);
+        if (!children) {
+            return false;
+        }
+    }
+    uint8_t* child = children + brick_bytes * 8;
+    for (int cz = 0; cz < 2; cz++) {
+        for (int cy = 0; cy < 2; cy++) {
+            for (int cx = 0; cx < 2; cx++) {
+                if (!raw_brick_read(user, level - 1, bx * 2 + cx, by * 2 + cy, bz * 2 + cz, reduce, child)) {
+                    return false;
+                }
+                for (int z = 0; z < size; z++) {
+                    for (int y = 0; y < size; y++) {
+                        size_t offset = ((size_t)(cz * size + z) * 2 * size + (cy * size + y)) * 2 * size + cx * size;
+                        memcpy(&children[offset], &child[(z * size + y) * size], size);
+                    }
+                }
+            }
+        }
+    }
+    volume_reduce(children, size * 2, size * 2, size * 2, dst, reduce, VOLUME_UINT8);
+
+    // The flag only goes in once the brick did, so a brick that didn't make it gets built again
+    if (file->bricks_fd >= 0 && pwrite(file->bricks_fd, dst, brick_bytes, offset) == (ssize_t)brick_bytes) {
+        file->built[index] = pwrite(file->bricks_fd, &(uint8_t){ 1 }, 1, sizeof(brick_file_header_t) + index) == 1;
+    }
+    return true;
+}
+
+static void raw_brick_cancel(void* user) {
+    raw_brick_file_t* file = (raw_brick_file_t*)user;
+    atomic_store(&file->cancelled, true);
+}
+
+static void raw_brick_close(void* user) {
+    raw_brick_file_t* file = (raw_brick_file_t*)user;
+    munmap((void*)file->data, file->size);
+    close(file->fd);
+    if (file->bricks_fd >= 0) {
+        close(file->bricks_fd);
+    }
+    for (int i = 0; i < BRICK_MAX_LEVELS; i++) {
+        free(file->children[i]);
+    }
+    free(file->built);
+    free(file);
+}
+
+// Open a raw uint8 volume of width x height x depth voxels as a brick source
+bool open_raw_brick_source(brick_source_t* source, const char* path, int width, int height, int depth) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        printf("Failed to open raw volume: %s\n", path);
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || (size_t)info.st_size < (size_t)width * height * depth) {
+        printf("Raw volume %s is smaller than %dx%dx%d voxels\n", path, width, height, depth);
+        close(fd);
+        return false;
+    }
+    void* data = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    raw_brick_file_t* file = (raw_brick_file_t*)calloc(1, sizeof(raw_brick_file_t));
+    if (data == MAP_FAILED || !file) {
+        printf("Failed to map raw volume: %s\n", path);
+        if (data != MAP_FAILED) munmap(data, info.st_size);
+        free(file);
+        close(fd);
+        return false;
+    }
+    file->fd = fd;
+    file->data = (const uint8_t*)data;
+    file->size = info.st_size;
+    file->width = width;
+    file->height = height;
+    file->depth = depth;
+    atomic_init(&file->cancelled, false);
+
+    // Same levels as the brick cache, stopping once a single brick covers the volume
+    file->grid[0] = (width + BRICK_SIZE - 1) / BRICK_SIZE;
+    file->grid[1] = (height + BRICK_SIZE - 1) / BRICK_SIZE;
+    file->grid[2] = (depth + BRICK_SIZE - 1) / BRICK_SIZE;
+    int coarse_count = 0;
+    for (int level = 1; level < BRICK_MAX_LEVELS; level++) {
+        const int above = level - 1;
+        if (((file->grid[0] + (1 << above) - 1) >> above) == 1 && ((file->grid[1] + (1 << above) - 1) >> above) == 1 &&
+            ((file->grid[2] + (1 << above) - 1) >> above) == 1) {
+            break;
+        }
+        file->coarse_offset[level] = coarse_count;
+        coarse_count += ((file->grid[0] + (1 << level) - 1) >> level) * ((file->grid[1] + (1 << level) - 1) >> level) *
+                        ((file->grid[2] + (1 << level) - 1) >> level);
+    }
+    raw_brick_file_open(file, path, &info, coarse_count);
+    *source = (brick_source_t){ .read_brick = raw_brick_read, .cancel = raw_brick_cancel, .close = raw_brick_close, .user = file };
+    return true;
+}
+
+typedef struct {
+    int brick;
+    float distance;
+} brick_request_t;
+
+typedef enum {
+    BRICK_LOAD_FREE,
+    BRICK_LOAD_WANTED,  // Waiting for the loader thread
+    BRICK_LOAD_READING,
+    BRICK_LOAD_READ,    // Waiting for the frame loop to upload it
+    BRICK_LOAD_FAILED
+} brick_load_state_t;
+
+// A brick on its way from the source to the atlas
+typedef struct {
+    brick_load_state_t state;
+    int brick;
+    float distance;         // From the eye when last asked for, the loader reads the nearest first
+    volume_reduce_t reduce;
+    uint8_t* voxels;        // BRICK_SIZE^3, written by the loader while reading
+} brick_load_t;
+
+// GPU side of a bricked volume
+typedef struct {
+    brick_cache_t cache;
+    brick_source_t source;
+    sg_image atlas;          // BRICK_ATLAS_X/Y/Z slots of BRICK_SIZE^3 R8 voxels
+    sg_image page_table;     // One RGBA8 texel per brick
+    uint8_t* atlas_mirror;   // CPU copy of the atlas, only kept on backends without partial uploads
+    bool atlas_dirty;
+    brick_request_t* visible; // Scratch list of bricks wanted this frame, at most one per brick
+    int32_t* request_of;     // Per brick: its index in visible, or -1
+    uint8_t* wanted_level;   // Per level 0 brick: mip level the camera distance calls for, 255 when out of view
+    // Bricks are read by a loader thread, so frames never wait on the disk or on building coarse levels
+    brick_load_t loads[BRICK_LOADS];
+    pthread_mutex_t lock;    // Guards the states of loads, and the stop flag
+    pthread_cond_t wake;     // Signalled when there are bricks to read, or it's time to stop
+    pthread_t loader;
+    bool loader_running;
+    bool loader_stop;
+    int visible_last_frame;
+    int loads_last_frame;    // Bricks uploaded
+    int loads_pending;       // Bricks asked for and not uploaded yet
+} bricked_volume_t;
+
+#if defined(SOKOL_METAL)
+// Region uploads on Metal go through a few fixed staging buffers, filled in turn, so no upload holds a second copy of
+// more than STAGING_SIZE bytes however big its box. A buffer is only refilled once the GPU is done copying out of it
+#define STAGING_SIZE (16 << 20)
+#define STAGING_BUFFERS 2
+#define STAGING_ALIGN 256 // Blits read from offsets that are a multiple of the texel or block size
+
+static struct {
+    id<MTLBuffer> buffers[STAGING_BUFFERS];
+    id<MTLCommandBuffer> last_blit[STAGING_BUFFERS]; // Latest command buffer copying out of each buffer
+    int current;
+    size_t used; // Bytes of the current buffer taken
+} staging;
+
+// All update_image_region needs from sokol_gfx's internals: the queue frames are committed to, and how the rows of
+// a w x h region of format are laid out (block rows block_height texels high, each row_size bytes, for compressed ones)
+static id<MTLCommandQueue> mtl_region_layout(sg_pixel_format format, int w, int h, int* block_height, int* rows, size_t* row_size) {
+    *block_height = _sg_is_compressed_pixel_format(format) ? 4 : 1;
+    *rows = _sg_num_rows(format, h);
+    *row_size = (size_t)_sg_row_pitch(format, w, 1);
+    return _sg.mtl.cmd_queue;
+}
+
+// Commit the blits copying out of the current staging buffer
+static void staging_commit(id<MTLCommandBuffer> cmd_buffer, id<MTLBlitCommandEncoder> blit) {
+    [blit endEncoding];
+    [cmd_buffer commit];
+    if (staging.last_blit[staging.current] != nil) {
+        _SG_OBJC_RELEASE(staging.last_blit[staging.current]);
+    }
+    staging.last_blit[staging.current] = cmd_buffer;
+    _SG_OBJC_RETAIN(staging.last_blit[staging.current]);
+}
+#endif
+
+// Give the staging buffers back, before sokol_gfx shuts down
+static void free_staging(void) {
+#if defined(SOKOL_METAL)
+    for (int i = 0; i < STAGING_BUFFERS; i++) {
+        if (staging.last_blit[i] != nil) {
+            [staging.last_blit[i] waitUntilCompleted];
+            _SG_OBJC_RELEASE(staging.last_blit[i]);
+        }
+        if (staging.buffers[i] != nil) {
+            _SG_OBJC_RELEASE(staging.buffers[i]);
+        }
+    }
+#endif
+}
+
+// Upload a box of voxels into one mip level of an existing 3D image without touching the rest of it.
+// sokol_gfx can only replace whole images, so on Metal this copies into the texture itself. Frames still in flight
+// may be reading the texture, so rather than writing it from the CPU the box goes through the staging buffers, a slab
+// of slices (or of rows, if one slice doesn't fit) at a time, and is blitted in from command buffers on sokol_gfx's
+// queue, which run after the frames already submitted and before the next.
+// Returns false if the backend has no partial path; the caller then has to re-upload the whole image
+static bool update_image_region(sg_image img, int mip, int x, int y, int z, int w, int h, int d, const void* data, int bytes_per_row, int bytes_per_slice) {
+#if defined(SOKOL_METAL)
+    sg_mtl_image_info info = sg_mtl_query_image_info(img);
+    id<MTLTexture> tex = (__bridge id<MTLTexture>)info.tex[info.active_slot];
+    if (tex == nil) {
+        return false;
+    }
+    int block_height, rows;
+    size_t row_size;
+    id<MTLCommandQueue> queue = mtl_region_layout(sg_query_image_desc(img).pixel_format, w, h, &block_height, &rows, &row_size);
+    if (row_size > STAGING_SIZE) {
+        return false;
+    }
+    const size_t slice_size = row_size * rows;
+    const size_t fit = slice_size <= STAGING_SIZE ? STAGING_SIZE / slice_size : 1;
+    const int slab_slices = fit < (size_t)d ? (int)fit : d;
+    const int slab_rows = slice_size <= STAGING_SIZE ? rows : (int)(STAGING_SIZE / row_size);
+
+    id<MTLCommandBuffer> cmd_buffer = nil;
+    id<MTLBlitCommandEncoder> blit = nil;
+    for (int slab_z = 0; slab_z < d; slab_z += slab_slices) {
+        for (int slab_row = 0; slab_row < rows; slab_row += slab_rows) {
+            const int slices = HMM_MIN(slab_slices, d - slab_z), count = HMM_MIN(slab_rows, rows - slab_row);
+            const size_t size = row_size * count * slices;
+            // Move on to the next buffer when this one is full, once the GPU has copied everything out of it
+            if (staging.used + size > STAGING_SIZE) {
+                if (cmd_buffer != nil) {
+                    staging_commit(cmd_buffer, blit);
+                    cmd_buffer = nil;
+                }
+                staging.current = (staging.current + 1) % STAGING_BUFFERS;
+                staging.used = 0;
+                if (staging.last_blit[staging.current] != nil) {
+                    [staging.last_blit[staging.current] waitUntilCompleted];
+                    _SG_OBJC_RELEASE(staging.last_blit[staging.current]);
+                }
+            }
+            id<MTLBuffer> buffer = staging.buffers[staging.current];
+            if (buffer == nil) {
+                buffer = [(__bridge id<MTLDevice>)sg_mtl_device() newBufferWithLength:STAGING_SIZE options:MTLResourceStorageModeShared];
+                if (buffer == nil) {
+                    if (cmd_buffer != nil) {
+                        staging_commit(cmd_buffer, blit);
+                    }
+                    return false;
+                }
+                staging.buffers[staging.current] = buffer;
+            }
+            uint8_t* dst = (uint8_t*)[buffer contents] + staging.used;
+            for (int s = 0; s < slices; s++) {
+                for (int r = 0; r < count; r++) {
+                    memcpy(&dst[((size_t)s * count + r) * row_size],
+                           &((const uint8_t*)data)[(size_t)(slab_z + s) * bytes_per_slice + (size_t)(slab_row + r) * bytes_per_row], row_size);
+                }
+            }
+            if (cmd_buffer == nil) {
+                cmd_buffer = [queue commandBuffer];
+                blit = [cmd_buffer blitCommandEncoder];
+            }
+            [blit copyFromBuffer:buffer
+                     sourceOffset:staging.used
+                sourceBytesPerRow:row_size
+              sourceBytesPerImage:row_size * count
+                       sourceSize:MTLSizeMake(w, HMM_MIN(count * block_height, h - slab_row * block_height), slices)
+                        toTexture:tex
+                 destinationSlice:0
+                 destinationLevel:mip
+                destinationOrigin:MTLOriginMake(x, y + slab_row * block_height, z + slab_z)];
+            staging.used += (size + STAGING_ALIGN - 1) / STAGING_ALIGN * STAGING_ALIGN;
+        }
+    }
+    if (cmd_buffer != nil) {
+        staging_commit(cmd_buffer, blit);
+    }
+    return true;
+#else
+    (void)img; (void)mip; (void)x; (void)y; (void)z; (void)w; (void)h; (void)d; (void)data; (void)bytes_per_row; (void)bytes_per_slice;
+    return false;
+#endif
+}
+
+// Extract the six clip planes (a, b, c, d with ax + by + cz + d >= 0 inside) from a view projection matrix
+void frustum_planes(hmm_mat4 m, hmm_vec4 planes[6]) {
+    for (int i = 0; i < 3; i++) {
+        for (int side = 0; side < 2; side++) {
+            float sign = side == 0 ? 1.0f : -1.0f;
+            hmm_vec4 p = HMM_Vec4(m.Elements[0][3] + sign * m.Elements[0][i],
+                                  m.Elements[1][3] + sign * m.Elements[1][i],
+                                  m.Elements[2][3] + sign * m.Elements[2][i],
+                                  m.Elements[3][3] + sign * m.Elements[3][i]);
+            planes[i * 2 + side] = p;
+        }
+    }
+}
+
+// True if the box isn't entirely behind any of the planes
+bool aabb_in_frustum(const hmm_vec4 planes[6], hmm_vec3 box_min, hmm_vec3 box_max) {
+    for (int i = 0; i < 6; i++) {
+        hmm_vec4 p = planes[i];
+        // Test the corner furthest along the plane normal
+        float x = p.X >= 0.0f ? box_max.X : box_min.X;
+        float y = p.Y >= 0.0f ? box_max.Y : box_min.Y;
+        float z = p.Z >= 0.0f ? box_max.Z : box_min.Z;
+        if (p.X * x + p.Y * y + p.Z * z + p.W < 0.0f) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Entities
+// An entity is a handle: the low ENTITY_INDEX_BITS of its id are the slot it lives in, the rest the generation of
+// that slot when it was created. Destroying an entity bumps its slot's generation, so handles to it stop resolving
+// instead of pointing at whatever reuses the slot. Generations start at 1, so an id of 0 is never a live entity
+#define ENTITY_INDEX_BITS 20
+#define ENTITY_INDEX_MASK ((1u << ENTITY_INDEX_BITS) - 1)
+#define ENTITY_GENERATION_MASK (UINT32_MAX >> ENTITY_INDEX_BITS)
+#define ECS_MIN_CAPACITY 64
+
+typedef struct {
+    uint32_t id;
+} entity_t;
+
+// Define component structs
+typedef struct {
+    hmm_vec3 position; // Relative to the parent
+    hmm_vec3 rotation; // Euler angles
+    hmm_mat4 _transform; // Transform of the object based on position and rotation, and those of its parents.
+    // When they disagree, the pos/rot always takes precedence and this tranform is just used for per-frame calculations
+    entity_t parent; // Entity this one moves with, an id of 0 for none
+} transform_c_t;
+
+// Mesh vertices are 12 bytes: the position quantized to 16 bits over the mesh's bounds, with a w of 1, and an 8-bit
+// color. The vertex shader gets the position back through the mesh's dequantize matrix, which is folded into the
+// model and MVP matrices it's drawn with
+typedef struct {
+    int16_t position[4];
+    uint8_t color[4];
+} mesh_vertex_t;
+
+typedef struct {
+    mesh_vertex_t* _vertices;
+    void* _indices; // uint16_t or uint32_t each, see index_type
+    unsigned _vertex_count;
+    unsigned _indices_size;
+    unsigned face_count;
+    sg_index_type index_type; // 16-bit for up to 65535 vertices, 32-bit past that
+    hmm_mat4 dequantize;      // Takes quantized positions back to the mesh's own space
+    void* _mapped;            // Set when _vertices and _indices point into a mapped cache file, which is unmapped rather than freed
+    size_t _mapped_size;
+    sg_buffer vbuf;
+    sg_buffer ibuf;
+    sg_bindings binding;
+} mesh_c_t;
+
+typedef struct {
+    // uint8_t _volume[50 * 50 * 50]; // All volumes come in increments of 500x500x500 // TODO malloc
+    uint8_t* _volume;  // Pointer to dynamically allocated volume data, width * height * depth voxels of type, x fastest
+    volume_type_t type;
+    void* _mapped;     // Set when _volume points into a mapped file instead, which is unmapped rather than freed
+    size_t _mapped_size;
+    int width;         // Voxel counts along x, y and z
+    int height;
+    int depth;
+    hmm_vec3 spacing;  // Size of one voxel in world units along each axis
+    float window;      // Range of stored values the colormap spans, in stored units (0..255 for uint8, 0..65535 for uint16)
+    float level;       // Value at the middle of that range
+    bool window_set;   // The window came from set_volume_window rather than from the data
+    hmm_vec3 position; // Position of the volume
+    int mip_levels;    // Levels in img, down to a single voxel
+    uint8_t* _mips[SG_MAX_MIPMAPS]; // CPU copy of every level, _mips[0] is _volume and the rest share one allocation
+    volume_reduce_t mip_reduce; // How each mip level is reduced from the one above
+    macro_grid_t cells; // Which parts of the volume rays can skip
+    bool compressed;   // Keep the volume as BC4 on the GPU, uint8 volumes only. Set with set_volume_compression
+    uint8_t* _blocks[SG_MAX_MIPMAPS]; // CPU copy of the BC4 blocks of every level while compressed, one allocation
+    sg_image img;      // On Metal immutable, with edits written into it. Elsewhere dynamic unless compressed, when edits recreate it
+    sg_image occupancy_img; // One R8 texel per macro cell
+    bool upload_pending; // The CPU copy changed since the last upload
+    uint32_t revision;   // Goes up with every change to the voxels
+    bool occupancy_pending; // The macro cells were reclassified since the last upload
+    int dirty_box[6];  // Voxels changed since the last upload, [x0, y0, z0] to [x1, y1, z1) exclusive
+    sg_buffer vbuf;
+    bricked_volume_t* bricks; // Set for out-of-core volumes, which have no _volume or img and page bricks in instead
+    struct volume_stream_t* stream; // Set while chunks of the volume are still being read in the background
+} volume_c_t;
+
+// Components of one type, packed so systems only ever walk live ones. sparse maps an entity's slot to its
+// component, entities maps each component back to its entity. A component can be split over several columns,
+// each packed on its own, so systems can stream through just the fields they work on. Removing swaps the last
+// component into the hole, so pointers into the columns only last until the next add or remove on the same set
+#define COMPONENT_MAX_COLUMNS 16
+
+typedef struct {
+    int column_count;
+    size_t sizes[COMPONENT_MAX_COLUMNS];    // Bytes per component in each column
+    uint8_t* columns[COMPONENT_MAX_COLUMNS]; // count components each
+    entity_t* entities;  // Owner of each component
+    uint32_t* sparse;    // Per entity slot, the index of its component plus one, 0 if it has none
+    uint32_t count;
+    uint32_t capacity;
+} component_set_t;
+
+// Transforms are kept as columns of floats for the transform system, with the model matrices it builds from them and
+// the model view projection matrix it was last drawn with. All stay cached until the transform or camera changes.
+// The set is kept in depth first order of the hierarchy, so parents come before their children and every subtree
+// is one run of indices, which the system updates front to back in a single pass
+enum {
+    TRANSFORM_POSITION_X,
+    TRANSFORM_POSITION_Y,
+    TRANSFORM_POSITION_Z,
+    TRANSFORM_ROTATION_X,
+    TRANSFORM_ROTATION_Y,
+    TRANSFORM_ROTATION_Z,
+    TRANSFORM_LOCAL,  // hmm_mat4 relative to the parent
+    TRANSFORM_WORLD,  // hmm_mat4, the parent's WORLD times LOCAL
+    TRANSFORM_MVP,
+    TRANSFORM_DIRTY,  // Set while position or rotation changed since the matrices were built
+    TRANSFORM_PARENT, // entity_t, an id of 0 for roots
+    TRANSFORM_PARENT_INDEX, // uint32_t index of the parent, UINT32_MAX for roots
+    TRANSFORM_SUBTREE_END,  // uint32_t index just past the last of its descendants
+    TRANSFORM_COLUMNS
+};
+
+// ECS Global struct
+static struct {
+    uint32_t* generations; // Per slot, the generation of the entity in it, or of the next one if it's free
+    bool* alive;
+    uint32_t* free_slots;  // Slots of destroyed entities, reused before new ones
+    uint32_t free_count;
+    uint32_t slot_count;   // Slots handed out so far
+    uint32_t capacity;     // Slots allocated, every sparse array is this long
+    uint32_t entity_count;
+    uint32_t revision;     // Goes up whenever a component is added or removed, a transform moves or a mesh changes
+
+    entity_t* dirty_transforms; // Entities whose transforms were marked dirty, some may be gone since
+    uint32_t* dirty_indices;    // Where the dirty ones are, while they're being rebuilt
+    uint32_t dirty_count;
+    uint32_t dirty_capacity;
+    bool dirty_overflow;        // Out of room for the list, every transform gets rebuilt
+    hmm_mat4 view_proj;         // What the cached MVPs were built with
+    bool transforms_unsorted;   // Transforms were removed or reparented since they were last put in order
+
+    component_set_t transforms; // Transforms of each object, see TRANSFORM_COLUMNS
+    component_set_t meshes;     // Object mesh buffer
+    component_set_t volumes;    // 3D volume buffer
+} ecs = {
+    .transforms = {
+        .column_count = TRANSFORM_COLUMNS,
+        .sizes = {
+            [TRANSFORM_POSITION_X ... TRANSFORM_ROTATION_Z] = sizeof(float),
+            [TRANSFORM_LOCAL ... TRANSFORM_MVP] = sizeof(hmm_mat4),
+            [TRANSFORM_DIRTY] = sizeof(uint8_t),
+            [TRANSFORM_PARENT] = sizeof(entity_t),
+            [TRANSFORM_PARENT_INDEX ... TRANSFORM_SUBTREE_END] = sizeof(uint32_t)
+        }
+    },
+    .meshes     = { .column_count = 1, .sizes = { sizeof(mesh_c_t) } },
+    .volumes    = { .column_count = 1, .sizes = { sizeof(volume_c_t) } }
+};
+
+static inline uint32_t entity_slot(entity_t entity) {
+    return entity.id & ENTITY_INDEX_MASK;
+}
+
+static inline entity_t entity_from_slot(uint32_t slot) {
+    return (entity_t){ ecs.generations[slot] << ENTITY_INDEX_BITS | slot };
+}
+
+bool entity_alive(entity_t entity) {
+    const uint32_t slot = entity_slot(entity);
+    return entity.id != 0 && slot < ecs.slot_count && ecs.alive[slot] && entity_from_slot(slot).id == entity.id;
+}
+
+// Grow the entity slots, and the sparse arrays of every component set with them, to hold at least capacity
+static bool ecs_reserve(uint32_t capacity) {
+    if (capacity <= ecs.capacity) {
+        return true;
+    }
+    uint32_t grown = HMM_MAX(ecs.capacity * 2, ECS_MIN_CAPACITY);
+    grown = HMM_MAX(grown, capacity);
+    grown = HMM_MIN(grown, ENTITY_INDEX_MASK + 1);
+    if (grown < capacity) {
+        return false;
+    }
+    component_set_t* sets[] = { &ecs.transforms, &ecs.meshes, &ecs.volumes };
+    void* generations = realloc(ecs.generations, grown * sizeof(uint32_t));
+    if (generations) ecs.generations = (uint32_t*)generations;
+    void* alive = realloc(ecs.alive, grown * sizeof(bool));
+    if (alive) ecs.alive = (bool*)alive;
+    void* free_slots = realloc(ecs.free_slots, grown * sizeof(uint32_t));
+    if (free_slots) ecs.free_slots = (uint32_t*)free_slots;
+    bool ok = generations && alive && free_slots;
+    for (int i = 0; ok && i < 3; i++) {
+        void* sparse = realloc(sets[i]->sparse, grown * sizeof(uint32_t));
+        if (!sparse) {
+            ok = false;
+            break;
+        }
+        sets[i]->sparse = (uint32_t*)sparse;
+        memset(&sets[i]->sparse[ecs.capacity], 0, (grown - ecs.capacity) * sizeof(uint32_t));
+    }
+    if (!ok) {
+        // Whatever did grow is kept, capacity stays what every array has
+        return false;
+    }
+    ecs.capacity = grown;
+    return true;
+}
+
+// Make a new entity without any components. Returns an id of 0 if there's no room for it
+entity_t create_entity(void) {
+    uint32_t slot;
+    if (ecs.free_count > 0) {
+        slot = ecs.free_slots[--ecs.free_count];
+    } else {
+        if (!ecs_reserve(ecs.slot_count + 1)) {
+            printf("Failed to allocate memory for entity %u!\n", ecs.slot_count);
+            return (entity_t){ 0 };
+        }
+        slot = ecs.slot_count++;
+        ecs.generations[slot] = 1;
+    }
+    ecs.alive[slot] = true;
+    ecs.entity_count++;
+    return entity_from_slot(slot);
+}
+
+// Index of entity's component in set, or UINT32_MAX if the entity is gone or doesn't have one
+static uint32_t component_find(const component_set_t* set, entity_t entity) {
+    if (!entity_alive(entity)) {
+        return UINT32_MAX;
+    }
+    return set->sparse[entity_slot(entity)] - 1;
+}
+
+// First column of the index-th component of a set, which is all of it for single column sets
+static inline void* component_at(const component_set_t* set, uint32_t index) {
+    return set->columns[0] + (size_t)index * set->sizes[0];
+}
+
+// The component of entity in set, or NULL if the entity is gone or doesn't have one
+static void* component_get(const component_set_t* set, entity_t entity) {
+    const uint32_t index = component_find(set, entity);
+    return index == UINT32_MAX ? NULL : component_at(set, index);
+}
+
+// The component of entity in set, added zeroed if it doesn't have one yet. NULL if the entity is gone or out of memory
+static void* component_add(component_set_t* set, entity_t entity) {
+    void* component = component_get(set, entity);
+    if (component || !entity_alive(entity)) {
+        return component;
+    }
+    if (set->count == set->capacity) {
+        uint32_t capacity = HMM_MAX(set->capacity * 2, ECS_MIN_CAPACITY);
+        bool ok = true;
+        for (int c = 0; c < set->column_count; c++) {
+            void* column = realloc(set->columns[c], capacity * set->sizes[c]);
+            if (column) set->columns[c] = (uint8_t*)column;
+            ok = ok && column;
+        }
+        void* entities = realloc(set->entities, capacity * sizeof(entity_t));
+        if (entities) set->entities = (entity_t*)entities;
+        if (!ok || !entities) {
+            printf("Failed to allocate memory for %u components!\n", capacity);
+            return NULL;
+        }
+        set->capacity = capacity;
+    }
+    for (int c = 0; c < set->column_count; c++) {
+        memset(set->columns[c] + (size_t)set->count * set->sizes[c], 0, set->sizes[c]);
+    }
+    set->entities[set->count] = entity;
+    set->sparse[entity_slot(entity)] = ++set->count;
+    ecs.revision++;
+    return component_at(set, set->count - 1);
+}
+
+// Drop entity's component from set, if it has one. Whatever the component owns has to be freed first
+static void component_remove(component_set_t* set, entity_t entity) {
+    const uint32_t index = component_find(set, entity);
+    if (index == UINT32_MAX) {
+        return;
+    }
+    const uint32_t last = --set->count;
+    if (index != last) {
+        for (int c = 0; c < set->column_count; c++) {
+            memcpy(set->columns[c] + (size_t)index * set->sizes[c], set->columns[c] + (size_t)last * set->sizes[c], set->sizes[c]);
+        }
+        set->entities[index] = set->entities[last];
+        set->sparse[entity_slot(set->entities[index])] = index + 1;
+    }
+    set->sparse[entity_slot(entity)] = 0;
+    ecs.revision++;
+}
+
+static void component_set_free(component_set_t* set) {
+    for (int c = 0; c < set->column_count; c++) {
+        free(set->columns[c]);
+        set->columns[c] = NULL;
+    }
+    free(set->entities);
+    free(set->sparse);
+    set->entities = NULL;
+    set->sparse = NULL;
+    set->count = set->capacity = 0;
+}
+
+// Transform system
+// Model matrices are translate * rotate x * rotate y * rotate z, as HMM_Translate and HMM_Rotate would build them,
+// with the rotations multiplied out by hand. The vector paths do TRANSFORM_LANES transforms at a time, including
+// their sines and cosines, and everything else is done one at a time by the scalar path
+
+static inline float* transform_column(int column) {
+    return (float*)ecs.transforms.columns[column];
+}
+
+static inline hmm_mat4* transform_worlds(void) {
+    return (hmm_mat4*)ecs.transforms.columns[TRANSFORM_WORLD];
+}
+
+static inline hmm_mat4* transform_mvps(void) {
+    return (hmm_mat4*)ecs.transforms.columns[TRANSFORM_MVP];
+}
+
+static inline uint32_t* transform_indices(int column) {
+    return (uint32_t*)ecs.transforms.columns[column];
+}
+
+static inline entity_t* transform_parents(void) {
+    return (entity_t*)ecs.transforms.columns[TRANSFORM_PARENT];
+}
+
+// Position relative to the parent
+static inline hmm_vec3 transform_position_at(uint32_t index) {
+    return HMM_Vec3(transform_column(TRANSFORM_POSITION_X)[index], transform_column(TRANSFORM_POSITION_Y)[index], transform_column(TRANSFORM_POSITION_Z)[index]);
+}
+
+// Position in the world, as of the last update_transforms
+static inline hmm_vec3 transform_world_position_at(uint32_t index) {
+    const hmm_mat4* world = &transform_worlds()[index];
+    return HMM_Vec3(world->Elements[3][0], world->Elements[3][1], world->Elements[3][2]);
+}
+
+// Rotation part of a model matrix from the sines and cosines of its Euler angles, column major like hmm_mat4
+#define TRANSFORM_ROTATION(sx, cx, sy, cy, sz, cz, m) do { \
+        m[0] = cy * cz;  m[1] = cx * sz + sx * sy * cz;  m[2] = sx * sz - cx * sy * cz; \
+        m[3] = -cy * sz; m[4] = cx * cz - sx * sy * sz;  m[5] = sx * cz + cx * sy * sz; \
+        m[6] = sy;       m[7] = -sx * cy;                m[8] = cx * cy; \
+    } while (0)
+
+static inline hmm_mat4 transform_matrix(const float rotation[9], float x, float y, float z) {
+    return (hmm_mat4){ .Elements = {
+        { rotation[0], rotation[1], rotation[2], 0.0f },
+        { rotation[3], rotation[4], rotation[5], 0.0f },
+        { rotation[6], rotation[7], rotation[8], 0.0f },
+        { x, y, z, 1.0f }
+    } };
+}
+
+// Build the model matrices of transforms first to first + count, one at a time
+static void compose_transforms_scalar(const float* const position[3], const float* const rotation[3], hmm_mat4* world, uint32_t first, uint32_t count) {
+    for (uint32_t i = first; i < first + count; i++) {
+        const float rx = HMM_ToRadians(rotation[0][i]), ry = HMM_ToRadians(rotation[1][i]), rz = HMM_ToRadians(rotation[2][i]);
+        const float sx = HMM_SinF(rx), cx = HMM_CosF(rx);
+        const float sy = HMM_SinF(ry), cy = HMM_CosF(ry);
+        const float sz = HMM_SinF(rz), cz = HMM_CosF(rz);
+        float m[9];
+        TRANSFORM_ROTATION(sx, cx, sy, cy, sz, cz, m);
+        world[i] = transform_matrix(m, position[0][i], position[1][i], position[2][i]);
+    }
+}
+
+#if defined(__ARM_NEON) || defined(__AVX2__) || defined(__SSE2__)
+#if defined(__ARM_NEON)
+#define TRANSFORM_LANES 4
+typedef float32x4_t lanes_t;
+static inline lanes_t lanes_load(const float* p) { return vld1q_f32(p); }
+static inline void lanes_store(float* p, lanes_t a) { vst1q_f32(p, a); }
+static inline lanes_t lanes_set(float a) { return vdupq_n_f32(a); }
+static inline lanes_t lanes_add(lanes_t a, lanes_t b) { return vaddq_f32(a, b); }
+static inline lanes_t lanes_sub(lanes_t a, lanes_t b) { return vsubq_f32(a, b); }
+static inline lanes_t lanes_mul(lanes_t a, lanes_t b) { return vmulq_f32(a, b); }
+static inline lanes_t lanes_round(lanes_t a) { return vrndnq_f32(a); }
+// b where a equals what, c elsewhere
+static inline lanes_t lanes_select_equal(lanes_t a, lanes_t what, lanes_t b, lanes_t c) { return vbslq_f32(vceqq_f32(a, what), b, c); }
+#elif defined(__AVX2__)
+#define TRANSFORM_LANES 8
+typedef __m256 lanes_t;
+static inline lanes_t lanes_load(const float* p) { return _mm256_loadu_ps(p); }
+static inline void lanes_store(float* p, lanes_t a) { _mm256_storeu_ps(p, a); }
+static inline lanes_t lanes_set(float a) { return _mm256_set1_ps(a); }
+static inline lanes_t lanes_add(lanes_t a, lanes_t b) { return _mm256_add_ps(a, b); }
+static inline lanes_t lanes_sub(lanes_t a, lanes_t b) { return _mm256_sub_ps(a, b); }
+static inline lanes_t lanes_mul(lanes_t a, lanes_t b) { return _mm256_mul_ps(a, b); }
+static inline lanes_t lanes_round(lanes_t a) { return _mm256_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+static inline lanes_t lanes_select_equal(lanes_t a, lanes_t what, lanes_t b, lanes_t c) { return _mm256_blendv_ps(c, b, _mm256_cmp_ps(a, what, _CMP_EQ_OQ)); }
+#else
+#define TRANSFORM_LANES 4
+typedef __m128 lanes_t;
+static inline lanes_t lanes_load(const float* p) { return _mm_loadu_ps(p); }
+static inline void lanes_store(float* p, lanes_t a) { _mm_storeu_ps(p, a); }
+static inline lanes_t lanes_set(float a) { return _mm_set1_ps(a); }
+static inline lanes_t lanes_add(lanes_t a, lanes_t b) { return _mm_add_ps(a, b); }
+static inline lanes_t lanes_sub(lanes_t a, lanes_t b) { return _mm_sub_ps(a, b); }
+static inline lanes_t lanes_mul(lanes_t a, lanes_t b) { return _mm_mul_ps(a, b); }
+// Angles are far below 2^31, where the conversion would overflow
+static inline lanes_t lanes_round(lanes_t a) { return _mm_cvtepi32_ps(_mm_cvtps_epi32(a)); }
+static inline lanes_t lanes_select_equal(lanes_t a, lanes_t what, lanes_t b, lanes_t c) {
+    const __m128 mask = _mm_cmpeq_ps(a, what);
+    return _mm_or_ps(_mm_and_ps(mask, b), _mm_andnot_ps(mask, c));
+}
+#endif
+
+// Sine and cosine of angles in degrees. Whole quarter turns come off exactly in degrees, which leaves at most 45
+// degrees for the polynomials (Cephes' sinf and cosf), good to about one float ulp
+static inline void lanes_sincos_degrees(lanes_t degrees, lanes_t* sine, lanes_t* cosine) {
+    const lanes_t quarter = lanes_round(lanes_mul(degrees, lanes_set(1.0f / 90.0f)));
+    const lanes_t x = lanes_mul(lanes_sub(degrees, lanes_mul(quarter, lanes_set(90.0f))), lanes_set(HMM_PI32 / 180.0f));
+    const lanes_t z = lanes_mul(x, x);
+    lanes_t s = lanes_add(lanes_set(8.3321608736e-3f), lanes_mul(z, lanes_set(-1.9515295891e-4f)));
+    s = lanes_add(lanes_set(-1.6666654611e-1f), lanes_mul(z, s));
+    s = lanes_add(x, lanes_mul(lanes_mul(x, z), s));
+    lanes_t c = lanes_add(lanes_set(-1.388731625493765e-3f), lanes_mul(z, lanes_set(2.443315711809948e-5f)));
+    c = lanes_add(lanes_set(4.166664568298827e-2f), lanes_mul(z, c));
+    c = lanes_add(lanes_sub(lanes_set(1.0f), lanes_mul(z, lanes_set(0.5f))), lanes_mul(lanes_mul(z, z), c));
+
+    // Quarter turns mod 4, the fractions never land on a rounding tie
+    const lanes_t turn = lanes_sub(quarter, lanes_mul(lanes_set(4.0f), lanes_round(lanes_sub(lanes_mul(quarter, lanes_set(0.25f)), lanes_set(0.375f)))));
+    const lanes_t zero = lanes_set(0.0f), neg_s = lanes_sub(zero, s), neg_c = lanes_sub(zero, c);
+    *sine = lanes_select_equal(turn, zero, s, lanes_select_equal(turn, lanes_set(1.0f), c, lanes_select_equal(turn, lanes_set(2.0f), neg_s, neg_c)));
+    *cosine = lanes_select_equal(turn, zero, c, lanes_select_equal(turn, lanes_set(1.0f), neg_s, lanes_select_equal(turn, lanes_set(2.0f), neg_c, s)));
+}
+#endif
+
+// Build the model matrices of count transforms from columns of positions and Euler angles in degrees
+void compose_transforms(const float* const position[3], const float* const rotation[3], hmm_mat4* world, uint32_t count) {
+    uint32_t i = 0;
+#if defined(TRANSFORM_LANES)
+    for (; i + TRANSFORM_LANES <= count; i += TRANSFORM_LANES) {
+        lanes_t sx, cx, sy, cy, sz, cz;
+        lanes_sincos_degrees(lanes_load(&rotation[0][i]), &sx, &cx);
+        lanes_sincos_degrees(lanes_load(&rotation[1][i]), &sy, &cy);
+        lanes_sincos_degrees(lanes_load(&rotation[2][i]), &sz, &cz);
+        const lanes_t sxsy = lanes_mul(sx, sy), cxsy = lanes_mul(cx, sy);
+        const lanes_t zero = lanes_set(0.0f);
+        lanes_t m[9];
+        m[0] = lanes_mul(cy, cz);
+        m[1] = lanes_add(lanes_mul(cx, sz), lanes_mul(sxsy, cz));
+        m[2] = lanes_sub(lanes_mul(sx, sz), lanes_mul(cxsy, cz));
+        m[3] = lanes_sub(zero, lanes_mul(cy, sz));
+        m[4] = lanes_sub(lanes_mul(cx, cz), lanes_mul(sxsy, sz));
+        m[5] = lanes_add(lanes_mul(sx, cz), lanes_mul(cxsy, sz));
+        m[6] = sy;
+        m[7] = lanes_sub(zero, lanes_mul(sx, cy));
+        m[8] = lanes_mul(cx, cy);
+
+        // Back to one matrix per transform
+        float rows[9][TRANSFORM_LANES];
+        for (int e = 0; e < 9; e++) {
+            lanes_store(rows[e], m[e]);
+        }
+        for (int lane = 0; lane < TRANSFORM_LANES; lane++) {
+            const float r[9] = {
+                rows[0][lane], rows[1][lane], rows[2][lane], rows[3][lane], rows[4][lane],
+                rows[5][lane], rows[6][lane], rows[7][lane], rows[8][lane]
+            };
+            world[i + lane] = transform_matrix(r, position[0][i + lane], position[1][i + lane], position[2][i + lane]);
+        }
+    }
+#endif
+    compose_transforms_scalar(position, rotation, world, i, count - i);
+}
+
+// Have the transform at index rebuilt by the next update_transforms
+static void transform_mark_dirty(uint32_t index) {
+    uint8_t* dirty = ecs.transforms.columns[TRANSFORM_DIRTY];
+    if (dirty[index]) {
+        return;
+    }
+    dirty[index] = 1;
+    if (ecs.dirty_count == ecs.dirty_capacity) {
+        uint32_t capacity = HMM_MAX(ecs.dirty_capacity * 2, ECS_MIN_CAPACITY);
+        void* grown = realloc(ecs.dirty_transforms, capacity * sizeof(entity_t));
+        if (grown) ecs.dirty_transforms = (entity_t*)grown;
+        void* indices = realloc(ecs.dirty_indices, capacity * sizeof(uint32_t));
+        if (indices) ecs.dirty_indices = (uint32_t*)indices;
+        if (!grown || !indices) {
+            ecs.dirty_overflow = true;
+            return;
+        }
+        ecs.dirty_capacity = capacity;
+    }
+    ecs.dirty_transforms[ecs.dirty_count++] = ecs.transforms.entities[index];
+}
+
+static int compare_indices(const void* a, const void* b) {
+    uint32_t ia = *(const uint32_t*)a, ib = *(const uint32_t*)b;
+    return (ia > ib) - (ia < ib);
+}
+
+// Put the transforms back in depth first order after removals or reparenting, keeping siblings in the order they
+// were in. Transforms whose parent is gone become roots
+static bool sort_transforms(void) {
+    component_set_t* set = &ecs.transforms;
+    const uint32_t count = set->count;
+    entity_t* parents = transform_parents();
+    size_t largest = sizeof(entity_t);
+    for (int c = 0; c < set->column_count; c++) {
+        largest = HMM_MAX(largest, set->sizes[c]);
+    }
+
+    // Children of each transform as runs in one array, those of first_child[i] to first_child[i + 1], with the roots
+    // under count. Built by counting sort on the parent
+    uint32_t* first_child = (uint32_t*)calloc((size_t)count + 3, sizeof(uint32_t));
+    uint32_t* children = (uint32_t*)malloc(((size_t)count + 1) * sizeof(uint32_t));
+    uint32_t* order = (uint32_t*)malloc(((size_t)count + 1) * sizeof(uint32_t));
+    uint32_t* stack = (uint32_t*)malloc(((size_t)count + 1) * sizeof(uint32_t));
+    uint8_t* scratch = (uint8_t*)malloc(((size_t)count + 1) * largest);
+    if (!first_child || !children || !order || !stack || !scratch) {
+        printf("Failed to allocate memory for sorting %u transforms!\n", count);
+        free(first_child);
+        free(children);
+        free(order);
+        free(stack);
+        free(scratch);
+        return false;
+    }
+    uint32_t* parent_index = transform_indices(TRANSFORM_PARENT_INDEX);
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t parent = component_find(set, parents[i]);
+        if (parent == UINT32_MAX) {
+            if (parents[i].id != 0) {
+                parents[i] = (entity_t){ 0 };
+                transform_mark_dirty(i);
+            }
+            parent = count;
+        }
+        parent_index[i] = parent;
+        first_child[parent + 2]++;
+    }
+    for (uint32_t i = 2; i < count + 3; i++) {
+        first_child[i] += first_child[i - 1];
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        children[first_child[parent_index[i] + 1]++] = i;
+    }
+
+    // Walk the hierarchy depth first. order maps each new index to the old one, and stack ends up mapping back
+    uint32_t placed = 0, top = 0;
+    for (uint32_t k = first_child[count + 1]; k-- > first_child[count];) {
+        stack[top++] = children[k];
+    }
+    while (top > 0) {
+        const uint32_t i = stack[--top];
+        order[placed++] = i;
+        for (uint32_t k = first_child[i + 1]; k-- > first_child[i];) {
+            stack[top++] = children[k];
+        }
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        stack[order[i]] = i;
+    }
+
+    // Move every column, and the owners, into the new order
+    for (int c = 0; c < set->column_count; c++) {
+        const size_t size = set->sizes[c];
+        for (uint32_t i = 0; i < count; i++) {
+            memcpy(scratch + i * size, set->columns[c] + (size_t)order[i] * size, size);
+        }
+        memcpy(set->columns[c], scratch, count * size);
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        ((entity_t*)scratch)[i] = set->entities[order[i]];
+    }
+    memcpy(set->entities, scratch, count * sizeof(entity_t));
+
+    // Descendants follow their parent, so walking back to front every subtree is complete before it's added to its parent's
+    uint32_t* subtree_end = transform_indices(TRANSFORM_SUBTREE_END);
+    for (uint32_t i = 0; i < count; i++) {
+        set->sparse[entity_slot(set->entities[i])] = i + 1;
+        parent_index[i] = parent_index[i] == count ? UINT32_MAX : stack[parent_index[i]];
+        subtree_end[i] = i + 1;
+    }
+    for (uint32_t i = count; i-- > 0;) {
+        if (parent_index[i] != UINT32_MAX) {
+            subtree_end[parent_index[i]] = HMM_MAX(subtree_end[parent_index[i]], subtree_end[i]);
+        }
+    }
+    free(first_child);
+    free(children);
+    free(order);
+    free(stack);
+    free(scratch);
+    return true;
+}
+
+// World matrices of the transforms from first to end, whose parents are either in the range ahead of them or already done
+static void propagate_transforms(uint32_t first, uint32_t end) {
+    const hmm_mat4* local = (const hmm_mat4*)ecs.transforms.columns[TRANSFORM_LOCAL];
+    const uint32_t* parent_index = transform_indices(TRANSFORM_PARENT_INDEX);
+    hmm_mat4* world = transform_worlds();
+    for (uint32_t i = first; i < end; i++) {
+        world[i] = parent_index[i] == UINT32_MAX ? local[i] : HMM_MultiplyMat4(world[parent_index[i]], local[i]);
+    }
+}
+
+// Rebuild the matrices of the transforms marked dirty along with everything under them, and the MVPs of those, or of
+// all of them when view_proj isn't what they were built with. Each dirty subtree is one run of the set, so moving a
+// root with thousands of children is one linear pass. Once a quarter of the transforms are dirty it's cheaper to run
+// the vector path over all of them than to pick them out one by one. Static transforms cost nothing while the camera
+// holds still
+void update_transforms(hmm_mat4 view_proj) {
+    if (ecs.transforms_unsorted) {
+        if (!sort_transforms()) {
+            return;
+        }
+        ecs.transforms_unsorted = false;
+    }
+    const uint32_t count = ecs.transforms.count;
+    const float* const position[3] = { transform_column(TRANSFORM_POSITION_X), transform_column(TRANSFORM_POSITION_Y), transform_column(TRANSFORM_POSITION_Z) };
+    const float* const rotation[3] = { transform_column(TRANSFORM_ROTATION_X), transform_column(TRANSFORM_ROTATION_Y), transform_column(TRANSFORM_ROTATION_Z) };
+    hmm_mat4* local = (hmm_mat4*)ecs.transforms.columns[TRANSFORM_LOCAL];
+    hmm_mat4* world = transform_worlds();
+    hmm_mat4* mvp = transform_mvps();
+    uint8_t* dirty = ecs.transforms.columns[TRANSFORM_DIRTY];
+    const uint32_t* subtree_end = transform_indices(TRANSFORM_SUBTREE_END);
+    bool all_mvps = memcmp(&view_proj, &ecs.view_proj, sizeof(view_proj)) != 0;
+    if (ecs.dirty_count > 0 || ecs.dirty_overflow) {
+        ecs.revision++;
+    }
+    // Nothing dirty stays off the vector path however few transforms there are
+    if (count > 0 && (ecs.dirty_overflow || (ecs.dirty_count > 0 && ecs.dirty_count >= count / 4))) {
+        compose_transforms(position, rotation, local, count);
+        propagate_transforms(0, count);
+        memset(dirty, 0, count);
+        all_mvps = true;
+    } else {
+        uint32_t dirty_count = 0;
+        for (uint32_t d = 0; d < ecs.dirty_count; d++) {
+            const uint32_t i = component_find(&ecs.transforms, ecs.dirty_transforms[d]);
+            if (i == UINT32_MAX || !dirty[i]) {
+                continue; // Gone, or listed twice
+            }
+            compose_transforms_scalar(position, rotation, local, i, 1);
+            ecs.dirty_indices[dirty_count++] = i;
+            dirty[i] = 0;
+        }
+
+        // In index order, a dirty transform under one already done was covered by its subtree
+        qsort(ecs.dirty_indices, dirty_count, sizeof(uint32_t), compare_indices);
+        uint32_t done = 0;
+        for (uint32_t d = 0; d < dirty_count; d++) {
+            const uint32_t first = ecs.dirty_indices[d];
+            if (first < done) {
+                continue;
+            }
+            done = subtree_end[first];
+            propagate_transforms(first, done);
+            for (uint32_t i = first; !all_mvps && i < done; i++) {
+                mvp[i] = HMM_MultiplyMat4(view_proj, world[i]);
+            }
+        }
+    }
+    ecs.dirty_count = 0;
+    ecs.dirty_overflow = false;
+    if (all_mvps) {
+        for (uint32_t i = 0; i < count; i++) {
+            mvp[i] = HMM_MultiplyMat4(view_proj, world[i]);
+        }
+        ecs.view_proj = view_proj;
+    }
+}
+
+// Component-specific functions
+// Copy out an entity's transform, along with the model matrix the last update_transforms built from it. False if it has none
+bool get_transform(entity_t entity, transform_c_t* transform) {
+    const uint32_t i = component_find(&ecs.transforms, entity);
+    if (i == UINT32_MAX) {
+        return false;
+    }
+    transform->position = transform_position_at(i);
+    transform->rotation = HMM_Vec3(transform_column(TRANSFORM_ROTATION_X)[i], transform_column(TRANSFORM_ROTATION_Y)[i], transform_column(TRANSFORM_ROTATION_Z)[i]);
+    transform->_transform = transform_worlds()[i];
+    transform->parent = transform_parents()[i];
+    return true;
+}
+
+mesh_c_t* get_mesh(entity_t entity) {
+    return (mesh_c_t*)component_get(&ecs.meshes, entity);
+}
+
+volume_c_t* get_volume(entity_t entity) {
+    return (volume_c_t*)component_get(&ecs.volumes, entity);
+}
+
+// Set three columns of an entity's transform, starting at first, and mark it dirty if they changed
+static void transform_set_columns(entity_t entity, int first, hmm_vec3 value) {
+    const uint32_t i = component_find(&ecs.transforms, entity);
+    if (i == UINT32_MAX) {
+        return;
+    }
+    float* x = &transform_column(first)[i];
+    float* y = &transform_column(first + 1)[i];
+    float* z = &transform_column(first + 2)[i];
+    if (*x != value.X || *y != value.Y || *z != value.Z) {
+        *x = value.X;
+        *y = value.Y;
+        *z = value.Z;
+        transform_mark_dirty(i);
+    }
+}
+
+void set_transform_position(entity_t entity, hmm_vec3 position) {
+    transform_set_columns(entity, TRANSFORM_POSITION_X, position);
+}
+
+// Euler angles in degrees
+void set_transform_rotation(entity_t entity, hmm_vec3 rotation) {
+    transform_set_columns(entity, TRANSFORM_ROTATION_X, rotation);
+}
+
+// Attach an entity's transform under another's, so its position and rotation are relative to that one, or make it
+// a root with a parent id of 0. False if either has no transform, or the parent is the entity or under it
+bool set_transform_parent(entity_t entity, entity_t parent) {
+    const uint32_t i = component_find(&ecs.transforms, entity);
+    if (i == UINT32_MAX) {
+        return false;
+    }
+    entity_t* parents = transform_parents();
+    if (parents[i].id == parent.id) {
+        return true;
+    }
+    if (parent.id != 0) {
+        uint32_t ancestor = component_find(&ecs.transforms, parent);
+        if (ancestor == UINT32_MAX) {
+            printf("Parent entity %u has no transform!\n", parent.id);
+            return false;
+        }
+        for (; ancestor != UINT32_MAX; ancestor = component_find(&ecs.transforms, parents[ancestor])) {
+            if (ancestor == i) {
+                printf("Entity %u can't be parented under itself!\n", entity.id);
+                return false;
+            }
+        }
+    }
+    parents[i] = parent;
+    ecs.transforms_unsorted = true;
+    transform_mark_dirty(i);
+    return true;
+}
+
+// Give an entity a transform, or replace the position, rotation and parent of the one it has
+void update_transform(entity_t entity, const transform_c_t *data) {
+    if (component_get(&ecs.transforms, entity) == NULL) {
+        if (!component_add(&ecs.transforms, entity)) {
+            return;
+        }
+        // A new root at the end keeps the set in order
+        const uint32_t i = component_find(&ecs.transforms, entity);
+        transform_indices(TRANSFORM_PARENT_INDEX)[i] = UINT32_MAX;
+        transform_indices(TRANSFORM_SUBTREE_END)[i] = i + 1;
+        transform_mark_dirty(i);
+    }
+    set_transform_position(entity, data->position);
+    set_transform_rotation(entity, data->rotation);
+    set_transform_parent(entity, data->parent);
+}
+
+// Remove an entity's transform. Anything parented under it becomes a root
+void remove_transform(entity_t entity) {
+    if (component_find(&ecs.transforms, entity) != UINT32_MAX) {
+        component_remove(&ecs.transforms, entity);
+        ecs.transforms_unsorted = true;
+    }
+}
+
+// Number of voxels in a volume
+size_t volume_voxel_count(const volume_c_t* volume) {
+    return (size_t)volume->width * (size_t)volume->height * (size_t)volume->depth;
+}
+
+// World space size of the volume's bounding box, derived from the voxel counts and spacing
+hmm_vec3 volume_extent(const volume_c_t* volume) {
+    return HMM_Vec3(volume->width * volume->spacing.X,
+                    volume->height * volume->spacing.Y,
+                    volume->depth * volume->spacing.Z);
+}
+
+// Scale from world distance to voxels per pixel, given the angle a pixel covers. The smallest spacing decides,
+// so anisotropic volumes don't drop detail along their finest axis
+float volume_lod_scale(const volume_c_t* volume, float pixel_angle) {
+    float voxel = HMM_MIN(volume->spacing.X, HMM_MIN(volume->spacing.Y, volume->spacing.Z));
+    return pixel_angle / voxel;
+}
+
+// Release everything a volume sized after its dimensions: textures, mips and macro cells. Leaves _volume alone
+static void volume_free_resources(volume_c_t* volume) {
+    sg_destroy_image(volume->img);
+    sg_destroy_image(volume->occupancy_img);
+    volume->img = volume->occupancy_img = (sg_image){ SG_INVALID_ID };
+    if (volume->mip_levels > 1) {
+        free(volume->_mips[1]);
+    }
+    free(volume->_blocks[0]);
+    memset(volume->_mips, 0, sizeof(volume->_mips));
+    memset(volume->_blocks, 0, sizeof(volume->_blocks));
+    volume->mip_levels = 0;
+    macro_grid_free(&volume->cells);
+}
+
+// Release the voxels of a volume, whether they were allocated or mapped from a file
+static void volume_free_voxels(volume_c_t* volume) {
+    if (volume->_mapped) {
+        munmap(volume->_mapped, volume->_mapped_size);
+    } else {
+        free(volume->_volume);
+    }
+    volume->_volume = NULL;
+    volume->_mapped = NULL;
+    volume->_mapped_size = 0;
+}
+
+// Type voxels of the given type are kept as. Everything is kept as is, except floats on GPUs that can't filter R32F,
+// which get halved to R16F
+static volume_type_t volume_storage_type(volume_type_t type) {
+    if (type == VOLUME_FLOAT && !sg_query_pixelformat(SG_PIXELFORMAT_R32F).filter) {
+        return VOLUME_HALF;
+    }
+    return type;
+}
+
+// Copy count voxels of src_type to dst as dst_type, swapping the bytes of each source voxel first if swap is set.
+// src and dst may be the same if the types are the same size
+static void volume_convert(uint8_t* dst, volume_type_t dst_type, const uint8_t* src, volume_type_t src_type, size_t count, bool swap) {
+    const size_t size = volume_type_size(src_type);
+    if (dst_type == src_type && (!swap || size == 1)) {
+        memmove(dst, src, count * size);
+        return;
+    }
+    for (size_t i = 0; i < count; i++) {
+        uint8_t voxel[4];
+        for (size_t b = 0; b < size; b++) {
+            voxel[b] = src[i * size + (swap ? size - 1 - b : b)];
+        }
+        if (dst_type == src_type) {
+            memcpy(&dst[i * size], voxel, size);
+        } else {
+            volume_store(dst, i, dst_type, volume_load(voxel, 0, src_type));
+        }
+    }
+}
+
+void update_volume_region(entity_t entity, const uint8_t* data, int x0, int y0, int z0, int w, int h, int d);
+static void free_bricked_volume(bricked_volume_t* bricks);
+static void close_volume_stream(struct volume_stream_t* stream);
+
+// Create the texture a volume is drawn from, once its size, type and mips are set. Compressed volumes get room for
+// their blocks instead, the texture is made from those by the first upload. So are uncompressed ones on Metal, where
+// later changes are blitted in: a dynamic image there is one texture per frame in flight, each the size of the volume
+static void volume_create_image(volume_c_t* volume) {
+    if (volume->compressed) {
+        if (volume->type == VOLUME_UINT8 && sg_query_pixelformat(SG_PIXELFORMAT_BC4_R).sample &&
+            bc4_alloc_mips(volume->width, volume->height, volume->depth, volume->mip_levels, volume->_blocks)) {
+            return;
+        }
+        printf("Can't compress a %dx%dx%d volume (BC4 needs uint8 voxels and GPU support), keeping it uncompressed\n", volume->width, volume->height, volume->depth);
+        volume->compressed = false;
+    }
+#if !defined(SOKOL_METAL)
+    volume->img = sg_make_image(&(sg_image_desc){
+        .type = SG_IMAGETYPE_3D,
+        .width = volume->width,
+        .height = volume->height,
+        .num_slices = volume->depth,
+        .num_mipmaps = volume->mip_levels,
+        .pixel_format = volume_pixel_format(volume->type),
+        .usage = SG_USAGE_DYNAMIC,
+        .label = "volume-texture"
+    });
+#endif
+}
+
+// Make voxels (of type) the storage of a volume, replacing whatever it had, and create everything sized after it.
+// The volume takes ownership of voxels (or of mapped, if voxels point into it), and the entity gets the volume if it had none
+static bool volume_set_storage(entity_t entity, uint8_t* voxels, volume_type_t type, void* mapped, size_t mapped_size, int width, int height, int depth) {
+    volume_c_t* volume = (volume_c_t*)component_add(&ecs.volumes, entity);
+    if (!volume) {
+        if (mapped) {
+            munmap(mapped, mapped_size);
+        } else {
+            free(voxels);
+        }
+        return false;
+    }
+    if (volume->bricks) {
+        free_bricked_volume(volume->bricks);
+        volume->bricks = NULL;
+    }
+    if (volume->stream) {
+        close_volume_stream(volume->stream);
+        volume->stream = NULL;
+    }
+    volume_free_voxels(volume);
+    volume_free_resources(volume);
+    volume->_volume = voxels;
+    volume->type = type;
+    volume->_mapped = mapped;
+    volume->_mapped_size = mapped_size;
+    volume->width = width;
+    volume->height = height;
+    volume->depth = depth;
+    volume->window = 0.0f; // Picked from the data once it's in
+    volume->window_set = false;
+
+    // Distant volumes get sampled from the smaller levels
+    volume->mip_levels = volume_alloc_mips(volume->_volume, type, width, height, depth, volume->_mips);
+    if (volume->mip_levels == 0) {
+        printf("Failed to allocate mip levels for a %dx%dx%d volume, using just the full resolution\n", width, height, depth);
+        volume->mip_levels = 1;
+    }
+    volume_create_image(volume);
+
+    // Rays skip cells that can't contribute anything, cells stay occupied if there's no memory for the grid
+    if (macro_grid_init(&volume->cells, width, height, depth)) {
+        volume->occupancy_img = sg_make_image(&(sg_image_desc){
+            .type = SG_IMAGETYPE_3D,
+            .width = volume->cells.cells_x,
+            .height = volume->cells.cells_y,
+            .num_slices = volume->cells.cells_z,
+            .pixel_format = SG_PIXELFORMAT_R8,
+            .usage = SG_USAGE_DYNAMIC,
+            .label = "volume-occupancy"
+        });
+    }
+
+    // Unless told otherwise, scale voxels so the longest axis of the volume is one world unit
+    if (volume->spacing.X <= 0.0f || volume->spacing.Y <= 0.0f || volume->spacing.Z <= 0.0f) {
+        int longest = width > height ? width : height;
+        longest = longest > depth ? longest : depth;
+        volume->spacing = HMM_Vec3(1.0f / longest, 1.0f / longest, 1.0f / longest);
+    }
+    return true;
+}
+
+// Update or create the volume of an entity, width x height x depth voxels of type. Will add the component and malloc as needed.
+// Textures are only recreated when the size or type changes, otherwise the new contents are uploaded into them before the next draw
+void update_volume(entity_t entity, uint8_t* volume_data, volume_type_t type, int width, int height, int depth) {
+    volume_c_t* volume = get_volume(entity);
+    assert(width > 0 && height > 0 && depth > 0);
+    const volume_type_t stored = volume_storage_type(type);
+    const size_t count = (size_t)width * height * depth;
+
+    // Reallocate if the volume changed size, along with everything sized after it
+    if (volume == NULL || volume->_volume == NULL || volume->bricks || volume->type != stored || volume->width != width || volume->height != height || volume->depth != depth) {
+        uint8_t* voxels = (uint8_t*)calloc(count, volume_type_size(stored));
+        if (!voxels) {
+            printf("Failed to allocate memory for a %dx%dx%d volume!\n", width, height, depth);
+            return;
+        }
+        if (!volume_set_storage(entity, voxels, stored, NULL, 0, width, height, depth)) {
+            return;
+        }
+    }
+
+    if (stored != type) {
+        uint8_t* converted = (uint8_t*)malloc(count * volume_type_size(stored));
+        if (!converted) {
+            printf("Failed to allocate memory for a %dx%dx%d volume!\n", width, height, depth);
+            return;
+        }
+        volume_convert(converted, stored, volume_data, type, count, false);
+        update_volume_region(entity, converted, 0, 0, 0, width, height, depth);
+        free(converted);
+        return;
+    }
+    update_volume_region(entity, volume_data, 0, 0, 0, width, height, depth);
+}
+
+// Mark the volume's macro cells empty or not under its current window, to be uploaded with the next draw
+static void volume_classify(volume_c_t* volume) {
+    // Until the transfer function is baked there's nothing to classify by, it reclassifies every volume once it is
+    if (volume->cells.minmax && !transfer.changed) {
+        macro_grid_classify(&volume->cells, transfer.opacity, volume->level - volume->window * 0.5f, volume->level + volume->window * 0.5f);
+        volume->occupancy_pending = true;
+    }
+}
+
+// Span the window across the values in the volume, or the whole range of its type if they're all the same
+static void volume_default_window(volume_c_t* volume) {
+    float lo = INFINITY, hi = -INFINITY;
+    size_t count = (size_t)volume->cells.cells_x * volume->cells.cells_y * volume->cells.cells_z;
+    for (size_t i = 0; volume->cells.minmax && i < count; i++) {
+        lo = HMM_MIN(lo, volume->cells.minmax[i * 2 + 0]);
+        hi = HMM_MAX(hi, volume->cells.minmax[i * 2 + 1]);
+    }
+    if (!(hi > lo)) {
+        lo = 0.0f;
+        hi = volume_type_unit(volume->type);
+    }
+    volume->window = hi - lo;
+    volume->level = (lo + hi) * 0.5f;
+}
+
+// Set the range of stored values the colormap spans, as its width and center, e.g. a CT window in Hounsfield units
+void set_volume_window(entity_t entity, float window, float level) {
+    volume_c_t* volume = get_volume(entity);
+    if (!volume) {
+        return;
+    }
+    volume->window = HMM_MAX(window, 1e-6f);
+    volume->level = level;
+    volume->window_set = true;
+    volume_classify(volume);
+}
+
+// Write a box of voxels into a volume and redo the mip levels and macro cells under it, leaving the cells' classification
+// and the volume's revision to the caller, so a batch of boxes only gets them redone once
+static void volume_write_region(volume_c_t* volume, const uint8_t* data, int x0, int y0, int z0, int w, int h, int d) {
+    const int x1 = x0 + w, y1 = y0 + h, z1 = z0 + d;
+
+    // Rebuilding from the volume's own data just redoes everything derived from it
+    const size_t size = volume_type_size(volume->type);
+    if (data != volume->_volume) {
+        for (int z = 0; z < d; z++) {
+            for (int y = 0; y < h; y++) {
+                memcpy(&volume->_volume[(((size_t)(z0 + z) * volume->height + (y0 + y)) * volume->width + x0) * size], &data[((size_t)z * h + y) * w * size], w * size);
+            }
+        }
+    }
+    volume_update_mips(volume->_mips, volume->mip_levels, volume->type, volume->width, volume->height, volume->depth,
+                       x0, y0, z0, x1, y1, z1, volume->mip_reduce);
+    if (volume->cells.minmax) {
+        macro_grid_update(&volume->cells, volume->_volume, volume->type, volume->width, volume->height, volume->depth, x0, y0, z0, x1, y1, z1);
+    }
+
+    int box[6] = { x0, y0, z0, x1, y1, z1 };
+    if (volume->upload_pending) {
+        for (int axis = 0; axis < 3; axis++) {
+            box[axis] = HMM_MIN(box[axis], volume->dirty_box[axis]);
+            box[axis + 3] = HMM_MAX(box[axis + 3], volume->dirty_box[axis + 3]);
+        }
+    }
+    memcpy(volume->dirty_box, box, sizeof(box));
+    volume->upload_pending = true;
+}
+
+// Overwrite the w x h x d box of voxels at (x0, y0, z0) of an existing volume with data (x fastest, in the volume's type).
+// Only the mip levels, macro cells and texture regions under the box get redone, and the upload waits for the next draw,
+// so many small edits in a frame cost one upload
+void update_volume_region(entity_t entity, const uint8_t* data, int x0, int y0, int z0, int w, int h, int d) {
+    volume_c_t* volume = get_volume(entity);
+    if (volume == NULL || volume->_volume == NULL || w <= 0 || h <= 0 || d <= 0 || x0 < 0 || y0 < 0 || z0 < 0 ||
+        x0 + w > volume->width || y0 + h > volume->height || z0 + d > volume->depth) {
+        printf("Region (%d, %d, %d) %dx%dx%d is outside of the volume of entity %u\n", x0, y0, z0, w, h, d, entity.id);
+        return;
+    }
+    volume_write_region(volume, data, x0, y0, z0, w, h, d);
+    if (volume->window <= 0.0f) {
+        volume_default_window(volume);
+    }
+    volume_classify(volume);
+    volume->revision++;
+}
+
+// Keep a volume as BC4 blocks on the GPU, in half the memory of R8 at a small loss of precision, or go back to
+// uncompressed voxels. Only uint8 volumes can be compressed. The next draw uploads the volume again
+void set_volume_compression(entity_t entity, bool compressed) {
+    volume_c_t* volume = get_volume(entity);
+    if (volume == NULL || volume->_volume == NULL || volume->compressed == compressed) {
+        return;
+    }
+    sg_destroy_image(volume->img);
+    volume->img = (sg_image){ SG_INVALID_ID };
+    free(volume->_blocks[0]);
+    memset(volume->_blocks, 0, sizeof(volume->_blocks));
+    volume->compressed = compressed;
+    volume_create_image(volume);
+    const int box[6] = { 0, 0, 0, volume->width, volume->height, volume->depth };
+    memcpy(volume->dirty_box, box, sizeof(box));
+    volume->upload_pending = true;
+}
+
+// Re-encode the blocks under the changed box of every level of a compressed volume. Metal writes them into the texture,
+// other backends have to make the (immutable) texture again from all of them
+static void upload_compressed_volume(volume_c_t* volume) {
+    bool uploaded = volume->img.id != SG_INVALID_ID;
+    int box[6];
+    memcpy(box, volume->dirty_box, sizeof(box));
+    for (int i = 0, w = volume->width, h = volume->height, d = volume->depth; i < volume->mip_levels; i++) {
+        if (box[0] < box[3] && box[1] < box[4] && box[2] < box[5]) {
+            bc4_encode_region(volume->_mips[i], w, h, volume->_blocks[i], box[0], box[1], box[2], box[3], box[4], box[5], 0);
+            if (uploaded) {
+                // Whole blocks, except where they hang over the edge of the level
+                const int x0 = box[0] & ~3, y0 = box[1] & ~3;
+                const int x1 = HMM_MIN((box[3] + 3) & ~3, w), y1 = HMM_MIN((box[4] + 3) & ~3, h);
+                const int row = (w + 3) / 4 * BC4_BLOCK_BYTES;
+                const size_t slice = bc4_slice_size(w, h);
+                const uint8_t* corner = &volume->_blocks[i][box[2] * slice + (size_t)(y0 / 4) * row + (x0 / 4) * BC4_BLOCK_BYTES];
+                uploaded = update_image_region(volume->img, i, x0, y0, box[2], x1 - x0, y1 - y0, box[5] - box[2], corner, row, (int)slice);
+            }
+        }
+        volume_mip_box(box, &w, &h, &d);
+    }
+    if (!uploaded) {
+        sg_destroy_image(volume->img);
+        sg_image_data data = { 0 };
+        for (int i = 0, w = volume->width, h = volume->height; i < volume->mip_levels; i++) {
+            data.subimage[0][i] = (sg_range){ .ptr = volume->_blocks[i], .size = bc4_slice_size(w, h) * volume->depth };
+            w = volume_mip_dim(w);
+            h = volume_mip_dim(h);
+        }
+        volume->img = sg_make_image(&(sg_image_desc){
+            .type = SG_IMAGETYPE_3D,
+            .width = volume->width,
+            .height = volume->height,
+            .num_slices = volume->depth,
+            .num_mipmaps = volume->mip_levels,
+            .pixel_format = SG_PIXELFORMAT_BC4_R,
+            .data = data,
+            .label = "volume-texture-bc4"
+        });
+    }
+}
+
+// Send a volume's pending changes to its textures, once per frame before it's drawn. Metal gets just the changed box
+// of every mip level; other backends re-upload the whole chain since sokol_gfx can only update whole images
+void upload_volume(volume_c_t* volume) {
+    if (volume->occupancy_pending && volume->occupancy_img.id != SG_INVALID_ID) {
+        size_t cell_count = (size_t)volume->cells.cells_x * volume->cells.cells_y * volume->cells.cells_z;
+        sg_update_image(volume->occupancy_img, &(sg_image_data){ .subimage[0][0] = { .ptr = volume->cells.occupancy, .size = cell_count } });
+    }
+    volume->occupancy_pending = false;
+    if (!volume->upload_pending) {
+        return;
+    }
+    volume->upload_pending = false;
+    if (volume->compressed) {
+        upload_compressed_volume(volume);
+        return;
+    }
+
+    // Metal gets the changed box of each level written into the texture, once the first upload has made it
+    const int size = (int)volume_type_size(volume->type);
+    bool uploaded = volume->img.id != SG_INVALID_ID;
+    int box[6];
+    memcpy(box, volume->dirty_box, sizeof(box));
+    for (int i = 0, w = volume->width, h = volume->height, d = volume->depth; uploaded && i < volume->mip_levels; i++) {
+        if (box[0] < box[3] && box[1] < box[4] && box[2] < box[5]) {
+            const uint8_t* corner = &volume->_mips[i][(((size_t)box[2] * h + box[1]) * w + box[0]) * size];
+            uploaded = update_image_region(volume->img, i, box[0], box[1], box[2], box[3] - box[0], box[4] - box[1], box[5] - box[2], corner, w * size, w * h * size);
+        }
+        volume_mip_box(box, &w, &h, &d);
+    }
+    if (!uploaded) {
+        // Sizes are what sokol_gfx validates against, volume_alloc_mips made room for them. The Metal backend only
+        // reads each level's own slices
+        sg_image_data data = { 0 };
+        for (int i = 0, w = volume->width, h = volume->height; i < volume->mip_levels; i++) {
+            data.subimage[0][i] = (sg_range){ .ptr = volume->_mips[i], .size = (size_t)w * h * volume->depth * size };
+            w = volume_mip_dim(w);
+            h = volume_mip_dim(h);
+        }
+#if defined(SOKOL_METAL)
+        sg_destroy_image(volume->img);
+        volume->img = sg_make_image(&(sg_image_desc){
+            .type = SG_IMAGETYPE_3D,
+            .width = volume->width,
+            .height = volume->height,
+            .num_slices = volume->depth,
+            .num_mipmaps = volume->mip_levels,
+            .pixel_format = volume_pixel_format(volume->type),
+            .data = data,
+            .label = "volume-texture"
+        });
+#else
+        sg_update_image(volume->img, &data);
+#endif
+    }
+}
+
+// Set the world space size of a single voxel, e.g. the scanner's (x, y, z) resolution for anisotropic data
+void set_volume_spacing(entity_t entity, hmm_vec3 spacing) {
+    volume_c_t* volume = get_volume(entity);
+    if (volume) {
+        volume->spacing = spacing;
+    }
+}
+
+// Free a volume and take it off its entity
+void free_volume(entity_t entity) {
+    volume_c_t* volume = get_volume(entity);
+    if (!volume) {
+        return;
+    }
+    volume_free_voxels(volume);
+    volume_free_resources(volume);
+    if (volume->bricks) {
+        free_bricked_volume(volume->bricks);
+    }
+    if (volume->stream) {
+        close_volume_stream(volume->stream);
+    }
+    component_remove(&ecs.volumes, entity);
+}
+
+// Get the dimensions the generators below should use. Existing volumes keep their size,
+// new ones get a VOLUME_DIMENSIONS cube
+static void volume_generator_dims(entity_t entity, int* width, int* height, int* depth) {
+    volume_c_t* volume = get_volume(entity);
+    if (volume != NULL && volume->_volume != NULL) {
+        *width = volume->width;
+        *height = volume->height;
+        *depth = volume->depth;
+    } else {
+        *width = *height = *depth = VOLUME_DIMENSIONS;
+    }
+}
+
+// Set a volume to random values
+void randomize_volume(entity_t entity) {
+    int width, height, depth;
+    volume_generator_dims(entity, &width, &height, &depth);
+
+    // Prepare volume data
+    size_t count = (size_t)width * height * depth;
+    uint8_t* volume_data = (uint8_t*)malloc(count);
+    if (!volume_data) {
+        printf("Failed to allocate memory for volume data!\n");
+        return;
+    }
+    for (size_t i = 0; i < count; i++) {
+        volume_data[i] = rand() % 256;
+    }
+
+    update_volume(entity, volume_data, VOLUME_UINT8, width, height, depth);
+    free(volume_data);
+}
+
+void sphere_volume(entity_t entity) {
+    int width, height, depth;
+    volume_generator_dims(entity, &width, &height, &depth);
+
+    // Prepare volume data
+    uint8_t* volume_data = (uint8_t*)calloc((size_t)width * height * depth, sizeof(uint8_t));
+    if (!volume_data) {
+        printf("Failed to allocate memory for volume data!\n");
+        return;
+    }
+
+    // Sphere parameters, in normalized volume coordinates so it fills the bounding box on every axis
+    for (int z = 0; z < depth; z++) {
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                float dx = (x + 0.5f) / width - 0.5f;
+                float dy = (y + 0.5f) / height - 0.5f;
+                float dz = (z + 0.5f) / depth - 0.5f;
+                if (dx * dx + dy * dy + dz * dz <= 0.25f) {
+                    size_t index = ((size_t)z * height + y) * width + x;
+                    volume_data[index] = rand() % 256;
+                }
+            }
+        }
+    }
+
+    update_volume(entity, volume_data, VOLUME_UINT8, width, height, depth);
+    free(volume_data);
+}
+
+void cube_volume(entity_t entity) {
+    int width, height, depth;
+    volume_generator_dims(entity, &width, &height, &depth);
+
+    // Prepare volume data
+    uint8_t* volume_data = (uint8_t*)calloc((size_t)width * height * depth, sizeof(uint8_t));
+    if (!volume_data) {
+        printf("Failed to allocate memory for volume data!\n");
+        return;
+    }
+
+    for (int z = 0; z < depth; z++) {
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                // Check if the point is on an edge of the cube
+                // Points that are in the faces but not on the edges are on exactly one boundary, so they are excluded
+                int boundaries = (x == 0 || x == width - 1) + (y == 0 || y == height - 1) + (z == 0 || z == depth - 1);
+                if (boundaries > 1) {
+                    size_t index = ((size_t)z * height + y) * width + x;
+                    volume_data[index] = 255;
+                }
+            }
+        }
+    }
+
+    update_volume(entity, volume_data, VOLUME_UINT8, width, height, depth);
+    free(volume_data);
+}
+
+// Map a whole file copy-on-write, so edits to the voxels never reach the disk. Returns false if it can't be opened
+static bool map_volume_file(const char* path, uint8_t** data, size_t* size) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        printf("Failed to open volume: %s\n", path);
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size == 0) {
+        printf("Failed to read volume: %s\n", path);
+        close(fd);
+        return false;
+    }
+    // The mapping stays valid once the file is closed
+    void* mapped = mmap(NULL, info.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) {
+        printf("Failed to map volume: %s\n", path);
+        return false;
+    }
+    *data = (uint8_t*)mapped;
+    *size = info.st_size;
+    return true;
+}
+
+// Turn the width x height x depth voxels at offset into a mapped file into the volume of entity, consuming the mapping.
+// Voxels are used right where they are mapped, so nothing is copied and pages are only read in by the first pass over
+// them (building mips). Only files that need their bytes swapped, floats the GPU can't filter, or voxels that aren't
+// aligned to their size get converted, a slice at a time
+static bool volume_from_mapping(entity_t entity, uint8_t* mapped, size_t mapped_size, size_t offset,
+                                int width, int height, int depth, volume_type_t type, bool swap) {
+    const size_t count = (size_t)width * height * depth;
+    const size_t size = volume_type_size(type);
+    if (width <= 0 || height <= 0 || depth <= 0 || offset > mapped_size || (mapped_size - offset) / size < count) {
+        printf("Volume file is smaller than %dx%dx%d voxels\n", width, height, depth);
+        munmap(mapped, mapped_size);
+        return false;
+    }
+    madvise(mapped, mapped_size, MADV_SEQUENTIAL);
+    swap = swap && size > 1;
+
+    const volume_type_t stored = volume_storage_type(type);
+    if (stored == type && !swap && offset % size == 0) {
+        if (!volume_set_storage(entity, mapped + offset, type, mapped, mapped_size, width, height, depth)) {
+            return false;
+        }
+    } else {
+        uint8_t* voxels = (uint8_t*)malloc(count * volume_type_size(stored));
+        if (!voxels) {
+            printf("Failed to allocate memory for a %dx%dx%d volume!\n", width, height, depth);
+            munmap(mapped, mapped_size);
+            return false;
+        }
+        const size_t slice = (size_t)width * height;
+        for (int z = 0; z < depth; z++) {
+            volume_convert(&voxels[z * slice * volume_type_size(stored)], stored, &mapped[offset + z * slice * size], type, slice, swap);
+            // Slices that are done don't need to stay resident
+            size_t done = (offset + (z + 1) * slice * size) & ~(size_t)(getpagesize() - 1);
+            madvise(mapped, done, MADV_DONTNEED);
+        }
+        munmap(mapped, mapped_size);
+        if (!volume_set_storage(entity, voxels, stored, NULL, 0, width, height, depth)) {
+            return false;
+        }
+    }
+    update_volume_region(entity, get_volume(entity)->_volume, 0, 0, 0, width, height, depth);
+    return true;
+}
+
+// Load a headerless volume of width x height x depth little endian voxels, x fastest
+bool load_raw_volume(entity_t entity, const char* path, int width, int height, int depth, volume_type_t type) {
+    uint8_t* mapped;
+    size_t size;
+    if (!map_volume_file(path, &mapped, &size)) {
+        return false;
+    }
+    return volume_from_mapping(entity, mapped, size, 0, width, height, depth, type, false);
+}
+
+// Load a 3D NRRD volume with raw encoding, attached (.nrrd) or detached (.nhdr). Spacing is taken from the header if it has one
+bool load_nrrd_volume(entity_t entity, const char* path) {
+    uint8_t* header;
+    size_t header_size;
+    if (!map_volume_file(path, &header, &header_size)) {
+        return false;
+    }
+    if (header_size < 8 || memcmp(header, "NRRD000", 7) != 0) {
+        printf("Not a NRRD file: %s\n", path);
+        munmap(header, header_size);
+        return false;
+    }
+
+    int sizes[3] = { 0, 0, 0 };
+    int dimension = 0;
+    int type = -1;
+    bool raw = false, big_endian = false;
+    hmm_vec3 spacing = HMM_Vec3(0.0f, 0.0f, 0.0f);
+    long byte_skip = 0;
+    char data_file[1024] = "";
+    size_t offset = 0;
+
+    // Fields are "key: value" lines up to the first empty line, which is where attached data starts
+    size_t pos = 0;
+    while (pos < header_size) {
+        size_t end = pos;
+        while (end < header_size && header[end] != '\n') {
+            end++;
+        }
+        char line[1024];
+        size_t length = end - pos < sizeof(line) - 1 ? end - pos : sizeof(line) - 1;
+        memcpy(line, &header[pos], length);
+        line[length] = '\0';
+        if (length > 0 && line[length - 1] == '\r') {
+            line[--length] = '\0';
+        }
+        pos = end + 1;
+        if (length == 0) {
+            offset = pos;
+            break;
+        }
+        char* value = strstr(line, ": ");
+        if (line[0] == '#' || !value) {
+            continue;
+        }
+        *value = '\0';
+        value += 2;
+
+        if (strcmp(line, "dimension") == 0) {
+            dimension = atoi(value);
+        } else if (strcmp(line, "sizes") == 0) {
+            sscanf(value, "%d %d %d", &sizes[0], &sizes[1], &sizes[2]);
+        } else if (strcmp(line, "type") == 0) {
+            if (!strcmp(value, "uchar") || !strcmp(value, "unsigned char") || !strcmp(value, "uint8") || !strcmp(value, "uint8_t")) {
+                type = VOLUME_UINT8;
+            } else if (!strcmp(value, "ushort") || !strcmp(value, "unsigned short") || !strcmp(value, "unsigned short int") ||
+                       !strcmp(value, "uint16") || !strcmp(value, "uint16_t")) {
+                type = VOLUME_UINT16;
+            } else if (!strcmp(value, "float")) {
+                type = VOLUME_FLOAT;
+            }
+        } else if (strcmp(line, "encoding") == 0) {
+            raw = strcmp(value, "raw") == 0;
+        } else if (strcmp(line, "endian") == 0) {
+            big_endian = strcmp(value, "big") == 0;
+        } else if (strcmp(line, "spacings") == 0) {
+            sscanf(value, "%f %f %f", &spacing.X, &spacing.Y, &spacing.Z);
+        } else if (strcmp(line, "space directions") == 0) {
+            // One vector per axis, its length is the spacing
+            hmm_vec3 axes[3];
+            if (sscanf(value, " (%f,%f,%f) (%f,%f,%f) (%f,%f,%f)", &axes[0].X, &axes[0].Y, &axes[0].Z,
+                       &axes[1].X, &axes[1].Y, &axes[1].Z, &axes[2].X, &axes[2].Y, &axes[2].Z) == 9) {
+                spacing = HMM_Vec3(HMM_LengthVec3(axes[0]), HMM_LengthVec3(axes[1]), HMM_LengthVec3(axes[2]));
+            }
+        } else if (strcmp(line, "byte skip") == 0) {
+            byte_skip = atol(value);
+        } else if (strcmp(line, "data file") == 0 || strcmp(line, "datafile") == 0) {
+            snprintf(data_file, sizeof(data_file), "%s", value);
+        }
+    }
 
-// Define component structs
-typedef struct {
-    hmm_vec3 position;
-    hmm_vec3 rotation; // Euler angles
-    hmm_mat4 _transform; // Transform of the object based on position and rotation.
-    // When they disagree, the pos/rot always takes precedence and this tranform is just used for per-frame calculations
-} transform_c_t;
+    if (dimension != 3 || type < 0 || !raw || (offset == 0 && data_file[0] == '\0') || byte_skip < 0) {
+        printf("Unsupported NRRD file %s, only 3D raw uint8, uint16 or float volumes can be loaded\n", path);
+        munmap(header, header_size);
+        return false;
+    }
+    bool swap = big_endian != (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__);
+
+    // Detached data lives next to the header
+    uint8_t* mapped = header;
+    size_t mapped_size = header_size;
+    if (data_file[0] != '\0') {
+        char data_path[2048];
+        const char* last_slash = strrchr(path, '/');
+        if (data_file[0] == '/' || !last_slash) {
+            snprintf(data_path, sizeof(data_path), "%s", data_file);
+        } else {
+            snprintf(data_path, sizeof(data_path), "%.*s/%s", (int)(last_slash - path), path, data_file);
+        }
+        munmap(header, header_size);
+        if (!map_volume_file(data_path, &mapped, &mapped_size)) {
+            return false;
+        }
+        offset = 0;
+    }
+    offset += byte_skip;
+
+    if (!volume_from_mapping(entity, mapped, mapped_size, offset, sizes[0], sizes[1], sizes[2], (volume_type_t)type, swap)) {
+        return false;
+    }
+    // Replaces the default the volume picked from its size, the voxels are the same either way
+    if (spacing.X > 0.0f && spacing.Y > 0.0f && spacing.Z > 0.0f) {
+        set_volume_spacing(entity, spacing);
+    }
+    return true;
+}
+
+// Volume streaming
+// Chunked volumes (Zarr v2 arrays, like the levels of an OME-Zarr image) are read and decompressed by a pool of worker
+// threads. Finished chunks go through a lock-free queue to the frame loop, which writes a few of them into the volume
+// per frame, so frames never wait on the disk or on zlib
+#define STREAM_WORKERS 4
+#define STREAM_QUEUE_SIZE 64 // Decoded chunks waiting for the frame loop, must be a power of two
+#define STREAM_CHUNKS_PER_FRAME 8 // Chunks written into the volume per frame
 
+// A decoded chunk, in the volume's storage type and cut to the part inside the volume
 typedef struct {
-    float* _vertices;
-    uint16_t* _indices;
-    unsigned _vertices_size;
-    unsigned _indices_size;
-    unsigned face_count;
-    sg_buffer vbuf;
-    sg_buffer ibuf;
-    sg_bindings binding;
-} mesh_c_t;
+    int x, y, z;       // Voxel offset of the chunk
+    int w, h, d;
+    uint8_t* voxels;   // NULL for chunks that don't exist on disk and keep the fill value
+} stream_chunk_t;
 
+// Bounded queue of chunks that any thread can push to and pop from without locking. Each slot's sequence number says
+// whether it's free for the push at that position or holds the value for the pop at that position
 typedef struct {
-    // uint8_t _volume[50 * 50 * 50]; // All volumes come in increments of 500x500x500 // TODO malloc
-    uint8_t* _volume;  // Pointer to dynamically allocated volume data
-    hmm_vec3 position; // Position of the volume
-    sg_image img;
-    sg_buffer vbuf;
-} volume_c_t;
+    struct {
+        atomic_size_t sequence;
+        stream_chunk_t chunk;
+    } slots[STREAM_QUEUE_SIZE];
+    atomic_size_t head; // Position of the next push
+    atomic_size_t tail; // Position of the next pop
+} chunk_queue_t;
+
+static void chunk_queue_init(chunk_queue_t* queue) {
+    for (size_t i = 0; i < STREAM_QUEUE_SIZE; i++) {
+        atomic_init(&queue->slots[i].sequence, i);
+    }
+    atomic_init(&queue->head, 0);
+    atomic_init(&queue->tail, 0);
+}
 
-// ECS Global struct
-static struct {
-    // Transforms of each object
-    bool transforms_valid[NUM_COMPONENTS];
-    transform_c_t transforms[NUM_COMPONENTS];
-    
-    // Object mesh buffer
-    bool mesh_valid[NUM_COMPONENTS];
-    mesh_c_t meshes[NUM_COMPONENTS];
-
-    // 3D volume buffer
-    // TODO this should be malloced
-    bool volume_valid[NUM_COMPONENTS];
-    volume_c_t volumes[NUM_COMPONENTS];
-} ecs = {
-    .transforms_valid   = { [0 ... NUM_COMPONENTS-1] = false },
-    .mesh_valid         = { [0 ... NUM_COMPONENTS-1] = false },
-    .volume_valid       = { [0 ... NUM_COMPONENTS-1] = false }
-};
+// Returns false if the queue is full
+static bool chunk_queue_push(chunk_queue_t* queue, stream_chunk_t chunk) {
+    size_t pos = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    for (;;) {
+        size_t sequence = atomic_load_explicit(&queue->slots[pos & (STREAM_QUEUE_SIZE - 1)].sequence, memory_order_acquire);
+        intptr_t diff = (intptr_t)sequence - (intptr_t)pos;
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&queue->head, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = atomic_load_explicit(&queue->head, memory_order_relaxed);
+        }
+    }
+    queue->slots[pos & (STREAM_QUEUE_SIZE - 1)].chunk = chunk;
+    atomic_store_explicit(&queue->slots[pos & (STREAM_QUEUE_SIZE - 1)].sequence, pos + 1, memory_order_release);
+    return true;
+}
 
-// Component-specific functions
-void update_transform(int index, transform_c_t *data) {
-    ecs.transforms_valid[index] = true;
-    memcpy(&ecs.transforms[index], data, sizeof(transform_c_t));
+// Returns false if the queue is empty
+static bool chunk_queue_pop(chunk_queue_t* queue, stream_chunk_t* chunk) {
+    size_t pos = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    for (;;) {
+        size_t sequence = atomic_load_explicit(&queue->slots[pos & (STREAM_QUEUE_SIZE - 1)].sequence, memory_order_acquire);
+        intptr_t diff = (intptr_t)sequence - (intptr_t)(pos + 1);
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&queue->tail, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+        }
+    }
+    *chunk = queue->slots[pos & (STREAM_QUEUE_SIZE - 1)].chunk;
+    atomic_store_explicit(&queue->slots[pos & (STREAM_QUEUE_SIZE - 1)].sequence, pos + STREAM_QUEUE_SIZE, memory_order_release);
+    return true;
 }
 
-// Update or create a volume. Will set it to valid and malloc as needed
-void update_volume(int index, uint8_t* volume_data) {
-    ecs.volume_valid[index] = true;
-    if (ecs.volumes[index]._volume == NULL) {
-        ecs.volumes[index]._volume = (uint8_t*)calloc(VOLUME_DIMENSIONS * VOLUME_DIMENSIONS * VOLUME_DIMENSIONS, sizeof(uint8_t));
+typedef struct volume_stream_t {
+    char path[1024];         // Directory of the array
+    int width, height, depth;
+    int chunk_w, chunk_h, chunk_d; // Voxels per chunk, edge chunks are stored padded to full size
+    int chunks_x, chunks_y, chunks_z;
+    int chunk_count;
+    volume_type_t type;      // Of the chunks on disk
+    volume_type_t stored;    // Of the volume they go into
+    bool swap;               // Stored with the other endianness
+    bool compressed;         // zlib or gzip, anything else is refused when opening
+    char separator;          // Between chunk indices in file names, '.' or '/'
+    chunk_queue_t queue;
+    atomic_int next_chunk;   // Next chunk for a worker to claim
+    atomic_bool stop;
+    pthread_t workers[STREAM_WORKERS];
+    int worker_count;
+    int chunks_done;         // Chunks the frame loop has written into the volume
+    int chunks_failed;
+} volume_stream_t;
+
+// Read and decode one chunk. Returns false on a corrupt or unreadable chunk
+static bool volume_stream_decode(volume_stream_t* stream, int index, uint8_t** file, size_t* file_capacity, uint8_t* raw, stream_chunk_t* chunk) {
+    int cx = index % stream->chunks_x;
+    int cy = index / stream->chunks_x % stream->chunks_y;
+    int cz = index / (stream->chunks_x * stream->chunks_y);
+    *chunk = (stream_chunk_t){
+        .x = cx * stream->chunk_w, .y = cy * stream->chunk_h, .z = cz * stream->chunk_d,
+        .w = HMM_MIN(stream->chunk_w, stream->width - cx * stream->chunk_w),
+        .h = HMM_MIN(stream->chunk_h, stream->height - cy * stream->chunk_h),
+        .d = HMM_MIN(stream->chunk_d, stream->depth - cz * stream->chunk_d),
+    };
+
+    // Chunk keys go slowest axis first
+    char path[1100];
+    snprintf(path, sizeof(path), "%s/%d%c%d%c%d", stream->path, cz, stream->separator, cy, stream->separator, cx);
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return true; // Never written, so it's all fill value
     }
-    
-    memcpy(ecs.volumes[index]._volume, volume_data, VOLUME_DIMENSIONS * VOLUME_DIMENSIONS * VOLUME_DIMENSIONS * sizeof(uint8_t));
+    struct stat info;
+    bool ok = fstat(fd, &info) == 0;
+    if (ok && (size_t)info.st_size > *file_capacity) {
+        uint8_t* grown = (uint8_t*)realloc(*file, info.st_size);
+        ok = grown != NULL;
+        if (ok) {
+            *file = grown;
+            *file_capacity = info.st_size;
+        }
+    }
+    size_t size = ok ? info.st_size : 0;
+    for (size_t read_bytes = 0; ok && read_bytes < size;) {
+        ssize_t n = read(fd, *file + read_bytes, size - read_bytes);
+        ok = n > 0;
+        read_bytes += ok ? n : 0;
+    }
+    close(fd);
+
+    const size_t raw_size = (size_t)stream->chunk_w * stream->chunk_h * stream->chunk_d * volume_type_size(stream->type);
+    const uint8_t* data = *file;
+    if (ok && stream->compressed) {
+        // Window bits of 32 + MAX_WBITS accept both zlib and gzip headers
+        z_stream z = { .next_in = *file, .avail_in = (uInt)size, .next_out = raw, .avail_out = (uInt)raw_size };
+        ok = inflateInit2(&z, 32 + MAX_WBITS) == Z_OK;
+        if (ok) {
+            ok = inflate(&z, Z_FINISH) == Z_STREAM_END && z.total_out == raw_size;
+            inflateEnd(&z);
+        }
+        data = raw;
+    } else {
+        ok = ok && size >= raw_size;
+    }
+    if (!ok) {
+        return false;
+    }
+
+    const size_t voxel_size = volume_type_size(stream->type), stored_size = volume_type_size(stream->stored);
+    chunk->voxels = (uint8_t*)malloc((size_t)chunk->w * chunk->h * chunk->d * stored_size);
+    if (!chunk->voxels) {
+        return false;
+    }
+    uint8_t* dst = chunk->voxels;
+    for (int z = 0; z < chunk->d; z++) {
+        for (int y = 0; y < chunk->h; y++, dst += chunk->w * stored_size) {
+            size_t row = ((size_t)z * stream->chunk_h + y) * stream->chunk_w;
+            volume_convert(dst, stream->stored, &data[row * voxel_size], stream->type, chunk->w, stream->swap);
+        }
+    }
+    return true;
+}
+
+static void* volume_stream_worker(void* user) {
+    volume_stream_t* stream = (volume_stream_t*)user;
+    uint8_t* file = NULL;
+    size_t file_capacity = 0;
+    uint8_t* raw = (uint8_t*)malloc((size_t)stream->chunk_w * stream->chunk_h * stream->chunk_d * volume_type_size(stream->type));
+    while (raw && !atomic_load(&stream->stop)) {
+        int index = atomic_fetch_add(&stream->next_chunk, 1);
+        if (index >= stream->chunk_count) {
+            break;
+        }
+        stream_chunk_t chunk;
+        if (!volume_stream_decode(stream, index, &file, &file_capacity, raw, &chunk)) {
+            chunk.w = 0; // Tells the frame loop this one failed
+        }
+        // Wait for the frame loop to make room
+        while (!chunk_queue_push(&stream->queue, chunk)) {
+            if (atomic_load(&stream->stop)) {
+                free(chunk.voxels);
+                break;
+            }
+            usleep(1000);
+        }
+    }
+    free(file);
+    free(raw);
+    return NULL;
+}
+
+static void close_volume_stream(volume_stream_t* stream) {
+    atomic_store(&stream->stop, true);
+    for (int i = 0; i < stream->worker_count; i++) {
+        pthread_join(stream->workers[i], NULL);
+    }
+    stream_chunk_t chunk;
+    while (chunk_queue_pop(&stream->queue, &chunk)) {
+        free(chunk.voxels);
+    }
+    free(stream);
+}
+
+// Find the value of "key" in a JSON object, as a pointer just past its colon. Good enough for Zarr metadata
+static const char* json_value(const char* json, const char* key) {
+    char quoted[64];
+    snprintf(quoted, sizeof(quoted), "\"%s\"", key);
+    const char* found = strstr(json, quoted);
+    if (!found) {
+        return NULL;
+    }
+    found = strchr(found + strlen(quoted), ':');
+    if (!found) {
+        return NULL;
+    }
+    found++;
+    while (*found == ' ' || *found == '\t' || *found == '\n' || *found == '\r') {
+        found++;
+    }
+    return found;
+}
+
+// Read up to max integers from a JSON array. Returns how many there were
+static int json_int_array(const char* value, int* values, int max) {
+    if (!value || *value != '[') {
+        return 0;
+    }
+    int count = 0;
+    const char* p = value + 1;
+    while (*p && *p != ']') {
+        char* end;
+        long v = strtol(p, &end, 10);
+        if (end == p) {
+            p++;
+            continue;
+        }
+        if (count < max) {
+            values[count] = (int)v;
+        }
+        count++;
+        p = end;
+    }
+    return count;
+}
+
+// Start streaming a chunked Zarr v2 array (directory with a .zarray) into the volume of entity. The volume is there right away,
+// filled with the fill value, and chunks show up in it as they're decoded. Its window spans the values read so far, until
+// set_volume_window sets one. Arrays must be C ordered, have at most three axes bigger than one, and be uncompressed or
+// use zlib or gzip
+bool open_zarr_volume(entity_t entity, const char* path) {
+    char meta_path[1100];
+    snprintf(meta_path, sizeof(meta_path), "%s/.zarray", path);
+    FILE* file = fopen(meta_path, "rb");
+    if (!file) {
+        printf("Failed to open Zarr array: %s\n", meta_path);
+        return false;
+    }
+    char meta[4096];
+    size_t length = fread(meta, 1, sizeof(meta) - 1, file);
+    fclose(file);
+    meta[length] = '\0';
+
+    // OME-Zarr adds leading time and channel axes, which have to be 1 to be read as a volume
+    int shape[8], chunks[8];
+    int axes = json_int_array(json_value(meta, "shape"), shape, 8);
+    bool ok = axes >= 3 && axes <= 8 && json_int_array(json_value(meta, "chunks"), chunks, 8) == axes;
+    for (int i = 0; ok && i < axes - 3; i++) {
+        ok = shape[i] == 1;
+    }
+    const char* dtype = json_value(meta, "dtype");
+    const char* compressor = json_value(meta, "compressor");
+    const char* order = json_value(meta, "order");
+    const char* separator = json_value(meta, "dimension_separator");
+    ok = ok && dtype && compressor && (!order || strncmp(order, "\"C\"", 3) == 0);
+
+    volume_type_t type = VOLUME_UINT8;
+    bool big_endian = false;
+    if (ok) {
+        big_endian = dtype[1] == '>';
+        if (strncmp(dtype + 2, "u1\"", 3) == 0) {
+            type = VOLUME_UINT8;
+        } else if (strncmp(dtype + 2, "u2\"", 3) == 0) {
+            type = VOLUME_UINT16;
+        } else if (strncmp(dtype + 2, "f2\"", 3) == 0) {
+            type = VOLUME_HALF;
+        } else if (strncmp(dtype + 2, "f4\"", 3) == 0) {
+            type = VOLUME_FLOAT;
+        } else {
+            ok = false;
+        }
+    }
+    bool compressed = ok && strncmp(compressor, "null", 4) != 0;
+    if (compressed) {
+        const char* id = json_value(compressor, "id");
+        ok = id && (strncmp(id, "\"zlib\"", 6) == 0 || strncmp(id, "\"gzip\"", 6) == 0);
+    }
+    if (!ok) {
+        printf("Unsupported Zarr array %s, only uint8, uint16, half or float volumes compressed with zlib, gzip or nothing can be streamed\n", path);
+        return false;
+    }
+
+    int width = shape[axes - 1], height = shape[axes - 2], depth = shape[axes - 3];
+    const volume_type_t stored = volume_storage_type(type);
+    volume_stream_t* stream = (volume_stream_t*)calloc(1, sizeof(volume_stream_t));
+    uint8_t* voxels = width > 0 && height > 0 && depth > 0 ? (uint8_t*)calloc((size_t)width * height * depth, volume_type_size(stored)) : NULL;
+    if (!stream || !voxels) {
+        printf("Failed to allocate memory for a %dx%dx%d volume!\n", width, height, depth);
+        free(stream);
+        free(voxels);
+        return false;
+    }
+    snprintf(stream->path, sizeof(stream->path), "%s", path);
+    stream->width = width;
+    stream->height = height;
+    stream->depth = depth;
+    stream->chunk_w = HMM_MAX(chunks[axes - 1], 1);
+    stream->chunk_h = HMM_MAX(chunks[axes - 2], 1);
+    stream->chunk_d = HMM_MAX(chunks[axes - 3], 1);
+    stream->chunks_x = (width + stream->chunk_w - 1) / stream->chunk_w;
+    stream->chunks_y = (height + stream->chunk_h - 1) / stream->chunk_h;
+    stream->chunks_z = (depth + stream->chunk_d - 1) / stream->chunk_d;
+    stream->chunk_count = stream->chunks_x * stream->chunks_y * stream->chunks_z;
+    stream->type = type;
+    stream->stored = stored;
+    stream->swap = type != VOLUME_UINT8 && big_endian != (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__);
+    stream->compressed = compressed;
+    stream->separator = separator && strncmp(separator, "\"/\"", 3) == 0 ? '/' : '.';
+    chunk_queue_init(&stream->queue);
+    atomic_init(&stream->next_chunk, 0);
+    atomic_init(&stream->stop, false);
+
+    // Chunks that were never written keep the fill value
+    const char* fill = json_value(meta, "fill_value");
+    float fill_value = fill && strncmp(fill, "null", 4) != 0 ? strtof(fill, NULL) : 0.0f;
+    for (size_t i = 0; fill_value != 0.0f && i < (size_t)width * height * depth; i++) {
+        volume_store(voxels, i, stored, fill_value);
+    }
+    if (!volume_set_storage(entity, voxels, stored, NULL, 0, width, height, depth)) {
+        free(stream);
+        return false;
+    }
+    update_volume_region(entity, voxels, 0, 0, 0, width, height, depth);
+    get_volume(entity)->stream = stream;
+
+    for (int i = 0; i < STREAM_WORKERS; i++) {
+        if (pthread_create(&stream->workers[stream->worker_count], NULL, volume_stream_worker, stream) == 0) {
+            stream->worker_count++;
+        }
+    }
+    if (stream->worker_count == 0) {
+        printf("Failed to start any workers to stream %s\n", path);
+        free_volume(entity);
+        return false;
+    }
+    return true;
+}
+
+// Write chunks the workers finished into a streaming volume, at most STREAM_CHUNKS_PER_FRAME of them, and classify the
+// macro cells once for all of them. Closes the stream once every chunk is in
+void update_volume_stream(entity_t entity) {
+    volume_c_t* volume = get_volume(entity);
+    volume_stream_t* stream = volume->stream;
+    stream_chunk_t chunk;
+    bool written = false;
+    for (int i = 0; i < STREAM_CHUNKS_PER_FRAME && chunk_queue_pop(&stream->queue, &chunk); i++) {
+        if (chunk.w == 0) {
+            stream->chunks_failed++;
+        } else if (chunk.voxels) {
+            volume_write_region(volume, chunk.voxels, chunk.x, chunk.y, chunk.z, chunk.w, chunk.h, chunk.d);
+            free(chunk.voxels);
+            written = true;
+        }
+        stream->chunks_done++;
+    }
+    if (written) {
+        // The window was picked while the volume held nothing but the fill value, so it follows the data as it comes in
+        if (!volume->window_set) {
+            volume_default_window(volume);
+        }
+        volume_classify(volume);
+        volume->revision++;
+    }
+    if (stream->chunks_done == stream->chunk_count) {
+        if (stream->chunks_failed > 0) {
+            printf("Failed to read %d of %d chunks of %s\n", stream->chunks_failed, stream->chunk_count, stream->path);
+        }
+        close_volume_stream(stream);
+        volume->stream = NULL;
+    }
+}
+
+// Read the nearest wanted brick from the source until told to stop
+static void* brick_loader(void* user) {
+    bricked_volume_t* bricks = (bricked_volume_t*)user;
+    pthread_mutex_lock(&bricks->lock);
+    while (!bricks->loader_stop) {
+        brick_load_t* load = NULL;
+        for (int i = 0; i < BRICK_LOADS; i++) {
+            brick_load_t* wanted = &bricks->loads[i];
+            if (wanted->state == BRICK_LOAD_WANTED && (!load || wanted->distance < load->distance)) {
+                load = wanted;
+            }
+        }
+        if (!load) {
+            pthread_cond_wait(&bricks->wake, &bricks->lock);
+            continue;
+        }
+        // The frame loop leaves loads alone while they're being read, and the cache's layout never changes
+        load->state = BRICK_LOAD_READING;
+        pthread_mutex_unlock(&bricks->lock);
+        int level, bx, by, bz;
+        brick_cache_brick_coords(&bricks->cache, load->brick, &level, &bx, &by, &bz);
+        bool ok = bricks->source.read_brick(bricks->source.user, level, bx, by, bz, load->reduce, load->voxels);
+        pthread_mutex_lock(&bricks->lock);
+        load->state = ok ? BRICK_LOAD_READ : BRICK_LOAD_FAILED;
+    }
+    pthread_mutex_unlock(&bricks->lock);
+    return NULL;
+}
+
+static void free_bricked_volume(bricked_volume_t* bricks) {
+    // A coarse brick can take the loader a long time, so it's asked to give up on it
+    if (bricks->loader_running) {
+        pthread_mutex_lock(&bricks->lock);
+        bricks->loader_stop = true;
+        pthread_cond_signal(&bricks->wake);
+        pthread_mutex_unlock(&bricks->lock);
+        if (bricks->source.cancel) {
+            bricks->source.cancel(bricks->source.user);
+        }
+        pthread_join(bricks->loader, NULL);
+    }
+    pthread_mutex_destroy(&bricks->lock);
+    pthread_cond_destroy(&bricks->wake);
+    if (bricks->source.close) {
+        bricks->source.close(bricks->source.user);
+    }
+    sg_destroy_image(bricks->atlas);
+    sg_destroy_image(bricks->page_table);
+    brick_cache_free(&bricks->cache);
+    free(bricks->atlas_mirror);
+    free(bricks->loads[0].voxels);
+    free(bricks->visible);
+    free(bricks->request_of);
+    free(bricks->wanted_level);
+    free(bricks);
+}
 
-    ecs.volumes[index].img = sg_make_image(&(sg_image_desc){
+// Create an out-of-core volume of width x height x depth voxels whose bricks are read from source as the camera needs them.
+// The volume takes ownership of the source
+bool create_bricked_volume(entity_t entity, brick_source_t source, int width, int height, int depth) {
+    // Whatever the entity had before goes, except its voxel spacing
+    volume_c_t* previous = get_volume(entity);
+    const hmm_vec3 spacing = previous ? previous->spacing : HMM_Vec3(0.0f, 0.0f, 0.0f);
+    free_volume(entity);
+    volume_c_t* volume = (volume_c_t*)component_add(&ecs.volumes, entity);
+    if (!volume) {
+        return false;
+    }
+    volume->spacing = spacing;
+
+    bricked_volume_t* bricks = (bricked_volume_t*)calloc(1, sizeof(bricked_volume_t));
+    if (!bricks) {
+        if (source.close) {
+            source.close(source.user);
+        }
+        component_remove(&ecs.volumes, entity);
+        return false;
+    }
+    bricks->source = source;
+    pthread_mutex_init(&bricks->lock, NULL);
+    pthread_cond_init(&bricks->wake, NULL);
+    int grid_x = (width + BRICK_SIZE - 1) / BRICK_SIZE;
+    int grid_y = (height + BRICK_SIZE - 1) / BRICK_SIZE;
+    int grid_z = (depth + BRICK_SIZE - 1) / BRICK_SIZE;
+    const size_t brick_bytes = BRICK_SIZE * BRICK_SIZE * BRICK_SIZE;
+    const size_t atlas_bytes = brick_bytes * BRICK_ATLAS_X * BRICK_ATLAS_Y * BRICK_ATLAS_Z;
+    bool ok = brick_cache_init(&bricks->cache, grid_x, grid_y, grid_z, BRICK_ATLAS_X, BRICK_ATLAS_Y, BRICK_ATLAS_Z);
+    uint8_t* load_voxels = (uint8_t*)malloc(brick_bytes * BRICK_LOADS);
+    for (int i = 0; load_voxels && i < BRICK_LOADS; i++) {
+        bricks->loads[i].voxels = load_voxels + brick_bytes * i;
+    }
+    if (ok) {
+        bricks->visible = (brick_request_t*)malloc(bricks->cache.brick_count * sizeof(brick_request_t));
+        bricks->request_of = (int32_t*)malloc(bricks->cache.brick_count * sizeof(int32_t));
+        bricks->wanted_level = (uint8_t*)malloc((size_t)grid_x * grid_y * grid_z);
+    }
+    ok = ok && load_voxels && bricks->visible && bricks->request_of && bricks->wanted_level;
+
+#if defined(SOKOL_METAL)
+    // Bricks get written straight into the texture, so it only needs initial (empty) contents
+    uint8_t* empty = ok ? (uint8_t*)calloc(atlas_bytes, 1) : NULL;
+    if (empty) {
+        bricks->atlas = sg_make_image(&(sg_image_desc){
+            .type = SG_IMAGETYPE_3D,
+            .width = BRICK_ATLAS_X * BRICK_SIZE,
+            .height = BRICK_ATLAS_Y * BRICK_SIZE,
+            .num_slices = BRICK_ATLAS_Z * BRICK_SIZE,
+            .pixel_format = SG_PIXELFORMAT_R8,
+            .data.subimage[0][0] = { .ptr = empty, .size = atlas_bytes },
+            .label = "brick-atlas"
+        });
+        free(empty);
+    }
+    ok = ok && empty;
+#else
+    // No partial uploads here, bricks go into a CPU copy which is uploaded whole when it changes
+    bricks->atlas_mirror = ok ? (uint8_t*)calloc(atlas_bytes, 1) : NULL;
+    ok = ok && bricks->atlas_mirror;
+    if (ok) {
+        bricks->atlas = sg_make_image(&(sg_image_desc){
+            .type = SG_IMAGETYPE_3D,
+            .width = BRICK_ATLAS_X * BRICK_SIZE,
+            .height = BRICK_ATLAS_Y * BRICK_SIZE,
+            .num_slices = BRICK_ATLAS_Z * BRICK_SIZE,
+            .pixel_format = SG_PIXELFORMAT_R8,
+            .usage = SG_USAGE_DYNAMIC,
+            .label = "brick-atlas"
+        });
+        bricks->atlas_dirty = true;
+    }
+#endif
+    if (ok) {
+        bricks->loader_running = pthread_create(&bricks->loader, NULL, brick_loader, bricks) == 0;
+        ok = bricks->loader_running;
+    }
+    if (!ok) {
+        printf("Failed to allocate a %dx%dx%d bricked volume!\n", width, height, depth);
+        free_bricked_volume(bricks);
+        component_remove(&ecs.volumes, entity);
+        return false;
+    }
+
+    bricks->page_table = sg_make_image(&(sg_image_desc){
         .type = SG_IMAGETYPE_3D,
-        .width = VOLUME_DIMENSIONS, // Your volume dimensions
-        .height = VOLUME_DIMENSIONS,
-        .num_slices = VOLUME_DIMENSIONS,
-        .pixel_format = SG_PIXELFORMAT_R8, // Assuming 8-bit grayscale volume
-        .data.subimage[0][0] = {
-            .ptr = ecs.volumes[index]._volume,
-            .size = VOLUME_DIMENSIONS * VOLUME_DIMENSIONS * VOLUME_DIMENSIONS * sizeof(uint8_t)
-        },
-        .label = "volume-texture"
+        .width = grid_x,
+        .height = grid_y,
+        .num_slices = grid_z,
+        .pixel_format = SG_PIXELFORMAT_RGBA8,
+        .usage = SG_USAGE_DYNAMIC,
+        .label = "brick-page-table"
     });
+
+    volume->width = width;
+    volume->height = height;
+    volume->depth = depth;
+    if (volume->spacing.X <= 0.0f || volume->spacing.Y <= 0.0f || volume->spacing.Z <= 0.0f) {
+        int longest = width > height ? width : height;
+        longest = longest > depth ? longest : depth;
+        volume->spacing = HMM_Vec3(1.0f / longest, 1.0f / longest, 1.0f / longest);
+    }
+    volume->bricks = bricks;
+    return true;
 }
 
-// Free a volume
-void free_volume(int index) {
-    ecs.volume_valid[index] = false;
-    free(ecs.volumes[index]._volume);
+static int compare_brick_requests(const void* a, const void* b) {
+    float da = ((const brick_request_t*)a)->distance;
+    float db = ((const brick_request_t*)b)->distance;
+    return (da > db) - (da < db);
 }
 
-// Set a volume to random values
-void randomize_volume(int index) {
-    // Prepare volume data
-    uint8_t volume_data[VOLUME_DIMENSIONS * VOLUME_DIMENSIONS * VOLUME_DIMENSIONS] = {0};
-    for (int i = 0; i < VOLUME_DIMENSIONS * VOLUME_DIMENSIONS * VOLUME_DIMENSIONS; i++) {
-        volume_data[i] = rand() % 256;
+static void upload_brick(bricked_volume_t* bricks, int slot, const uint8_t* data) {
+    brick_cache_t* cache = &bricks->cache;
+    int x = (slot % cache->atlas_x) * BRICK_SIZE;
+    int y = ((slot / cache->atlas_x) % cache->atlas_y) * BRICK_SIZE;
+    int z = (slot / (cache->atlas_x * cache->atlas_y)) * BRICK_SIZE;
+    if (update_image_region(bricks->atlas, 0, x, y, z, BRICK_SIZE, BRICK_SIZE, BRICK_SIZE, data, BRICK_SIZE, BRICK_SIZE * BRICK_SIZE)) {
+        return;
+    }
+    const size_t row = (size_t)cache->atlas_x * BRICK_SIZE;
+    const size_t slice = row * cache->atlas_y * BRICK_SIZE;
+    for (int bz = 0; bz < BRICK_SIZE; bz++) {
+        for (int by = 0; by < BRICK_SIZE; by++) {
+            memcpy(&bricks->atlas_mirror[(z + bz) * slice + (y + by) * row + x], &data[(bz * BRICK_SIZE + by) * BRICK_SIZE], BRICK_SIZE);
+        }
+    }
+    bricks->atlas_dirty = true;
+}
+
+// Mip level at which one voxel of a volume covers about one pixel, distance world units from the eye.
+// lod_scale is the angle covered by a pixel divided by the voxel size
+static int volume_lod(float distance, float lod_scale, int levels) {
+    float footprint = distance * lod_scale;
+    int level = 0;
+    while (footprint >= 2.0f && level < levels - 1) {
+        footprint *= 0.5f;
+        level++;
+    }
+    return level;
+}
+
+// Page in the bricks of a volume that the camera can see, nearest first, and evict the least recently seen ones to make room.
+// Each visible brick asks for the mip level matching its distance from the eye, and shows up once the loader thread has
+// read it. Call once per frame before the volume is drawn
+void update_bricked_volume(volume_c_t* volume, hmm_vec3 position, hmm_mat4 view_proj, hmm_vec3 eye_pos, float lod_scale) {
+    bricked_volume_t* bricks = volume->bricks;
+    brick_cache_t* cache = &bricks->cache;
+    brick_cache_begin_frame(cache);
+    memset(bricks->wanted_level, 255, (size_t)cache->grid_x * cache->grid_y * cache->grid_z);
+    memset(bricks->request_of, -1, cache->brick_count * sizeof(int32_t));
+
+    // Work in the volume's [0, 1] box so brick bounds don't need transforming
+    hmm_vec3 extent = volume_extent(volume);
+    hmm_vec3 translation = position;
+    hmm_mat4 model = HMM_MultiplyMat4(HMM_Translate(translation), HMM_Scale(extent));
+    hmm_vec4 planes[6];
+    frustum_planes(HMM_MultiplyMat4(view_proj, model), planes);
+    hmm_vec3 eye = HMM_DivideVec3(HMM_SubtractVec3(eye_pos, translation), extent);
+
+    int visible_count = 0;
+    for (int bz = 0; bz < cache->grid_z; bz++) {
+        for (int by = 0; by < cache->grid_y; by++) {
+            for (int bx = 0; bx < cache->grid_x; bx++) {
+                hmm_vec3 box_min = HMM_Vec3((float)(bx * BRICK_SIZE) / volume->width,
+                                            (float)(by * BRICK_SIZE) / volume->height,
+                                            (float)(bz * BRICK_SIZE) / volume->depth);
+                hmm_vec3 box_max = HMM_Vec3(HMM_MIN((float)((bx + 1) * BRICK_SIZE) / volume->width, 1.0f),
+                                            HMM_MIN((float)((by + 1) * BRICK_SIZE) / volume->height, 1.0f),
+                                            HMM_MIN((float)((bz + 1) * BRICK_SIZE) / volume->depth, 1.0f));
+                if (!aabb_in_frustum(planes, box_min, box_max)) {
+                    continue;
+                }
+                // Distance to the nearest point of the brick in world units, so anisotropic volumes get the right level
+                hmm_vec3 nearest = HMM_Vec3(HMM_Clamp(box_min.X, eye.X, box_max.X),
+                                            HMM_Clamp(box_min.Y, eye.Y, box_max.Y),
+                                            HMM_Clamp(box_min.Z, eye.Z, box_max.Z));
+                hmm_vec3 offset = HMM_MultiplyVec3(HMM_SubtractVec3(nearest, eye), extent);
+                float distance = HMM_LengthVec3(offset);
+                int level = volume_lod(distance, lod_scale, cache->levels);
+                bricks->wanted_level[(bz * cache->grid_y + by) * cache->grid_x + bx] = (uint8_t)level;
+
+                // Neighbouring bricks often share the coarse brick covering them
+                int brick = brick_cache_brick_index(cache, level, bx >> level, by >> level, bz >> level);
+                int32_t request = bricks->request_of[brick];
+                if (request < 0) {
+                    bricks->request_of[brick] = visible_count;
+                    bricks->visible[visible_count++] = (brick_request_t){ .brick = brick, .distance = distance };
+                } else {
+                    bricks->visible[request].distance = HMM_MIN(bricks->visible[request].distance, distance);
+                }
+            }
+        }
+    }
+
+    // Protect everything that is already resident before evicting anything
+    for (int i = 0; i < visible_count; i++) {
+        brick_cache_touch(cache, bricks->visible[i].brick);
+    }
+    qsort(bricks->visible, visible_count, sizeof(brick_request_t), compare_brick_requests);
+
+    // Upload what the loader has read, and let go of whatever went out of view meanwhile.
+    // Reads still in progress just go on; the page table keeps pointing at coarser or finer bricks until they're in
+    int loads = 0, pending = 0;
+    pthread_mutex_lock(&bricks->lock);
+    for (int i = 0; i < BRICK_LOADS; i++) {
+        brick_load_t* load = &bricks->loads[i];
+        const bool wanted = bricks->request_of[load->brick] >= 0;
+        if (load->state == BRICK_LOAD_WANTED && !wanted) {
+            load->state = BRICK_LOAD_FREE;
+        }
+        if (load->state == BRICK_LOAD_READ || load->state == BRICK_LOAD_FAILED) {
+            int slot = wanted && loads < BRICK_UPLOADS_PER_FRAME ? brick_cache_acquire(cache, load->brick, NULL) : -1;
+            if (slot >= 0) {
+                if (load->state == BRICK_LOAD_FAILED) {
+                    // Keep the slot with empty contents so a bad brick isn't retried every frame
+                    int level, bx, by, bz;
+                    brick_cache_brick_coords(cache, load->brick, &level, &bx, &by, &bz);
+                    printf("Failed to read brick (%d, %d, %d) level %d of a %dx%dx%d volume\n", bx, by, bz, level, volume->width, volume->height, volume->depth);
+                    memset(load->voxels, 0, BRICK_SIZE * BRICK_SIZE * BRICK_SIZE);
+                }
+                upload_brick(bricks, slot, load->voxels);
+                loads++;
+            }
+            // Waits for a slot or the next frame's uploads while it's still in view
+            if (slot >= 0 || !wanted) {
+                load->state = BRICK_LOAD_FREE;
+            }
+        }
+    }
+
+    // Ask for the nearest bricks that aren't resident, as many as there are free loads for
+    int free_load = 0;
+    for (int i = 0; i < visible_count; i++) {
+        const int brick = bricks->visible[i].brick;
+        if (cache->brick_slot[brick] >= 0) {
+            continue;
+        }
+        brick_load_t* load = NULL;
+        for (int l = 0; l < BRICK_LOADS && !load; l++) {
+            load = bricks->loads[l].state != BRICK_LOAD_FREE && bricks->loads[l].brick == brick ? &bricks->loads[l] : NULL;
+        }
+        while (!load && free_load < BRICK_LOADS) {
+            load = bricks->loads[free_load].state == BRICK_LOAD_FREE ? &bricks->loads[free_load] : NULL;
+            free_load++;
+        }
+        if (!load) {
+            break;
+        }
+        if (load->state == BRICK_LOAD_FREE) {
+            *load = (brick_load_t){ .state = BRICK_LOAD_WANTED, .brick = brick, .reduce = volume->mip_reduce, .voxels = load->voxels };
+        }
+        load->distance = bricks->visible[i].distance;
+    }
+    for (int i = 0; i < BRICK_LOADS; i++) {
+        pending += bricks->loads[i].state != BRICK_LOAD_FREE;
+    }
+    pthread_cond_signal(&bricks->wake);
+    pthread_mutex_unlock(&bricks->lock);
+    bricks->visible_last_frame = visible_count;
+    bricks->loads_last_frame = loads;
+    bricks->loads_pending = pending;
+    brick_cache_update_page_table(cache, bricks->wanted_level);
+
+    if (bricks->atlas_dirty) {
+        const size_t atlas_bytes = (size_t)cache->slot_count * BRICK_SIZE * BRICK_SIZE * BRICK_SIZE;
+        sg_update_image(bricks->atlas, &(sg_image_data){ .subimage[0][0] = { .ptr = bricks->atlas_mirror, .size = atlas_bytes } });
+        bricks->atlas_dirty = false;
+    }
+    if (cache->page_table_dirty) {
+        sg_update_image(bricks->page_table, &(sg_image_data){ .subimage[0][0] = { .ptr = cache->page_table, .size = (size_t)cache->grid_x * cache->grid_y * cache->grid_z * 4 } });
+        cache->page_table_dirty = false;
+    }
+}
+
+
+// Global state
+static struct {
+    ImFont* default_font;
+    ImFont* main_font;
+    bool show_imgui_demo;
+} gui;
+
+static struct {
+    float cam_rx, cam_ry; // Latlong-esque camera rotations
+    float cam_fov;
+    float lod_bias; // Added to every volume mip level, negative for sharper distant volumes
+    float volume_max_step; // Longest step rays take through faint, flat parts of volumes, in voxels. 1 samples every voxel
+    float volume_refine_opacity; // Sample opacity (or change in it) that sends rays back to single voxel steps
+    float volume_alpha_cutoff; // Accumulated opacity at which rays stop
+    float volume_resolution; // Size of the volume pass relative to the window
+    bool volume_progressive; // Refine volumes over several frames while the view holds still, and stop marching them after
+    float volume_motion_step; // Shortest step rays take while the view is changing, in voxels
+    int volume_refine_frames; // Frames averaged into a still view of the volumes
+    bool cam_drift;
+    hmm_vec3 cam_pos;
+    sg_pipeline pip;
+    sg_bindings bind;
+    sg_pipeline mesh_pip;        // Meshes, with mesh_vertex_t and 16-bit indices
+    sg_pipeline mesh_pip_uint32; // and with 32-bit indices
+    sg_bindings mesh_bind;
+    sg_pipeline volume_pip;
+    // sg_image volume_img;
+    sg_bindings volume_bind; // Temp var which is used to process the volume currently getting rendered
+    sg_image empty_volume_img; // 1x1x1 stand-ins bound to the volume texture slots a volume doesn't use
+    sg_image empty_brick_table_img;
+    sg_image full_occupancy_img; // Single occupied macro cell, for volumes that can't skip anything
+    sg_pass_action pass_action;
+    bool key_down[256]; // keeps track of keypresses
+    bool show_debug_cubes; // Checkbox to show debug cube for each entity
+    double start_time_ticks;
+    double wall_time_ms;
+} state = {
+    .cam_fov = 60.0f,
+    .volume_max_step = 4.0f,
+    .volume_refine_opacity = 0.02f,
+    .volume_alpha_cutoff = 0.98f,
+    .volume_resolution = 0.5f,
+    .volume_progressive = true,
+    .volume_motion_step = 2.0f,
+    .volume_refine_frames = 16,
+    .cam_drift = false,
+    .show_debug_cubes = true,
+};
+
+fastObjMesh* mesh;
+
+// User code pointers
+void (*user_init_callback)();
+void (*user_frame_callback)();
+
+// Bake the transfer function's colormap, opacities and pre-integrated table again if it changed since the last time,
+// and reclassify the macro cells of every volume under it
+void update_transfer_table(void) {
+    if (!transfer.changed) {
+        return;
+    }
+    transfer.changed = false;
+    transfer.revision++;
+    transfer_function_bake(&transfer.function, transfer.colormap, COLORMAP_WIDTH);
+    volume_opacity_table(transfer.colormap, COLORMAP_WIDTH, transfer.opacity);
+    preintegrate_transfer_function(transfer.colormap, COLORMAP_WIDTH, transfer.table, TRANSFER_TABLE_SIZE, 0);
+    sg_update_image(transfer.table_img, &(sg_image_data){ .subimage[0][0] = SG_RANGE(transfer.table) });
+    for (uint32_t i = 0; i < ecs.volumes.count; i++) {
+        volume_c_t* volume = (volume_c_t*)component_at(&ecs.volumes, i);
+        if (!volume->bricks) {
+            volume_classify(volume);
+        }
+    }
+}
+
+// Transfer function editor state
+#define HISTOGRAM_VOXELS_PER_FRAME (4 << 20)
+
+static struct {
+    entity_t volume;             // Entity whose volume's histogram is shown
+    volume_histogram_t histogram;
+    const uint8_t* voxels;       // What the histogram was started on, it starts over when any of these change
+    uint32_t revision;
+    float window, level;
+    float bins[HISTOGRAM_BINS];  // Log scaled counts, for plotting
+} tf_editor;
+
+// Keep counting the histogram of the editor's volume, starting over if the volume or its window changed
+static void update_tf_histogram(void) {
+    volume_c_t* volume = get_volume(tf_editor.volume);
+    if (volume == NULL || volume->bricks || volume->_volume == NULL) {
+        tf_editor.voxels = NULL;
+        memset(tf_editor.bins, 0, sizeof(tf_editor.bins));
+        return;
+    }
+    if (tf_editor.voxels != volume->_volume || tf_editor.revision != volume->revision ||
+        tf_editor.window != volume->window || tf_editor.level != volume->level) {
+        tf_editor.voxels = volume->_volume;
+        tf_editor.revision = volume->revision;
+        tf_editor.window = volume->window;
+        tf_editor.level = volume->level;
+        volume_histogram_begin(&tf_editor.histogram, volume_voxel_count(volume), volume->level - volume->window * 0.5f, volume->level + volume->window * 0.5f);
+    }
+    if (tf_editor.histogram.done == tf_editor.histogram.total) {
+        return;
+    }
+    volume_histogram_step(&tf_editor.histogram, volume->_volume, volume->type, HISTOGRAM_VOXELS_PER_FRAME);
+    uint32_t bins[HISTOGRAM_BINS];
+    volume_histogram_bins(&tf_editor.histogram, bins);
+    for (int b = 0; b < HISTOGRAM_BINS; b++) {
+        tf_editor.bins[b] = log10f(1.0f + bins[b]);
+    }
+}
+
+// Window with the histogram of a volume under the transfer function, and its points to edit
+static void transfer_function_editor(void) {
+    igSetNextWindowPos((ImVec2){620, 10}, ImGuiCond_Once, (ImVec2){0,0});
+    igSetNextWindowSize((ImVec2){420, 420}, ImGuiCond_Once);
+    igBegin("Transfer Function", 0, ImGuiWindowFlags_None);
+
+    // Volumes are picked by their place in the volume set, which moves when others are removed
+    if (get_volume(tf_editor.volume) == NULL) {
+        for (uint32_t i = 0; i < ecs.volumes.count; i++) {
+            if (!((volume_c_t*)component_at(&ecs.volumes, i))->bricks) {
+                tf_editor.volume = ecs.volumes.entities[i];
+                break;
+            }
+        }
+    }
+    int shown = get_volume(tf_editor.volume) ? (int)ecs.volumes.sparse[entity_slot(tf_editor.volume)] - 1 : 0;
+    if (igSliderInt("Histogram Volume", &shown, 0, HMM_MAX((int)ecs.volumes.count - 1, 0), "%d", 0) && shown < (int)ecs.volumes.count) {
+        tf_editor.volume = ecs.volumes.entities[shown];
+    }
+    update_tf_histogram();
+    float peak = 0.0f;
+    for (int b = 0; b < HISTOGRAM_BINS; b++) {
+        peak = HMM_MAX(peak, tf_editor.bins[b]);
     }
+    char overlay[64] = "";
+    if (tf_editor.voxels && tf_editor.histogram.done < tf_editor.histogram.total) {
+        snprintf(overlay, sizeof(overlay), "counting %.0f%%", 100.0 * tf_editor.histogram.done / tf_editor.histogram.total);
+    }
+    igPlotHistogram_FloatPtr("##histogram", tf_editor.bins, HISTOGRAM_BINS, 0, overlay, 0.0f, peak, (ImVec2){0, 80}, sizeof(float));
+
+    // What's being drawn, from the baked colormap
+    float opacity[COLORMAP_WIDTH];
+    for (int x = 0; x < COLORMAP_WIDTH; x++) {
+        opacity[x] = transfer.colormap[x * 4 + 3] / 255.0f;
+    }
+    igPlotLines_FloatPtr("##opacity", opacity, COLORMAP_WIDTH, 0, "opacity", 0.0f, 1.0f, (ImVec2){0, 60}, sizeof(float));
+
+    // Points are edited in a copy, which only replaces the transfer function (and gets baked) if something changed
+    transfer_function_t function = transfer.function;
+    bool changed = false;
+    int removed = -1;
+    for (int p = 0; p < function.point_count; p++) {
+        transfer_point_t* point = &function.points[p];
+        igPushID_Int(p);
+        changed |= igColorEdit3("##color", point->color, ImGuiColorEditFlags_NoInputs);
+        igSameLine(0.0f, -1.0f);
+        changed |= igSliderFloat("##value", &point->value, 0.0f, 1.0f, "value %.3f", 0);
+        igSameLine(0.0f, -1.0f);
+        changed |= igSliderFloat("##opacity", &point->opacity, 0.0f, 1.0f, "opacity %.3f", 0);
+        if (function.point_count > 1) {
+            igSameLine(0.0f, -1.0f);
+            if (igButton("Remove", (ImVec2){0, 0})) {
+                removed = p;
+            }
+        }
+        igPopID();
+    }
+    if (removed >= 0) {
+        function.points[removed] = function.points[--function.point_count];
+        changed = true;
+    }
+    if (function.point_count < TRANSFER_MAX_POINTS && igButton("Add Point", (ImVec2){0, 0})) {
+        // In the middle of the widest gap between points, looking like the function already does there
+        float values[TRANSFER_MAX_POINTS + 2] = { 0.0f, 1.0f };
+        for (int p = 0; p < function.point_count; p++) {
+            values[p + 2] = function.points[p].value;
+        }
+        qsort(values, function.point_count + 2, sizeof(float), compare_floats);
+        float value = 0.5f, widest = -1.0f;
+        for (int p = 0; p + 1 < function.point_count + 2; p++) {
+            if (values[p + 1] - values[p] > widest) {
+                widest = values[p + 1] - values[p];
+                value = (values[p] + values[p + 1]) * 0.5f;
+            }
+        }
+        const uint8_t* texel = &transfer.colormap[(int)(value * (COLORMAP_WIDTH - 1) + 0.5f) * 4];
+        function.points[function.point_count++] = (transfer_point_t){
+            .value = value,
+            .color = { texel[0] / 255.0f, texel[1] / 255.0f, texel[2] / 255.0f },
+            .opacity = texel[3] / 255.0f
+        };
+        changed = true;
+    }
+    if (changed) {
+        set_transfer_function(&function);
+    }
+    igEnd();
+}
+
+// Progressive volume rendering
+// Volumes are marched into an offscreen frame, with rays stopping at the meshes in scene_distance, which is added
+// into an accumulation target and averaged over the swapchain. While anything volumes show is changing, rays take
+// coarser steps. Once the view holds still, every frame shifts its steps a little further along the rays and adds to
+// the average, until state.volume_refine_frames are in and volumes aren't marched again until something changes.
+// The volume targets can be a fraction of the swapchain's size. Compositing scales them back up guided by the
+// distance to the meshes at full size, so volumes stay sharp against mesh edges
+#define VOLUME_REFINE_MAX_FRAMES 64
+#define SCENE_DISTANCE_FAR 1000.0f // Distance where no mesh was drawn, the camera's far plane
+
+static struct {
+    int width, height;         // Size of the swapchain
+    int scaled_width, scaled_height; // Size of the volume targets
+    float scale;               // What they were sized with, state.volume_resolution
+    sg_image scene_distance;   // R32F, full size: distance from the eye to the nearest mesh
+    sg_image scene_depth;
+    sg_attachments scene_pass;
+    sg_image color;            // RGBA16F, one frame of volumes with premultiplied alpha
+    sg_attachments pass;
+    sg_image accum;            // RGBA16F, sum of the frames since the view last changed
+    sg_attachments accum_pass;
+    sg_pipeline distance_pip;  // Debug cubes into scene_distance
+    sg_pipeline distance_mesh_pip; // Meshes into scene_distance, with 16 and 32-bit indices
+    sg_pipeline distance_mesh_pip_uint32;
+    sg_pipeline accum_pip;     // Adds color onto accum
+    sg_pipeline composite_pip; // Averages accum (or color) over the swapchain
+    sg_sampler smp;
+    uint64_t scene_hash;       // Everything the frames in accum were drawn from
+    bool coarse;               // accum holds a frame drawn while the view was changing
+    int frames;                // Frames summed in accum
+} volume_target;
+
+// FNV-1a, to fold whatever the volumes were drawn from into one value to compare against the next frame
+static uint64_t hash_bytes(uint64_t hash, const void* data, size_t size) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * 0x100000001b3ull;
+    }
+    return hash;
+}
+
+// Van der Corput sequence: 0, 1/2, 1/4, 3/4, ... Each prefix spreads its points evenly over [0, 1)
+float radical_inverse(uint32_t i) {
+    i = (i << 16) | (i >> 16);
+    i = ((i & 0x55555555u) << 1) | ((i & 0xAAAAAAAAu) >> 1);
+    i = ((i & 0x33333333u) << 2) | ((i & 0xCCCCCCCCu) >> 2);
+    i = ((i & 0x0F0F0F0Fu) << 4) | ((i & 0xF0F0F0F0u) >> 4);
+    i = ((i & 0x00FF00FFu) << 8) | ((i & 0xFF00FF00u) >> 8);
+    return (float)i * 2.3283064365386963e-10f; // 2^-32
+}
+
+// Hash of everything that shows up in the volume pass: the camera, the meshes hiding volumes, the volumes themselves
+// and how they're drawn. Run after the transforms are updated for the frame
+static uint64_t volume_scene_hash(hmm_mat4 view_proj) {
+    uint64_t hash = 0xcbf29ce484222325ull;
+    hash = hash_bytes(hash, &view_proj, sizeof(view_proj));
+    hash = hash_bytes(hash, &volume_target.width, sizeof(volume_target.width));
+    hash = hash_bytes(hash, &volume_target.height, sizeof(volume_target.height));
+    hash = hash_bytes(hash, &volume_target.scaled_width, sizeof(volume_target.scaled_width));
+    hash = hash_bytes(hash, &volume_target.scaled_height, sizeof(volume_target.scaled_height));
+    hash = hash_bytes(hash, &state.lod_bias, sizeof(state.lod_bias));
+    hash = hash_bytes(hash, &state.volume_max_step, sizeof(state.volume_max_step));
+    hash = hash_bytes(hash, &state.volume_refine_opacity, sizeof(state.volume_refine_opacity));
+    hash = hash_bytes(hash, &state.volume_alpha_cutoff, sizeof(state.volume_alpha_cutoff));
+    hash = hash_bytes(hash, &state.show_debug_cubes, sizeof(state.show_debug_cubes));
+    hash = hash_bytes(hash, &state.volume_progressive, sizeof(state.volume_progressive));
+    // The average is laid out for a frame count, whether it's composited from color or accum depends on it
+    hash = hash_bytes(hash, &state.volume_refine_frames, sizeof(state.volume_refine_frames));
+    hash = hash_bytes(hash, &transfer.revision, sizeof(transfer.revision));
+    // Covers entities, components, transforms and meshes, so static scenes don't have to be walked
+    hash = hash_bytes(hash, &ecs.revision, sizeof(ecs.revision));
+    for (uint32_t i = 0; i < ecs.volumes.count; i++) {
+        const volume_c_t* volume = (const volume_c_t*)component_at(&ecs.volumes, i);
+        // Bricked volumes change whenever bricks get paged in, the rest with every edit or new image
+        const int loads = volume->bricks ? volume->bricks->loads_last_frame : 0;
+        hash = hash_bytes(hash, &volume->revision, sizeof(volume->revision));
+        hash = hash_bytes(hash, &volume->img.id, sizeof(volume->img.id));
+        hash = hash_bytes(hash, &volume->occupancy_img.id, sizeof(volume->occupancy_img.id));
+        hash = hash_bytes(hash, &volume->bricks, sizeof(volume->bricks));
+        hash = hash_bytes(hash, &loads, sizeof(loads));
+        hash = hash_bytes(hash, &volume->width, sizeof(int) * 3);
+        hash = hash_bytes(hash, &volume->spacing, sizeof(volume->spacing));
+        hash = hash_bytes(hash, &volume->window, sizeof(volume->window));
+        hash = hash_bytes(hash, &volume->level, sizeof(volume->level));
+        hash = hash_bytes(hash, &volume->mip_reduce, sizeof(volume->mip_reduce));
+    }
+    return hash;
+}
 
-    update_volume(index, volume_data);
+// (Re)create the targets if the swapchain or the scale changed since they were made
+static void volume_target_resize(int width, int height, float scale) {
+    scale = HMM_Clamp(0.1f, scale, 1.0f);
+    if (volume_target.width == width && volume_target.height == height && volume_target.scale == scale) {
+        return;
+    }
+    sg_destroy_attachments(volume_target.scene_pass);
+    sg_destroy_attachments(volume_target.pass);
+    sg_destroy_attachments(volume_target.accum_pass);
+    sg_destroy_image(volume_target.scene_distance);
+    sg_destroy_image(volume_target.scene_depth);
+    sg_destroy_image(volume_target.color);
+    sg_destroy_image(volume_target.accum);
+    volume_target.width = width;
+    volume_target.height = height;
+    volume_target.scale = scale;
+    volume_target.scaled_width = HMM_MAX((int)(width * scale + 0.5f), 1);
+    volume_target.scaled_height = HMM_MAX((int)(height * scale + 0.5f), 1);
+    volume_target.frames = 0;
+
+    volume_target.scene_distance = sg_make_image(&(sg_image_desc){
+        .render_target = true,
+        .width = width,
+        .height = height,
+        .pixel_format = SG_PIXELFORMAT_R32F,
+        .sample_count = 1,
+        .label = "scene-distance"
+    });
+    volume_target.scene_depth = sg_make_image(&(sg_image_desc){
+        .render_target = true,
+        .width = width,
+        .height = height,
+        .pixel_format = SG_PIXELFORMAT_DEPTH,
+        .sample_count = 1,
+        .label = "scene-depth"
+    });
+    volume_target.scene_pass = sg_make_attachments(&(sg_attachments_desc){
+        .colors[0].image = volume_target.scene_distance,
+        .depth_stencil.image = volume_target.scene_depth,
+        .label = "scene-distance-pass"
+    });
+
+    sg_image_desc color_desc = {
+        .render_target = true,
+        .width = volume_target.scaled_width,
+        .height = volume_target.scaled_height,
+        .pixel_format = SG_PIXELFORMAT_RGBA16F,
+        .sample_count = 1,
+        .label = "volume-color"
+    };
+    volume_target.color = sg_make_image(&color_desc);
+    color_desc.label = "volume-accum";
+    volume_target.accum = sg_make_image(&color_desc);
+    volume_target.pass = sg_make_attachments(&(sg_attachments_desc){
+        .colors[0].image = volume_target.color,
+        .label = "volume-pass"
+    });
+    volume_target.accum_pass = sg_make_attachments(&(sg_attachments_desc){
+        .colors[0].image = volume_target.accum,
+        .label = "volume-accum-pass"
+    });
 }
 
-void sphere_volume(int index) {
-    // Prepare volume data
-    uint8_t volume_data[VOLUME_DIMENSIONS * VOLUME_DIMENSIONS * VOLUME_DIMENSIONS] = {0};
-
-    // Sphere parameters
-    int center = VOLUME_DIMENSIONS / 2; // Center of the sphere
-    int radius = VOLUME_DIMENSIONS / 2; // Radius of the sphere
-
-    for (int z = 0; z < VOLUME_DIMENSIONS; z++) {
-        for (int y = 0; y < VOLUME_DIMENSIONS; y++) {
-            for (int x = 0; x < VOLUME_DIMENSIONS; x++) {
-                int dx = x - center;
-                int dy = y - center;
-                int dz = z - center;
-                if (dx * dx + dy * dy + dz * dz <= radius * radius) {
-                    int index = z * VOLUME_DIMENSIONS * VOLUME_DIMENSIONS + y * VOLUME_DIMENSIONS + x;
-                    volume_data[index] = rand() % 256;
-                }
-            }
-        }
+// Vertex uniforms for drawing a transform with the cube shader, or with the distance shader into scene_distance, from
+// the matrices update_transforms cached. Quantized meshes pass their dequantize matrix, which goes in ahead of the model
+static void apply_mesh_uniforms(uint32_t transform, const hmm_mat4* dequantize, bool distance) {
+    hmm_mat4 mvp = transform_mvps()[transform];
+    if (dequantize) {
+        mvp = HMM_MultiplyMat4(mvp, *dequantize);
+    }
+    if (distance) {
+        const hmm_mat4 model = transform_worlds()[transform];
+        vs_distance_params_t vs_distance_params = {
+            .mvp = mvp,
+            .model = dequantize ? HMM_MultiplyMat4(model, *dequantize) : model,
+            .eye_pos = { state.cam_pos.X, state.cam_pos.Y, state.cam_pos.Z }
+        };
+        sg_apply_uniforms(SG_SHADERSTAGE_VS, SLOT_vs_distance_params, &SG_RANGE(vs_distance_params));
+    } else {
+        vs_params_t vs_params;
+        vs_params.mvp = mvp;
+        sg_apply_uniforms(SG_SHADERSTAGE_VS, SLOT_vs_params, &SG_RANGE(vs_params));
     }
-
-    update_volume(index, volume_data);
 }
 
-void cube_volume(int index) {
-    // Prepare volume data
-    uint8_t volume_data[VOLUME_DIMENSIONS * VOLUME_DIMENSIONS * VOLUME_DIMENSIONS] = {0};
+// Draw the debug cubes with cube_pip, which takes float positions and colors, and the meshes with mesh_pip, which
+// takes mesh_vertex_t, or its mesh_pip_uint32 variant for meshes with 32-bit indices
+static void draw_meshes(sg_pipeline cube_pip, sg_pipeline mesh_pip, sg_pipeline mesh_pip_uint32, bool distance) {
+    // Optional per-entity rendering of a cube mesh at the transform for debugging
+    if (state.show_debug_cubes) {
+        sg_apply_pipeline(cube_pip);
+        sg_apply_bindings(&state.bind);
+        for (uint32_t i = 0; i < ecs.transforms.count; i++) {
+            apply_mesh_uniforms(i, NULL, distance);
+            sg_draw(0, 36, 1);
+        }
+    }
 
-    for (int z = 0; z < VOLUME_DIMENSIONS; z++) {
-        for (int y = 0; y < VOLUME_DIMENSIONS; y++) {
-            for (int x = 0; x < VOLUME_DIMENSIONS; x++) {
-                // Check if the point is on an edge of the cube
-                if ((x == 0 || x == VOLUME_DIMENSIONS - 1) || (y == 0 || y == VOLUME_DIMENSIONS - 1) || (z == 0 || z == VOLUME_DIMENSIONS - 1)) {
-                    // Exclude the points that are not on the wireframe (i.e., the ones that are in the faces but not on the edges)
-                    if ((x == 0 || x == VOLUME_DIMENSIONS - 1) + (y == 0 || y == VOLUME_DIMENSIONS - 1) + (z == 0 || z == VOLUME_DIMENSIONS - 1) > 1) {
-                        int index = z * VOLUME_DIMENSIONS * VOLUME_DIMENSIONS + y * VOLUME_DIMENSIONS + x;
-                        volume_data[index] = 255;
-                    }
-                }
+    // Render each mesh that has a transform, the 16-bit ones first so the pipeline changes at most once
+    for (int wide = 0; wide < 2; wide++) {
+        bool applied = false;
+        for (uint32_t i = 0; i < ecs.meshes.count; i++) {
+            const mesh_c_t* mesh = (const mesh_c_t*)component_at(&ecs.meshes, i);
+            const uint32_t transform = component_find(&ecs.transforms, ecs.meshes.entities[i]);
+            if (transform == UINT32_MAX || (mesh->index_type == SG_INDEXTYPE_UINT32) != wide) {
+                continue;
             }
+            if (!applied) {
+                sg_apply_pipeline(wide ? mesh_pip_uint32 : mesh_pip);
+                applied = true;
+            }
+            sg_apply_bindings(&mesh->binding);
+            apply_mesh_uniforms(transform, &mesh->dequantize, distance);
+            sg_draw(0, mesh->face_count * 3, 1);
         }
     }
-
-    update_volume(index, volume_data);
 }
 
+// Volume render queue
+// Volumes in view, drawn back to front so overlapping ones blend in the right order. The pipeline and everything
+// shared between volumes is bound once, and only the textures that differ from the volume before are bound again
+typedef struct {
+    volume_c_t* volume;
+    hmm_vec3 position; // Of its entity's transform
+    float distance;    // From the eye to the middle of its box
+} volume_draw_t;
 
-// Global state
-static struct {
-    ImFont* default_font;
-    ImFont* main_font;
-    bool show_imgui_demo;
-} gui;
+typedef struct {
+    int draws;
+    int culled;     // Outside the view
+    int pipelines;  // sg_apply_pipeline calls
+    int bindings;   // sg_apply_bindings calls
+    int uniforms;   // sg_apply_uniforms calls
+} render_stats_t;
 
 static struct {
-    float cam_rx, cam_ry; // Latlong-esque camera rotations
-    float cam_fov;
-    bool cam_drift;
-    hmm_vec3 cam_pos;
-    sg_pipeline pip;
-    sg_bindings bind;
-    sg_pipeline mesh_pip;
-    sg_bindings mesh_bind;
-    sg_pipeline volume_pip;
-    // sg_image volume_img;
-    sg_bindings volume_bind; // Temp var which is used to process the volume currently getting rendered
-    sg_pass_action pass_action;
-    bool key_down[256]; // keeps track of keypresses
-    bool show_debug_cubes; // Checkbox to show debug cube for each entity
-    double start_time_ticks;
-    double wall_time_ms;
-} state = {
-    .cam_fov = 60.0f,
-    .cam_drift = false,
-    .show_debug_cubes = true,
-};
-
-fastObjMesh* mesh;
-
-// User code pointers
-void (*user_init_callback)();
-void (*user_frame_callback)();
+    volume_draw_t* draws; // Only valid until volumes are added or removed, the queue is rebuilt every pass
+    int count;
+    int capacity;
+    render_stats_t stats; // Of the last volume pass
+} volume_queue;
+
+int compare_volume_draws(const void* a, const void* b) {
+    float da = ((const volume_draw_t*)a)->distance;
+    float db = ((const volume_draw_t*)b)->distance;
+    return (da < db) - (da > db); // Furthest first
+}
 
-// Temp code to generate a colormap
-#define COLORMAP_WIDTH 260
-#define COLORMAP_HEIGHT 1
+// Collect the volumes in view and sort them back to front
+void build_volume_queue(hmm_mat4 view_proj, hmm_vec3 eye) {
+    hmm_vec4 planes[6];
+    frustum_planes(view_proj, planes);
+    volume_queue.count = 0;
+    volume_queue.stats = (render_stats_t){ 0 };
+    if ((int)ecs.volumes.count > volume_queue.capacity) {
+        void* draws = realloc(volume_queue.draws, ecs.volumes.count * sizeof(volume_draw_t));
+        if (!draws) {
+            printf("Failed to allocate memory for %u volume draws!\n", ecs.volumes.count);
+            return;
+        }
+        volume_queue.draws = (volume_draw_t*)draws;
+        volume_queue.capacity = (int)ecs.volumes.count;
+    }
+    for (uint32_t i = 0; i < ecs.volumes.count; i++) {
+        volume_c_t* volume = (volume_c_t*)component_at(&ecs.volumes, i);
+        const uint32_t transform = component_find(&ecs.transforms, ecs.volumes.entities[i]);
+        if (transform == UINT32_MAX) {
+            continue;
+        }
+        if (volume->_volume == NULL && volume->bricks == NULL) { // TODO make this a better null check
+            printf("VOLUME DATA FROM ENTITY %u UNALLOCATED!\n", ecs.volumes.entities[i].id);
+            continue;
+        }
+        // The box spans position to position + extent, see vs_volume
+        hmm_vec3 box_min = transform_world_position_at(transform);
+        hmm_vec3 box_max = HMM_AddVec3(box_min, volume_extent(volume));
+        if (!aabb_in_frustum(planes, box_min, box_max)) {
+            volume_queue.stats.culled++;
+            continue;
+        }
+        hmm_vec3 center = HMM_MultiplyVec3f(HMM_AddVec3(box_min, box_max), 0.5f);
+        volume_queue.draws[volume_queue.count++] = (volume_draw_t){
+            .volume = volume,
+            .position = box_min,
+            .distance = HMM_LengthVec3(HMM_SubtractVec3(center, eye)),
+        };
+    }
+    qsort(volume_queue.draws, volume_queue.count, sizeof(volume_draw_t), compare_volume_draws);
+}
 
-uint8_t colormap_data[COLORMAP_WIDTH * 4]; // 4 channels (RGBA) per pixel
-sg_image colormap_img;
+// Draw the queued volumes into the volume pass, which has to be begun already
+void draw_volume_queue(hmm_mat4 view_proj, float pixel_angle, float min_step, float max_step) {
+    if (volume_queue.count == 0) {
+        return;
+    }
+    render_stats_t* stats = &volume_queue.stats;
+    sg_apply_pipeline(state.volume_pip);
+    stats->pipelines++;
+
+    // Everything but the volume's own textures is the same for every volume
+    sg_bindings bind = {
+        .vertex_buffers[0] = state.volume_bind.vertex_buffers[0],
+        .index_buffer = state.volume_bind.index_buffer,
+    };
+    bind.fs.images[SLOT_transfer_table] = transfer.table_img;
+    bind.fs.images[SLOT_scene_distance] = volume_target.scene_distance;
+    bind.fs.samplers[SLOT_volume_smp] = state.volume_bind.fs.samplers[SLOT_volume_smp];
+    bind.fs.samplers[SLOT_transfer_smp] = state.volume_bind.fs.samplers[SLOT_transfer_smp];
+    bind.fs.samplers[SLOT_scene_smp] = volume_target.smp;
+    bool bound = false;
+
+    for (int d = 0; d < volume_queue.count; d++) {
+        volume_c_t* volume = volume_queue.draws[d].volume;
+        const hmm_vec3 position = volume_queue.draws[d].position;
+        bricked_volume_t* bricks = volume->bricks;
+        bool has_cells = !bricks && volume->occupancy_img.id != SG_INVALID_ID;
+        sg_image volume_img = bricks ? state.empty_volume_img : volume->img;
+        sg_image brick_table = bricks ? bricks->page_table : state.empty_brick_table_img;
+        sg_image brick_atlas = bricks ? bricks->atlas : state.empty_volume_img;
+        sg_image occupancy = has_cells ? volume->occupancy_img : state.full_occupancy_img;
+        if (!bound || bind.fs.images[SLOT_volume].id != volume_img.id || bind.fs.images[SLOT_brick_table].id != brick_table.id ||
+            bind.fs.images[SLOT_brick_atlas].id != brick_atlas.id || bind.fs.images[SLOT_occupancy].id != occupancy.id) {
+            bind.fs.images[SLOT_volume] = volume_img;
+            bind.fs.images[SLOT_brick_table] = brick_table;
+            bind.fs.images[SLOT_brick_atlas] = brick_atlas;
+            bind.fs.images[SLOT_occupancy] = occupancy;
+            sg_apply_bindings(&bind);
+            stats->bindings++;
+            bound = true;
+        }
 
-void create_colormap(void) {
-    for (int i = 0; i < COLORMAP_WIDTH; ++i) {
-        float t = (float)i / (COLORMAP_WIDTH - 1);
-        colormap_data[i * 4 + 0] = (uint8_t)((1.0f - t) * 255); // Blue channel
-        colormap_data[i * 4 + 1] = 0;                           // Green channel
-        colormap_data[i * 4 + 2] = (uint8_t)(t * 255);          // Red channel
-        colormap_data[i * 4 + 3] = (uint8_t)((1.0f - t) * 255);                         // Alpha channel
-        // printf("COLORMAP %d %d %d %d\n", colormap_data[i * 4 + 0], colormap_data[i * 4 + 1], colormap_data[i * 4 + 2], colormap_data[i * 4 + 3]);
+        // Step size and bounding box both follow from the volume's own dimensions and voxel spacing
+        hmm_vec3 extent = volume_extent(volume);
+
+        // The shader samples stored values divided by unit, map the window onto 0..1 from there. Bricks are 8-bit
+        float unit = bricks ? 255.0f : volume_type_unit(volume->type);
+        float window = volume->window > 0.0f ? volume->window : unit;
+        float level = volume->window > 0.0f ? volume->level : unit * 0.5f;
+        fs_vol_params_t fs_vol_params = {
+            .volume_dims = { volume->width, volume->height, volume->depth },
+            .bricked = bricks != NULL,
+            .brick_size = BRICK_SIZE,
+            .new_box_min = { 0.0f, 0.0f, 0.0f },
+            .new_box_max = { 1.0f, 1.0f, 1.0f },
+            .lod_scale = volume_lod_scale(volume, pixel_angle),
+            .volume_extent = { extent.X, extent.Y, extent.Z },
+            .max_lod = bricks ? 0.0f : (float)(volume->mip_levels - 1), // Bricks pick their level on the CPU
+            .cell_dims = {
+                has_cells ? volume->cells.cells_x : 1,
+                has_cells ? volume->cells.cells_y : 1,
+                has_cells ? volume->cells.cells_z : 1
+            },
+            .cell_size = MACRO_CELL_SIZE,
+            .value_scale = unit / window,
+            .value_offset = 0.5f - level / window,
+            .march = { min_step, max_step, state.volume_refine_opacity, state.volume_alpha_cutoff },
+            .jitter = radical_inverse((uint32_t)volume_target.frames), // 0 for the first frame, as if not refining
+            .scene_scale = {
+                (float)volume_target.width / (float)volume_target.scaled_width,
+                (float)volume_target.height / (float)volume_target.scaled_height
+            },
+            .scene_size = { volume_target.width, volume_target.height }
+        };
+        sg_apply_uniforms(SG_SHADERSTAGE_FS, SLOT_fs_vol_params, &SG_RANGE(fs_vol_params));
+
+        vs_vol_params_t vs_vol_params = {
+            .proj_view = view_proj,
+            .eye_pos = { state.cam_pos.X, state.cam_pos.Y, state.cam_pos.Z },
+            .volume_scale = { extent.X, extent.Y, extent.Z },
+            .volume_translation = { position.X, position.Y, position.Z }
+        };
+        sg_apply_uniforms(SG_SHADERSTAGE_VS, SLOT_vs_vol_params, &SG_RANGE(vs_vol_params));
+        stats->uniforms += 2;
+
+        sg_draw(0, 36, 1); // The box's 12 triangles
+        stats->draws++;
     }
 }
-// End temp code
 
 // Function to get the directory from __FILE__
 void get_dir_from_file(const char *file_path, char *dir_path, size_t size) {
@@ -256,151 +4608,527 @@ void get_dir_from_file(const char *file_path, char *dir_path, size_t size) {
 }
 
 void cleanup_ecs(void);
-void update_mesh(int index, float* vertices, unsigned vertices_size, uint16_t* indices, unsigned indices_size, unsigned face_count);
-
+void update_mesh(entity_t entity, float* vertices, unsigned vertices_size, const uint32_t* indices, unsigned indices_size, unsigned face_count);
 
-void cleanup_ecs(void) {
-    for (int i = 0; i < NUM_COMPONENTS; i++) {
-        if (ecs.mesh_valid[i]) {
-            free(ecs.meshes[i]._vertices);
-            free(ecs.meshes[i]._indices);
-        }
-    }
-    free(ecs.mesh_valid);
-    free(ecs.meshes);
+// Mesh indices
+// Meshes keep their indices as narrow as their vertex count allows, and each width is drawn with its own pipeline.
+// 0xFFFF is left out of 16-bit indices, since Metal always takes it as a primitive restart
+static inline sg_index_type mesh_index_type(unsigned vertex_count) {
+    return vertex_count <= UINT16_MAX ? SG_INDEXTYPE_UINT16 : SG_INDEXTYPE_UINT32;
 }
 
-void update_mesh(int index, float* positions, unsigned position_count, uint16_t* indices, unsigned indices_size, unsigned face_count) {
-    // ecs.mesh_valid[index] = true;
-    mesh_c_t* mesh = &ecs.meshes[index];
+static inline size_t mesh_index_size(const mesh_c_t* mesh) {
+    return mesh->index_type == SG_INDEXTYPE_UINT32 ? sizeof(uint32_t) : sizeof(uint16_t);
+}
 
-    // Free existing data if any
-    if (mesh->_vertices) free(mesh->_vertices);
-    if (mesh->_indices) free(mesh->_indices);
+// Allocate count indices into a mesh of vertex_count vertices, at the width that needs. False if there's no memory
+static bool mesh_alloc_indices(mesh_c_t* mesh, unsigned vertex_count, unsigned count) {
+    mesh->index_type = mesh_index_type(vertex_count);
+    mesh->_indices_size = count;
+    mesh->_indices = malloc((size_t)count * mesh_index_size(mesh));
+    return mesh->_indices != NULL;
+}
 
-    // Calculate new sizes
-    unsigned vertices_size = position_count * 7; // 3 for position, 4 for color
-    mesh->_vertices_size = vertices_size;
-    mesh->_indices_size = indices_size;
-    mesh->face_count = face_count;
+static inline uint32_t mesh_get_index(const mesh_c_t* mesh, unsigned i) {
+    return mesh->index_type == SG_INDEXTYPE_UINT32 ? ((const uint32_t*)mesh->_indices)[i] : ((const uint16_t*)mesh->_indices)[i];
+}
 
-    // Allocate new memory
-    mesh->_vertices = (float*)malloc(vertices_size * sizeof(float));
-    mesh->_indices = (uint16_t*)malloc(indices_size * sizeof(uint16_t));
+static inline void mesh_set_index(mesh_c_t* mesh, unsigned i, uint32_t value) {
+    if (mesh->index_type == SG_INDEXTYPE_UINT32) {
+        ((uint32_t*)mesh->_indices)[i] = value;
+    } else {
+        ((uint16_t*)mesh->_indices)[i] = (uint16_t)value;
+    }
+}
 
-    if (!mesh->_vertices || !mesh->_indices) {
-        // Handle memory allocation failure
-        if (mesh->_vertices) free(mesh->_vertices);
-        if (mesh->_indices) free(mesh->_indices);
-        mesh->_vertices = NULL;
-        mesh->_indices = NULL;
-        ecs.mesh_valid[index] = false;
-        return;
+// Release the vertices and indices of a mesh, whether they were allocated or mapped from a cache file
+static void mesh_free_data(mesh_c_t* mesh) {
+    if (mesh->_mapped) {
+        munmap(mesh->_mapped, mesh->_mapped_size);
+    } else {
+        free(mesh->_vertices);
+        free(mesh->_indices);
     }
+    mesh->_vertices = NULL;
+    mesh->_indices = NULL;
+    mesh->_mapped = NULL;
+    mesh->_mapped_size = 0;
+}
 
-    // Copy and format vertex data
-    float red_rgba[] = { 1.0f, 0.0f, 0.0f, 1.0f };
-    for (unsigned i = 0; i < position_count; i++) {
-        unsigned dest_pos = i * 7;
-        unsigned src_pos = i * 3;
-        
-        // Copy position (XYZ)
-        mesh->_vertices[dest_pos] = positions[src_pos];
-        mesh->_vertices[dest_pos + 1] = positions[src_pos + 1];
-        mesh->_vertices[dest_pos + 2] = positions[src_pos + 2];
-        
-        // Copy color (RGBA)
-        memcpy(&mesh->_vertices[dest_pos + 3], red_rgba, 4 * sizeof(float));
+// Allocate count vertices for a mesh and quantize their positions into them over the bounds they span, all in one
+// color. Vertex i takes the three floats at positions[source[i * source_stride] * 3], or at positions[i * 3] without
+// a source. False if there's no memory
+static bool mesh_quantize(mesh_c_t* mesh, const float* positions, unsigned count, const uint32_t* source, size_t source_stride, const float rgba[4]) {
+    mesh->_vertex_count = count;
+    mesh->_vertices = (mesh_vertex_t*)malloc(((size_t)count + 1) * sizeof(mesh_vertex_t));
+    if (!mesh->_vertices) {
+        return false;
+    }
+    hmm_vec3 low = HMM_Vec3(FLT_MAX, FLT_MAX, FLT_MAX), high = HMM_Vec3(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+    for (unsigned i = 0; i < count; i++) {
+        const float* p = &positions[(source ? source[i * source_stride] : i) * 3];
+        for (int c = 0; c < 3; c++) {
+            low.Elements[c] = fminf(low.Elements[c], p[c]);
+            high.Elements[c] = fmaxf(high.Elements[c], p[c]);
+        }
     }
+    hmm_vec3 center = HMM_Vec3(0.0f, 0.0f, 0.0f), half = HMM_Vec3(1.0f, 1.0f, 1.0f);
+    for (int c = 0; count > 0 && c < 3; c++) {
+        center.Elements[c] = (low.Elements[c] + high.Elements[c]) * 0.5f;
+        half.Elements[c] = high.Elements[c] > low.Elements[c] ? (high.Elements[c] - low.Elements[c]) * 0.5f : 1.0f;
+    }
+    mesh->dequantize = HMM_MultiplyMat4(HMM_Translate(center), HMM_Scale(half));
 
-    // Copy index data
-    memcpy(mesh->_indices, indices, indices_size * sizeof(uint16_t));
+    mesh_vertex_t vertex = { .position[3] = INT16_MAX };
+    for (int c = 0; c < 4; c++) {
+        vertex.color[c] = (uint8_t)(HMM_Clamp(0.0f, rgba[c], 1.0f) * 255.0f + 0.5f);
+    }
+    for (unsigned i = 0; i < count; i++) {
+        const float* p = &positions[(source ? source[i * source_stride] : i) * 3];
+        for (int c = 0; c < 3; c++) {
+            const float unit = HMM_Clamp(-1.0f, (p[c] - center.Elements[c]) / half.Elements[c], 1.0f);
+            vertex.position[c] = (int16_t)lrintf(unit * INT16_MAX);
+        }
+        mesh->_vertices[i] = vertex;
+    }
+    return true;
+}
 
-    // Update Sokol buffers
+// Give a mesh GPU buffers made from its vertices and indices
+static void mesh_upload(mesh_c_t* mesh) {
     mesh->vbuf = sg_make_buffer(&(sg_buffer_desc){
-        .data = (sg_range){ mesh->_vertices, vertices_size * sizeof(float) },
+        .data = (sg_range){ mesh->_vertices, mesh->_vertex_count * sizeof(mesh_vertex_t) },
         .label = "mesh-vertices"
     });
     mesh->ibuf = sg_make_buffer(&(sg_buffer_desc){
         .type = SG_BUFFERTYPE_INDEXBUFFER,
-        .data = (sg_range){ mesh->_indices, indices_size * sizeof(uint16_t) },
+        .data = (sg_range){ mesh->_indices, mesh->_indices_size * mesh_index_size(mesh) },
         .label = "mesh-indices"
     });
-
-    // Update bindings
     mesh->binding = (sg_bindings) {
         .vertex_buffers[0] = mesh->vbuf,
         .index_buffer = mesh->ibuf,
     };
 }
 
-void load_mesh(int index,const char* mesh_path, float r, float g, float b) {
-    printf("hi\n");
-    mesh = fast_obj_read(mesh_path);
-    int face_count = mesh->face_count;
-    printf("hih\n");
+// Free a mesh and its buffers and take it off its entity
+void free_mesh(entity_t entity) {
+    mesh_c_t* mesh = get_mesh(entity);
+    if (!mesh) {
+        return;
+    }
+    mesh_free_data(mesh);
+    sg_destroy_buffer(mesh->vbuf);
+    sg_destroy_buffer(mesh->ibuf);
+    component_remove(&ecs.meshes, entity);
+}
 
-    printf("MESHY LOAD LOAD");
-    
-    ecs.meshes[index]._indices_size = mesh->index_count;
-    ecs.meshes[index]._indices = (uint16_t*)malloc(ecs.meshes[index]._indices_size * sizeof(uint16_t));
-    if (!ecs.meshes[index]._indices) {
-        // Handle allocation failure
-        printf("Failed to allocate memory for mesh indices!");
+// Free everything an entity has and retire its handle. Its slot goes to a later entity with the next generation
+void destroy_entity(entity_t entity) {
+    if (!entity_alive(entity)) {
         return;
     }
-    for (int i = 0; i < mesh->index_count; i++) {
-        printf("= %d\n", mesh->indices[i].p);
-        ecs.meshes[index]._indices[i] = mesh->indices[i].p;
+    free_volume(entity);
+    free_mesh(entity);
+    remove_transform(entity);
+    const uint32_t slot = entity_slot(entity);
+    ecs.generations[slot] = (ecs.generations[slot] + 1) & ENTITY_GENERATION_MASK;
+    if (ecs.generations[slot] == 0) {
+        ecs.generations[slot] = 1;
+    }
+    ecs.alive[slot] = false;
+    ecs.free_slots[ecs.free_count++] = slot;
+    ecs.entity_count--;
+}
+
+// Destroy every entity and free the ECS's own storage, before sokol_gfx shuts down
+void cleanup_ecs(void) {
+    for (uint32_t slot = 0; slot < ecs.slot_count; slot++) {
+        if (ecs.alive[slot]) {
+            destroy_entity(entity_from_slot(slot));
+        }
+    }
+    component_set_free(&ecs.transforms);
+    component_set_free(&ecs.meshes);
+    component_set_free(&ecs.volumes);
+    free(ecs.generations);
+    free(ecs.alive);
+    free(ecs.free_slots);
+    free(ecs.dirty_transforms);
+    free(ecs.dirty_indices);
+    free(volume_queue.draws);
+    volume_queue.draws = NULL;
+    volume_queue.capacity = 0;
+    ecs.generations = ecs.free_slots = NULL;
+    ecs.alive = NULL;
+    ecs.free_count = ecs.slot_count = ecs.capacity = ecs.entity_count = 0;
+    ecs.dirty_transforms = NULL;
+    ecs.dirty_indices = NULL;
+    ecs.dirty_count = ecs.dirty_capacity = 0;
+}
+
+// Give an entity a mesh of position_count positions, all red, replacing the one it has. Indices go in at whatever
+// width the vertex count needs
+void update_mesh(entity_t entity, float* positions, unsigned position_count, const uint32_t* indices, unsigned indices_size, unsigned face_count) {
+    for (unsigned i = 0; i < indices_size; i++) {
+        if (indices[i] >= position_count) {
+            printf("Mesh index %u is past the %u vertices!\n", indices[i], position_count);
+            return;
+        }
+    }
+    free_mesh(entity);
+    mesh_c_t* mesh = (mesh_c_t*)component_add(&ecs.meshes, entity);
+    if (!mesh) {
+        return;
     }
-    ecs.meshes[index].face_count = mesh->face_count;
 
-    unsigned int i = 0; // Keep i def outside loop to use it to get size
+    mesh->face_count = face_count;
 
-    ecs.meshes[index]._vertices_size = mesh->position_count * 7; // 3 for position, 4 for color
-    ecs.meshes[index]._vertices = (float*)malloc(ecs.meshes[index]._vertices_size * sizeof(float));
-    if (!ecs.meshes[index]._vertices) {
-        // Handle allocation failure
-        printf("Failed to allocate memory for mesh vertices!");
+    // Quantize the positions, all red
+    const float red_rgba[] = { 1.0f, 0.0f, 0.0f, 1.0f };
+    if (!mesh_quantize(mesh, positions, position_count, NULL, 0, red_rgba) || !mesh_alloc_indices(mesh, position_count, indices_size)) {
+        // Handle memory allocation failure
+        printf("Failed to allocate memory for mesh!\n");
+        free_mesh(entity);
         return;
     }
 
-    for (i = 0; i < mesh->position_count; i++) {
-        printf("i is %d\n", i);
-        unsigned int pos = i * 7;
-        float red_rgba[] = { r, g, b, 1.0f};
-        ecs.meshes[index]._vertices[pos] = mesh->positions[i * 3];
-        ecs.meshes[index]._vertices[pos + 1] = mesh->positions[i * 3 + 1];
-        ecs.meshes[index]._vertices[pos + 2] = mesh->positions[i * 3 + 2];
-        memcpy(ecs.meshes[index]._vertices + pos + 3, red_rgba, 4 * sizeof(float)); // Color, just make it all red
+    // Copy index data
+    for (unsigned i = 0; i < indices_size; i++) {
+        mesh_set_index(mesh, i, indices[i]);
     }
 
-    ecs.mesh_valid[index] = true;
+    mesh_upload(mesh);
+}
+
+// OBJ vertex welding
+// OBJ corners index positions, texture coordinates and normals separately, and every distinct (p, t, n) triple
+// needs a vertex of its own. Triples are looked up in an open addressing table kept at most half full, so welding
+// takes one probe or so per corner, linear in the size of the mesh
+typedef struct {
+    fastObjIndex* vertices; // The (p, t, n) each vertex was welded from, in order of first use
+    uint32_t* indices;      // Three per triangle, into vertices
+    uint32_t vertex_count;
+    uint32_t index_count;
+} welded_mesh_t;
+
+static inline uint32_t weld_hash(fastObjIndex key) {
+    uint32_t hash = key.p * 0x9E3779B1u ^ key.t * 0x85EBCA77u ^ key.n * 0xC2B2AE3Du;
+    hash ^= hash >> 16;
+    hash *= 0x7FEB352Du;
+    return hash ^ (hash >> 15);
+}
+
+void free_welded_mesh(welded_mesh_t* welded) {
+    free(welded->vertices);
+    free(welded->indices);
+    *welded = (welded_mesh_t){ 0 };
+}
+
+// Weld the corners of an OBJ's faces into vertices and indices, fanning faces of more than three corners out into
+// triangles. False if there's no memory for it
+bool weld_obj_mesh(const fastObjMesh* obj, welded_mesh_t* welded) {
+    *welded = (welded_mesh_t){ 0 };
+    uint32_t triangle_count = 0;
+    for (unsigned f = 0; f < obj->face_count; f++) {
+        triangle_count += obj->face_vertices[f] >= 3 ? obj->face_vertices[f] - 2 : 0;
+    }
+    uint32_t capacity = 16;
+    while (capacity < obj->index_count * 2) {
+        capacity *= 2;
+    }
+    uint32_t* table = (uint32_t*)calloc(capacity, sizeof(uint32_t)); // Vertex plus one, 0 for empty
+    uint32_t* corners = (uint32_t*)malloc(((size_t)obj->index_count + 1) * sizeof(uint32_t)); // Vertex of each corner
+    welded->vertices = (fastObjIndex*)malloc(((size_t)obj->index_count + 1) * sizeof(fastObjIndex));
+    welded->indices = (uint32_t*)malloc(((size_t)triangle_count * 3 + 1) * sizeof(uint32_t));
+    if (!table || !corners || !welded->vertices || !welded->indices) {
+        free(table);
+        free(corners);
+        free_welded_mesh(welded);
+        return false;
+    }
 
-    for (int k = 0; k < i * 7; k++) {
-        if (k % 7 == 0) {
-            printf("\n");
+    for (unsigned c = 0; c < obj->index_count; c++) {
+        const fastObjIndex key = obj->indices[c];
+        uint32_t slot = weld_hash(key) & (capacity - 1);
+        for (; table[slot] != 0; slot = (slot + 1) & (capacity - 1)) {
+            const fastObjIndex* vertex = &welded->vertices[table[slot] - 1];
+            if (vertex->p == key.p && vertex->t == key.t && vertex->n == key.n) {
+                break;
+            }
         }
-        if (ecs.meshes[index]._vertices[k] >= 0.0f)
-            printf(" ");
-        printf("%.2f, ", ecs.meshes[index]._vertices[k]);
+        if (table[slot] == 0) {
+            welded->vertices[welded->vertex_count] = key;
+            table[slot] = ++welded->vertex_count;
+        }
+        corners[c] = table[slot] - 1;
     }
 
-    ecs.meshes[index].vbuf = sg_make_buffer(&(sg_buffer_desc){
-        .data = (sg_range){ ecs.meshes[index]._vertices, i * 7 * sizeof(float) },
-        .label = "mesh-vertices"
-    });
+    for (unsigned f = 0, first = 0; f < obj->face_count; first += obj->face_vertices[f++]) {
+        for (unsigned k = 2; k < obj->face_vertices[f]; k++) {
+            welded->indices[welded->index_count++] = corners[first];
+            welded->indices[welded->index_count++] = corners[first + k - 1];
+            welded->indices[welded->index_count++] = corners[first + k];
+        }
+    }
+    free(table);
+    free(corners);
 
-    ecs.meshes[index].ibuf = sg_make_buffer(&(sg_buffer_desc){
-        .type = SG_BUFFERTYPE_INDEXBUFFER,
-        .data = (sg_range){ ecs.meshes[index]._indices, ecs.meshes[index]._indices_size * sizeof(uint16_t) },
-        .label = "mesh-indices"
-    });
+    // Give back what the vertices didn't need, the upper bound was one per corner
+    void* vertices = realloc(welded->vertices, ((size_t)welded->vertex_count + 1) * sizeof(fastObjIndex));
+    if (vertices) welded->vertices = (fastObjIndex*)vertices;
+    return true;
+}
+
+// Mesh import
+// OBJs come in as three timed stages: parse reads and parses the file, convert welds it and builds the vertices and
+// indices, upload makes the GPU buffers. The timings of the last import are kept for benchmarks and the stats window
+typedef struct {
+    double parse_ms;
+    double convert_ms;
+    double upload_ms;
+    uint32_t vertex_count;
+    uint32_t index_count;
+    bool cached; // Mapped from the cache next to the OBJ, parse_ms is the time that took
+} mesh_import_stats_t;
+
+static mesh_import_stats_t mesh_import_stats; // Of the last import_obj_mesh or load_mesh
+
+// Read an OBJ into the vertices and indices of mesh, all in one color, without touching the GPU. Corners are welded
+// into one vertex per distinct position, texture coordinate and normal. False if it can't be read
+bool import_obj_mesh(mesh_c_t* mesh, const char* mesh_path, float r, float g, float b) {
+    *mesh = (mesh_c_t){ 0 };
+    mesh_import_stats = (mesh_import_stats_t){ 0 };
+    uint64_t start = stm_now();
+    fastObjMesh* obj = fast_obj_read(mesh_path);
+    if (!obj) {
+        LOG_PRINTF(LOG_LEVEL_ERROR, "Failed to read mesh %s!\n", mesh_path);
+        return false;
+    }
+    mesh_import_stats.parse_ms = stm_ms(stm_laptime(&start));
+
+    welded_mesh_t welded;
+    if (!weld_obj_mesh(obj, &welded)) {
+        LOG_PRINTF(LOG_LEVEL_ERROR, "Failed to allocate memory for welding mesh %s!\n", mesh_path);
+        fast_obj_destroy(obj);
+        return false;
+    }
+    // Each welded vertex takes the position its p indexes, quantized over the mesh's bounds
+    const float rgba[] = { r, g, b, 1.0f };
+    const size_t stride = sizeof(fastObjIndex) / sizeof(uint32_t);
+    if (!mesh_quantize(mesh, obj->positions, welded.vertex_count, &welded.vertices[0].p, stride, rgba) ||
+        !mesh_alloc_indices(mesh, welded.vertex_count, welded.index_count)) {
+        LOG_PRINTF(LOG_LEVEL_ERROR, "Failed to allocate memory for mesh %s!\n", mesh_path);
+        free(mesh->_vertices);
+        *mesh = (mesh_c_t){ 0 };
+        free_welded_mesh(&welded);
+        fast_obj_destroy(obj);
+        return false;
+    }
+    for (unsigned i = 0; i < welded.index_count; i++) {
+        mesh_set_index(mesh, i, welded.indices[i]);
+    }
+    mesh->face_count = welded.index_count / 3;
+    mesh_import_stats.convert_ms = stm_ms(stm_laptime(&start));
+    mesh_import_stats.vertex_count = welded.vertex_count;
+    mesh_import_stats.index_count = welded.index_count;
+    free_welded_mesh(&welded);
+    fast_obj_destroy(obj);
+
+    for (unsigned i = 0; i < mesh->_indices_size; i += 3) {
+        LOG_PRINTF(LOG_LEVEL_DEBUG, "face %u: %u %u %u\n", i / 3, mesh_get_index(mesh, i), mesh_get_index(mesh, i + 1), mesh_get_index(mesh, i + 2));
+    }
+    for (unsigned i = 0; i < mesh->_vertex_count; i++) {
+        const mesh_vertex_t* v = &mesh->_vertices[i];
+        LOG_PRINTF(LOG_LEVEL_DEBUG, "vertex %u: %6d %6d %6d  %3u %3u %3u %3u\n", i, v->position[0], v->position[1], v->position[2],
+                   v->color[0], v->color[1], v->color[2], v->color[3]);
+    }
+    return true;
+}
+
+// Mesh cache
+
+// Imported meshes are kept in a cache file next to their OBJ (mesh.obj.cache), so later loads map it instead of
+// parsing text. It is this header, then the vertices and then the indices, each starting on a MESH_CACHE_ALIGN
+// boundary so they upload straight from the mapping. It's rebuilt whenever the OBJ's size or modification time, the
+// color or the format differs from what the header recorded
+#define MESH_CACHE_VERSION 1 // Bump whenever mesh_vertex_t or this header changes
+#define MESH_CACHE_ALIGN 64
+
+typedef struct {
+    char magic[4]; // "WMSH"
+    uint32_t version;
+    uint64_t source_size;
+    int64_t source_mtime_ns;
+    float color[4];
+    hmm_mat4 dequantize;
+    uint32_t vertex_count;
+    uint32_t index_count;
+    uint32_t face_count;
+    uint32_t index_type;
+    uint64_t vertex_offset;
+    uint64_t index_offset;
+} mesh_cache_header_t;
+
+static inline uint64_t mesh_cache_align(uint64_t offset) {
+    return (offset + MESH_CACHE_ALIGN - 1) & ~(uint64_t)(MESH_CACHE_ALIGN - 1);
+}
 
-    ecs.meshes[index].binding = (sg_bindings) {
-        .vertex_buffers[0] = ecs.meshes[index].vbuf,
-        .index_buffer = ecs.meshes[index].ibuf,
+// The header a cache of mesh would have, imported from an OBJ with the given stat in color rgba
+static mesh_cache_header_t mesh_cache_header(const mesh_c_t* mesh, const struct stat* source, const float rgba[4]) {
+    mesh_cache_header_t header = {
+        .magic = { 'W', 'M', 'S', 'H' },
+        .version = MESH_CACHE_VERSION,
+        .source_size = (uint64_t)source->st_size,
+        .source_mtime_ns = file_mtime_ns(source),
+        .color = { rgba[0], rgba[1], rgba[2], rgba[3] },
+        .dequantize = mesh->dequantize,
+        .vertex_count = mesh->_vertex_count,
+        .index_count = mesh->_indices_size,
+        .face_count = mesh->face_count,
+        .index_type = (uint32_t)mesh->index_type,
     };
+    header.vertex_offset = mesh_cache_align(sizeof(header));
+    header.index_offset = mesh_cache_align(header.vertex_offset + (uint64_t)header.vertex_count * sizeof(mesh_vertex_t));
+    return header;
+}
+
+// Map the cache at cache_path into mesh if it's still current for an OBJ with the given stat in color rgba. The
+// vertices and indices point into the mapping, which the mesh keeps. False if there's no usable cache
+static bool map_mesh_cache(mesh_c_t* mesh, const char* cache_path, const struct stat* source, const float rgba[4]) {
+    *mesh = (mesh_c_t){ 0 };
+    uint64_t start = stm_now();
+    int fd = open(cache_path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || (size_t)info.st_size < sizeof(mesh_cache_header_t)) {
+        close(fd);
+        return false;
+    }
+    // The mapping stays valid once the file is closed
+    void* mapped = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) {
+        return false;
+    }
+
+    // Layout and counts have to be exactly what writing a cache of them would give, so a stale or damaged file is
+    // never read past its end
+    const mesh_cache_header_t* header = (const mesh_cache_header_t*)mapped;
+    mesh->_vertex_count = header->vertex_count;
+    mesh->_indices_size = header->index_count;
+    mesh->face_count = header->face_count;
+    mesh->index_type = (sg_index_type)header->index_type;
+    mesh->dequantize = header->dequantize;
+    const mesh_cache_header_t expected = mesh_cache_header(mesh, source, rgba);
+    const uint64_t size = expected.index_offset + (uint64_t)expected.index_count * mesh_index_size(mesh);
+    bool current = memcmp(header->magic, expected.magic, sizeof(expected.magic)) == 0 && header->version == expected.version &&
+        header->source_size == expected.source_size && header->source_mtime_ns == expected.source_mtime_ns &&
+        memcmp(header->color, expected.color, sizeof(expected.color)) == 0 &&
+        header->vertex_offset == expected.vertex_offset && header->index_offset == expected.index_offset &&
+        mesh->index_type == mesh_index_type(mesh->_vertex_count) && mesh->face_count * 3 == mesh->_indices_size &&
+        (uint64_t)info.st_size == size;
+
+    // Nor is the GPU sent past the vertices: every index has to be one of them. A pass over the indices is still
+    // nothing next to parsing the OBJ
+    if (current) {
+        madvise(mapped, info.st_size, MADV_SEQUENTIAL);
+        mesh->_vertices = (mesh_vertex_t*)((uint8_t*)mapped + header->vertex_offset);
+        mesh->_indices = (uint8_t*)mapped + header->index_offset;
+        uint32_t highest = 0;
+        if (mesh->index_type == SG_INDEXTYPE_UINT32) {
+            const uint32_t* indices = (const uint32_t*)mesh->_indices;
+            for (unsigned i = 0; i < mesh->_indices_size; i++) {
+                highest = indices[i] > highest ? indices[i] : highest;
+            }
+        } else {
+            const uint16_t* indices = (const uint16_t*)mesh->_indices;
+            for (unsigned i = 0; i < mesh->_indices_size; i++) {
+                highest = indices[i] > highest ? indices[i] : highest;
+            }
+        }
+        current = mesh->_indices_size == 0 || highest < mesh->_vertex_count;
+    }
+    if (!current) {
+        LOG_PRINTF(LOG_LEVEL_DEBUG, "Mesh cache %s is out of date or damaged\n", cache_path);
+        munmap(mapped, info.st_size);
+        *mesh = (mesh_c_t){ 0 };
+        return false;
+    }
+    mesh->_mapped = mapped;
+    mesh->_mapped_size = info.st_size;
+
+    mesh_import_stats = (mesh_import_stats_t){
+        .parse_ms = stm_ms(stm_since(start)),
+        .vertex_count = mesh->_vertex_count,
+        .index_count = mesh->_indices_size,
+        .cached = true,
+    };
+    return true;
+}
+
+// Write a cache of mesh, imported from an OBJ with the given stat in color rgba. It goes to a temporary file first
+// and is renamed into place, so an interrupted write never leaves a cache that looks current
+static bool write_mesh_cache(const mesh_c_t* mesh, const char* cache_path, const struct stat* source, const float rgba[4]) {
+    char temp_path[1100];
+    snprintf(temp_path, sizeof(temp_path), "%s.%d.tmp", cache_path, (int)getpid());
+    FILE* file = fopen(temp_path, "wb");
+    if (!file) {
+        LOG_PRINTF(LOG_LEVEL_INFO, "Failed to write mesh cache %s\n", cache_path);
+        return false;
+    }
+    const mesh_cache_header_t header = mesh_cache_header(mesh, source, rgba);
+    static const uint8_t padding[MESH_CACHE_ALIGN] = { 0 };
+    const size_t vertices_size = (size_t)mesh->_vertex_count * sizeof(mesh_vertex_t);
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+              fwrite(padding, 1, header.vertex_offset - sizeof(header), file) == header.vertex_offset - sizeof(header) &&
+              fwrite(mesh->_vertices, 1, vertices_size, file) == vertices_size &&
+              fwrite(padding, 1, header.index_offset - header.vertex_offset - vertices_size, file) ==
+                  header.index_offset - header.vertex_offset - vertices_size &&
+              fwrite(mesh->_indices, mesh_index_size(mesh), mesh->_indices_size, file) == mesh->_indices_size;
+    ok = fclose(file) == 0 && ok;
+    if (!ok || rename(temp_path, cache_path) != 0) {
+        LOG_PRINTF(LOG_LEVEL_INFO, "Failed to write mesh cache %s\n", cache_path);
+        remove(temp_path);
+        return false;
+    }
+    return true;
+}
+
+// Load an OBJ as the mesh of entity, replacing the one it has, all in one color. Comes from the cache next to it when
+// that's current, otherwise the OBJ is imported and the cache rewritten
+void load_mesh(entity_t entity, const char* mesh_path, float r, float g, float b) {
+    struct stat source;
+    if (stat(mesh_path, &source) != 0) {
+        LOG_PRINTF(LOG_LEVEL_ERROR, "Failed to read mesh %s!\n", mesh_path);
+        return;
+    }
+    char cache_path[1100];
+    snprintf(cache_path, sizeof(cache_path), "%s.cache", mesh_path);
+    const float rgba[] = { r, g, b, 1.0f };
+    mesh_c_t imported;
+    if (!map_mesh_cache(&imported, cache_path, &source, rgba)) {
+        if (!import_obj_mesh(&imported, mesh_path, r, g, b)) {
+            return;
+        }
+        write_mesh_cache(&imported, cache_path, &source, rgba);
+    }
+    free_mesh(entity);
+    mesh_c_t* entity_mesh = (mesh_c_t*)component_add(&ecs.meshes, entity);
+    if (!entity_mesh) {
+        mesh_free_data(&imported);
+        return;
+    }
+    *entity_mesh = imported;
+    uint64_t start = stm_now();
+    mesh_upload(entity_mesh);
+    mesh_import_stats.upload_ms = stm_ms(stm_since(start));
+    LOG_PRINTF(LOG_LEVEL_INFO, "Loaded mesh %s%s: %u vertices, %u triangles, parse %.2f ms, convert %.2f ms, upload %.2f ms\n",
+               mesh_path, mesh_import_stats.cached ? " from its cache" : "", mesh_import_stats.vertex_count,
+               mesh_import_stats.index_count / 3, mesh_import_stats.parse_ms, mesh_import_stats.convert_ms,
+               mesh_import_stats.upload_ms);
 }
 
 // Modify the init function
@@ -412,8 +5140,10 @@ void init(void) {
 
     memset(state.key_down, 0, sizeof(state.key_down)); // set key down to zero
 
+    entity_t entities[5];
     for (int i = 0; i < 5; i++) {
-        update_transform(i, &(transform_c_t){
+        entities[i] = create_entity();
+        update_transform(entities[i], &(transform_c_t){
             .position = HMM_Vec3((float)i * 3.1f - 6.0f, (float)i * 1.1f - 5.0f, -10.0f),
             .rotation = HMM_Vec3((float)i * 20.0f, (float)i * 20.0f, 0.0f)
         });
@@ -505,20 +5235,19 @@ void init(void) {
     // int face_count = mesh->face_count;
     // printf("hih\n");
 
-    printf("MESHY LOAD LOAD");
     // update_mesh(2, mesh->positions, mesh->position_count, (uint16_t*)mesh->indices, mesh->index_count, mesh->face_count);
     // Function to load and process mesh data
 
     // Call the function with the mesh path
     char mesh_path[1024];
     snprintf(mesh_path, sizeof(mesh_path), "%s/assets/monkey.obj", dir_path);
-    printf("Loading mesh: %s\n", mesh_path);
-    load_mesh(0, mesh_path, 1.0f, 0.0f, 0.0f);
+    LOG_PRINTF(LOG_LEVEL_INFO, "Loading mesh: %s\n", mesh_path);
+    load_mesh(entities[0], mesh_path, 1.0f, 0.0f, 0.0f);
     
     char mesh_path_2[1024];
     snprintf(mesh_path_2, sizeof(mesh_path_2), "%s/examples/basic/ball.obj", dir_path);
-    printf("Loading mesh: %s\n", mesh_path_2);
-    load_mesh(1, mesh_path_2, 0.0f, 1.0f, 0.0f);
+    LOG_PRINTF(LOG_LEVEL_INFO, "Loading mesh: %s\n", mesh_path_2);
+    load_mesh(entities[1], mesh_path_2, 0.0f, 1.0f, 0.0f);
 
     user_init_callback();
     // From opengl tutorial
@@ -606,8 +5335,8 @@ uint16_t indices[] = {
         .op_alpha = SG_BLENDOP_ADD
     };
 
-    // /* create pipeline object */
-    state.pip = sg_make_pipeline(&(sg_pipeline_desc) {
+    // /* create pipeline object */ for the debug cubes, and copies with the mesh vertex layout for each index width
+    sg_pipeline_desc pip_desc = {
         .layout = {
             /* test to provide buffer stride, but no attr offsets */
             .buffers[0].stride = 28,
@@ -625,7 +5354,20 @@ uint16_t indices[] = {
         },
         .colors[0].blend = blend_state, // Add blend state here
         .label = "cube-pipeline"
-    });
+    };
+    state.pip = sg_make_pipeline(&pip_desc);
+    pip_desc.layout = (sg_vertex_layout_state){
+        .buffers[0].stride = sizeof(mesh_vertex_t),
+        .attrs = {
+            [ATTR_vs_position].format = SG_VERTEXFORMAT_SHORT4N,
+            [ATTR_vs_color0].format   = SG_VERTEXFORMAT_UBYTE4N
+        }
+    };
+    pip_desc.label = "mesh-pipeline";
+    state.mesh_pip = sg_make_pipeline(&pip_desc);
+    pip_desc.index_type = SG_INDEXTYPE_UINT32;
+    pip_desc.label = "mesh-pipeline-uint32";
+    state.mesh_pip_uint32 = sg_make_pipeline(&pip_desc);
 
     state.volume_pip = sg_make_pipeline(&(sg_pipeline_desc){
         .layout = {
@@ -637,18 +5379,95 @@ uint16_t indices[] = {
         .shader = volume_shader,
         .index_type = SG_INDEXTYPE_UINT16,
         .cull_mode = SG_CULLMODE_BACK,
+        // Volumes are sorted back to front rather than depth tested, rays stop at meshes by themselves
+        .depth.pixel_format = SG_PIXELFORMAT_NONE,
+        // Volumes go into volume_target.color, which keeps their colors premultiplied so frames can be averaged
+        .colors[0] = {
+            .pixel_format = SG_PIXELFORMAT_RGBA16F,
+            .blend = {
+                .enabled = true,
+                .src_factor_rgb = SG_BLENDFACTOR_SRC_ALPHA,
+                .dst_factor_rgb = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+                .src_factor_alpha = SG_BLENDFACTOR_ONE,
+                .dst_factor_alpha = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+            }
+        },
+        .sample_count = 1,
+        .label = "volume-pipeline",
+    });
+
+    // How far away the meshes are at full size, where rays through volumes stop and what the volume composite
+    // scales up against
+    sg_shader distance_shader = sg_make_shader(distance_shader_desc(sg_query_backend()));
+    sg_pipeline_desc distance_pip_desc = {
+        .layout = {
+            .buffers[0].stride = 28,
+            .attrs[ATTR_vs_distance_position].format = SG_VERTEXFORMAT_FLOAT3
+        },
+        .shader = distance_shader,
+        .index_type = SG_INDEXTYPE_UINT16,
+        .cull_mode = SG_CULLMODE_FRONT,
         .depth = {
+            .pixel_format = SG_PIXELFORMAT_DEPTH,
             .write_enabled = true,
             .compare = SG_COMPAREFUNC_LESS_EQUAL,
         },
-        .colors[0].blend = blend_state, // Add blend state here
-        .label = "volume-pipeline",
+        .colors[0].pixel_format = SG_PIXELFORMAT_R32F,
+        .sample_count = 1,
+        .label = "scene-distance-pipeline"
+    };
+    volume_target.distance_pip = sg_make_pipeline(&distance_pip_desc);
+    distance_pip_desc.layout = (sg_vertex_layout_state){
+        .buffers[0].stride = sizeof(mesh_vertex_t),
+        .attrs[ATTR_vs_distance_position].format = SG_VERTEXFORMAT_SHORT4N
+    };
+    distance_pip_desc.label = "scene-distance-mesh-pipeline";
+    volume_target.distance_mesh_pip = sg_make_pipeline(&distance_pip_desc);
+    distance_pip_desc.index_type = SG_INDEXTYPE_UINT32;
+    distance_pip_desc.label = "scene-distance-mesh-pipeline-uint32";
+    volume_target.distance_mesh_pip_uint32 = sg_make_pipeline(&distance_pip_desc);
+
+    // Frames of volumes are summed into the accumulation target, and the sum divided back out over the swapchain.
+    // Both read their source texel by texel, filtering is done by hand where it's needed
+    sg_shader composite_shader = sg_make_shader(composite_shader_desc(sg_query_backend()));
+    volume_target.accum_pip = sg_make_pipeline(&(sg_pipeline_desc){
+        .shader = composite_shader,
+        .depth.pixel_format = SG_PIXELFORMAT_NONE,
+        .colors[0] = {
+            .pixel_format = SG_PIXELFORMAT_RGBA16F,
+            .blend = {
+                .enabled = true,
+                .src_factor_rgb = SG_BLENDFACTOR_ONE,
+                .dst_factor_rgb = SG_BLENDFACTOR_ONE,
+                .src_factor_alpha = SG_BLENDFACTOR_ONE,
+                .dst_factor_alpha = SG_BLENDFACTOR_ONE,
+            }
+        },
+        .sample_count = 1,
+        .label = "volume-accum-pipeline"
+    });
+    volume_target.composite_pip = sg_make_pipeline(&(sg_pipeline_desc){
+        .shader = composite_shader,
+        .colors[0].blend = {
+            .enabled = true,
+            .src_factor_rgb = SG_BLENDFACTOR_ONE,
+            .dst_factor_rgb = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+            .src_factor_alpha = SG_BLENDFACTOR_ONE,
+            .dst_factor_alpha = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+        },
+        .label = "volume-composite-pipeline"
+    });
+    volume_target.smp = sg_make_sampler(&(sg_sampler_desc){
+        .min_filter = SG_FILTER_NEAREST,
+        .mag_filter = SG_FILTER_NEAREST,
+        .wrap_u = SG_WRAP_CLAMP_TO_EDGE,
+        .wrap_v = SG_WRAP_CLAMP_TO_EDGE,
     });
 
 
 
     // Update volume for testing
-    randomize_volume(1);
+    randomize_volume(entities[1]);
 
     // THIS WORKS
     // // set first volume to random
@@ -708,19 +5527,13 @@ uint16_t indices[] = {
     //     .label = "volume-texture"
     // });
 
-    // Create the colormap
-    create_colormap();
-
-    // Create the Sokol image for the colormap
-    colormap_img = sg_make_image(&(sg_image_desc){
-        .width = COLORMAP_WIDTH,
-        .height = COLORMAP_HEIGHT,
-        .pixel_format = SG_PIXELFORMAT_RGBA8,
-        .data.subimage[0][0] = {
-            .ptr = colormap_data,
-            .size = sizeof(colormap_data)
-        },
-        .label = "colormap"
+    // Volumes are colored through the transfer function's pre-integrated table, filled in before the first draw
+    transfer.table_img = sg_make_image(&(sg_image_desc){
+        .width = TRANSFER_TABLE_SIZE,
+        .height = TRANSFER_TABLE_SIZE,
+        .pixel_format = SG_PIXELFORMAT_RGBA16F,
+        .usage = SG_USAGE_DYNAMIC,
+        .label = "transfer-table"
     });
 
 
@@ -731,37 +5544,38 @@ uint16_t indices[] = {
     //      1.0f,  1.0f, 0.0f,  1.0f, 1.0f, 0.0f,
     //     -1.0f,  1.0f, 0.0f,  0.0f, 1.0f, 0.0f
     // };
+    // Proxy geometry for the raymarcher: the volume's [0, 1] bounding box, scaled to world size in the vertex shader
     float volume_vertices[] = {
         // Positions
-        -1.0, -1.0, -1.0,
-         1.0, -1.0, -1.0,
-         1.0,  1.0, -1.0,
-        -1.0,  1.0, -1.0,
-
-        -1.0, -1.0,  1.0,
-         1.0, -1.0,  1.0,
-         1.0,  1.0,  1.0,
-        -1.0,  1.0,  1.0,
-
-        -1.0, -1.0, -1.0,
-        -1.0,  1.0, -1.0,
-        -1.0,  1.0,  1.0,
-        -1.0, -1.0,  1.0,
-
-        1.0, -1.0, -1.0,
-        1.0,  1.0, -1.0,
-        1.0,  1.0,  1.0,
-        1.0, -1.0,  1.0,
-
-        -1.0, -1.0, -1.0,
-        -1.0, -1.0,  1.0,
-         1.0, -1.0,  1.0,
-         1.0, -1.0, -1.0,
-
-        -1.0,  1.0, -1.0,
-        -1.0,  1.0,  1.0,
-         1.0,  1.0,  1.0,
-         1.0,  1.0, -1.0,
+        0.0, 0.0, 0.0,
+        1.0, 0.0, 0.0,
+        1.0, 1.0, 0.0,
+        0.0, 1.0, 0.0,
+
+        0.0, 0.0, 1.0,
+        1.0, 0.0, 1.0,
+        1.0, 1.0, 1.0,
+        0.0, 1.0, 1.0,
+
+        0.0, 0.0, 0.0,
+        0.0, 1.0, 0.0,
+        0.0, 1.0, 1.0,
+        0.0, 0.0, 1.0,
+
+        1.0, 0.0, 0.0,
+        1.0, 1.0, 0.0,
+        1.0, 1.0, 1.0,
+        1.0, 0.0, 1.0,
+
+        0.0, 0.0, 0.0,
+        0.0, 0.0, 1.0,
+        1.0, 0.0, 1.0,
+        1.0, 0.0, 0.0,
+
+        0.0, 1.0, 0.0,
+        0.0, 1.0, 1.0,
+        1.0, 1.0, 1.0,
+        1.0, 1.0, 0.0,
     };
 
     /* create an index buffer for the cube */
@@ -795,12 +5609,44 @@ uint16_t indices[] = {
     state.volume_bind.fs.samplers[SLOT_volume_smp] = sg_make_sampler(&(sg_sampler_desc){
         .min_filter = SG_FILTER_NEAREST,
         .mag_filter = SG_FILTER_NEAREST,
+        .mipmap_filter = SG_FILTER_LINEAR,
     });
-    // Add the colormap image to the bindings
-    // state.volume_bind.fs.images[SLOT_colormap] = colormap_img;
-    state.volume_bind.fs.samplers[SLOT_colormap_smp] = sg_make_sampler(&(sg_sampler_desc){
-        .min_filter = SG_FILTER_NEAREST,
-        .mag_filter = SG_FILTER_NEAREST,
+    // Plain volumes don't use the brick textures and bricked ones don't use the volume texture, but every slot needs an image
+    uint8_t empty_voxel[4] = { 0 };
+    state.empty_volume_img = sg_make_image(&(sg_image_desc){
+        .type = SG_IMAGETYPE_3D,
+        .width = 1,
+        .height = 1,
+        .num_slices = 1,
+        .pixel_format = SG_PIXELFORMAT_R8,
+        .data.subimage[0][0] = { .ptr = empty_voxel, .size = 1 },
+        .label = "empty-volume"
+    });
+    state.empty_brick_table_img = sg_make_image(&(sg_image_desc){
+        .type = SG_IMAGETYPE_3D,
+        .width = 1,
+        .height = 1,
+        .num_slices = 1,
+        .pixel_format = SG_PIXELFORMAT_RGBA8,
+        .data.subimage[0][0] = { .ptr = empty_voxel, .size = 4 },
+        .label = "empty-brick-table"
+    });
+    uint8_t full_cell = 255;
+    state.full_occupancy_img = sg_make_image(&(sg_image_desc){
+        .type = SG_IMAGETYPE_3D,
+        .width = 1,
+        .height = 1,
+        .num_slices = 1,
+        .pixel_format = SG_PIXELFORMAT_R8,
+        .data.subimage[0][0] = { .ptr = &full_cell, .size = 1 },
+        .label = "full-occupancy"
+    });
+    // Add the transfer table's sampler to the bindings. Filtering interpolates between the table's entries
+    state.volume_bind.fs.samplers[SLOT_transfer_smp] = sg_make_sampler(&(sg_sampler_desc){
+        .min_filter = SG_FILTER_LINEAR,
+        .mag_filter = SG_FILTER_LINEAR,
+        .wrap_u = SG_WRAP_CLAMP_TO_EDGE,
+        .wrap_v = SG_WRAP_CLAMP_TO_EDGE,
     });
 
     // sg_shader phong_shd = sg_make_shader(phong_shader_desc(sg_query_backend()));
@@ -929,47 +5775,125 @@ void frame(void) {
     igSliderFloat("Camera Ry", &state.cam_ry, -180.0f, 180.0f, "%.1f", 0);
     igSliderFloat("Camera FOV", &state.cam_fov, 10.0f, 100.0f, "%.1f", 0);
     igCheckbox("Camera Rotation Drift", &state.cam_drift);
+    igSliderFloat("Volume LOD Bias", &state.lod_bias, -4.0f, 4.0f, "%.1f", 0);
+    igSliderFloat("Volume Max Step", &state.volume_max_step, 1.0f, 16.0f, "%.0f", 0);
+    igSliderFloat("Volume Refine Opacity", &state.volume_refine_opacity, 0.0f, 0.2f, "%.3f", 0);
+    igSliderFloat("Volume Alpha Cutoff", &state.volume_alpha_cutoff, 0.9f, 1.0f, "%.3f", 0);
+    igSliderFloat("Volume Resolution", &state.volume_resolution, 0.25f, 1.0f, "%.2f", 0);
+    igCheckbox("Progressive Volumes", &state.volume_progressive);
+    if (state.volume_progressive) {
+        igSliderFloat("Volume Motion Step", &state.volume_motion_step, 1.0f, 8.0f, "%.0f", 0);
+        igSliderInt("Volume Refine Frames", &state.volume_refine_frames, 1, VOLUME_REFINE_MAX_FRAMES, "%d", 0);
+        igText("Refined %d/%d frames", volume_target.frames, state.volume_refine_frames);
+    }
+    igText("Last volume pass: %d draws, %d culled, %d pipeline, %d binding, %d uniform changes",
+           volume_queue.stats.draws, volume_queue.stats.culled, volume_queue.stats.pipelines,
+           volume_queue.stats.bindings, volume_queue.stats.uniforms);
+    igText("Last mesh import%s: %u vertices, parse %.2f ms, convert %.2f ms, upload %.2f ms",
+           mesh_import_stats.cached ? " (cached)" : "", mesh_import_stats.vertex_count, mesh_import_stats.parse_ms,
+           mesh_import_stats.convert_ms, mesh_import_stats.upload_ms);
     igCheckbox("Show DearImgui demo window", &gui.show_imgui_demo);
     if (gui.show_imgui_demo) igShowDemoWindow(0);
     igEnd();
 
+    transfer_function_editor();
+
     // Entity Settings UI Code
     igSetNextWindowPos((ImVec2){10, 320}, ImGuiCond_Once, (ImVec2){0,0});
     igSetNextWindowSize((ImVec2){600, 300}, ImGuiCond_Once);
     igBegin("Entity Settings", 0, ImGuiWindowFlags_None);
-    for (int i = 0; i < NUM_COMPONENTS; i++) {
-        char entity_label[64];
-        if (ecs.transforms_valid[i]) {
-            snprintf(entity_label, sizeof(entity_label), "Entity %d", i);
-        }
-        else {
-            snprintf(entity_label, sizeof(entity_label), "Entity %d (invalid)", i);
+    igText("%u entities, %u transforms, %u meshes, %u volumes", ecs.entity_count, ecs.transforms.count, ecs.meshes.count, ecs.volumes.count);
+    if (igButton("Create Entity", (ImVec2){0, 0})) {
+        update_transform(create_entity(), &(transform_c_t){ .position = HMM_Vec3(0.0f, 0.0f, 0.0f) });
+    }
+    for (uint32_t slot = 0; slot < ecs.slot_count; slot++) {
+        if (!ecs.alive[slot]) {
+            continue;
         }
+        const entity_t entity = entity_from_slot(slot);
+        char entity_label[64];
+        snprintf(entity_label, sizeof(entity_label), "Entity %u (generation %u)", slot, entity.id >> ENTITY_INDEX_BITS);
         if (igTreeNodeEx_Str(entity_label, ImGuiTreeNodeFlags_NoAutoOpenOnLog)) {
-            igCheckbox("Transform Valid", &ecs.transforms_valid[i]);
-            igCheckbox("Mesh Valid", &ecs.mesh_valid[i]);
-            igCheckbox("Volume Valid", &ecs.volume_valid[i]);
-            
-            // Add XYZ input for each entity's position
-            if (ecs.transforms_valid[i]) {
-                igDragFloat3("Position", &ecs.transforms[i].position.X, 0.1f, -10.0f, 10.0f, "%.1f", 0);
-                igDragFloat3("Rotation", &ecs.transforms[i].rotation.X, 0.1f, -360.0f, 360.0f, "%.1f", 0);
-            }
-
-            // Add a button to randomize the volume, if volume is valid
-            if (ecs.volume_valid[i]) {
+            // Components are added and removed rather than switched off
+            transform_c_t transform;
+            bool has_transform = get_transform(entity, &transform);
+            if (igCheckbox("Transform", &has_transform)) {
+                if (has_transform) {
+                    update_transform(entity, &(transform_c_t){ .position = HMM_Vec3(0.0f, 0.0f, 0.0f) });
+                } else {
+                    remove_transform(entity);
+                }
+            }
+            bool has_volume = get_volume(entity) != NULL;
+            if (igCheckbox("Volume", &has_volume)) {
+                if (has_volume) {
+                    randomize_volume(entity);
+                } else {
+                    free_volume(entity);
+                }
+            }
+            if (get_mesh(entity) && igButton("Remove Mesh", (ImVec2){0, 0})) {
+                free_mesh(entity);
+            }
+
+            // Add XYZ input for each entity's position, relative to its parent, and the slot of the parent, -1 for none
+            if (get_transform(entity, &transform)) {
+                int parent_slot = transform.parent.id != 0 ? (int)entity_slot(transform.parent) : -1;
+                bool changed = igDragFloat3("Position", &transform.position.X, 0.1f, -10.0f, 10.0f, "%.1f", 0) |
+                               igDragFloat3("Rotation", &transform.rotation.X, 0.1f, -360.0f, 360.0f, "%.1f", 0);
+                if (igInputInt("Parent", &parent_slot, 1, 1, 0)) {
+                    const bool valid = parent_slot >= 0 && (uint32_t)parent_slot < ecs.slot_count && ecs.alive[parent_slot];
+                    transform.parent = valid ? entity_from_slot((uint32_t)parent_slot) : (entity_t){ 0 };
+                    changed = true;
+                }
+                if (changed) {
+                    update_transform(entity, &transform);
+                }
+            }
+
+            volume_c_t* volume = get_volume(entity);
+            if (volume && volume->bricks) {
+                brick_cache_t* cache = &volume->bricks->cache;
+                igText("Bricks resident %d / %d (%d visible)", cache->resident_count, cache->brick_count, volume->bricks->visible_last_frame);
+                igText("Bricks loaded last frame %d (%d on the way)", volume->bricks->loads_last_frame, volume->bricks->loads_pending);
+            }
+            if (volume && volume->stream) {
+                igText("Chunks streamed %d / %d", volume->stream->chunks_done, volume->stream->chunk_count);
+            }
+            if (volume && !volume->bricks) {
+                float window = volume->window, level = volume->level;
+                float speed = window * 0.005f;
+                if (igDragFloat("Window", &window, speed, 0.0f, 0.0f, "%.3f", 0) | igDragFloat("Level", &level, speed, 0.0f, 0.0f, "%.3f", 0)) {
+                    set_volume_window(entity, window, level);
+                }
+                igText("Mip levels %d", volume->mip_levels);
+                bool use_max = volume->mip_reduce == VOLUME_REDUCE_MAX;
+                if (igCheckbox("Max Mip Reduction", &use_max)) {
+                    volume->mip_reduce = use_max ? VOLUME_REDUCE_MAX : VOLUME_REDUCE_MEAN;
+                    update_volume_region(entity, volume->_volume, 0, 0, 0, volume->width, volume->height, volume->depth);
+                }
+                bool compressed = volume->compressed;
+                if (volume->type == VOLUME_UINT8 && igCheckbox("Compressed (BC4)", &compressed)) {
+                    set_volume_compression(entity, compressed);
+                }
+            }
+
+            // Add a button to randomize the volume, if there is one
+            if (volume && !volume->bricks) {
                 if (igButton("Randomize Volume", (ImVec2){0, 0})) {
-                    randomize_volume(i);
+                    randomize_volume(entity);
                 }
                 if (igButton("Set to sphere", (ImVec2){0, 0})) {
-                    sphere_volume(i);
+                    sphere_volume(entity);
                 }
                 if (igButton("Set to cube", (ImVec2){0, 0})) {
-                    cube_volume(i);
+                    cube_volume(entity);
                 }
             }
 
-
+            if (igButton("Destroy Entity", (ImVec2){0, 0})) {
+                destroy_entity(entity);
+            }
             igTreePop();
         }
     }
@@ -1015,104 +5939,107 @@ void frame(void) {
     hmm_mat4 view = HMM_Translate(HMM_MultiplyVec3f(state.cam_pos, -1.0f));
     hmm_mat4 view_proj = HMM_MultiplyMat4(proj, view);
 
-    // sg_begin_default_pass(&state.pass_action, (int)w, (int)h);
-    sg_begin_pass(&(sg_pass){ .action = state.pass_action, .swapchain = sglue_swapchain() });
-    sg_apply_pipeline(state.pip);
-    sg_apply_bindings(&state.bind);
-
-    // Calculate the model view projection matrix for each transform
-    for (int i = 0; i < NUM_COMPONENTS; i++) {
-        transform_c_t *transform = &ecs.transforms[i];
-        if (ecs.transforms_valid[i]) {
-            ecs.transforms[i].rotation.X += 1.0f * t;
+    // Angle a pixel of the volume pass covers, which volumes use to pick their mip levels
+    volume_target_resize(sapp_width(), sapp_height(), state.volume_resolution);
+    const float pixel_angle = 2.0f * HMM_TanF(state.cam_fov * (HMM_PI32 / 360.0f)) / (float)volume_target.scaled_height * exp2f(state.lod_bias);
 
-            hmm_mat4 model = HMM_Translate(transform->position);
+    // Rebuild the matrices of whatever moved since the last frame, or of everything if the camera did
+    update_transforms(view_proj);
 
-            // Apply individual rotations
-            hmm_mat4 pitch = HMM_Rotate(transform->rotation.X, HMM_Vec3(1.0f, 0.0f, 0.0f));
-            hmm_mat4 yaw = HMM_Rotate(transform->rotation.Y, HMM_Vec3(0.0f, 1.0f, 0.0f));
-            hmm_mat4 roll = HMM_Rotate(transform->rotation.Z, HMM_Vec3(0.0f, 0.0f, 1.0f));
-            model = HMM_MultiplyMat4(model, pitch);
-            model = HMM_MultiplyMat4(model, yaw);
-            model = HMM_MultiplyMat4(model, roll);
+    update_transfer_table();
 
-            // model is now a 4x4 transformation matrix of the model's location
-            // Save this transform for rendering in the next for loop
-            transform->_transform = model;
-        }
-    }
-    
-    // Optional per-entity rendering of a cube mesh at the transform for debugging
-    if (state.show_debug_cubes) {
-        for (int i = 0; i < NUM_COMPONENTS; i++) {
-            if (ecs.transforms_valid[i]) {
-                vs_params_t vs_params;
-                vs_params.mvp = HMM_MultiplyMat4(view_proj, ecs.transforms[i]._transform);
-                sg_apply_uniforms(SG_SHADERSTAGE_VS, SLOT_vs_params, &SG_RANGE(vs_params));
-                sg_draw(0, 36, 1);
+    // Page in whatever bricks out-of-core volumes need for this view, and upload edits to in-core ones, before anything is drawn
+    for (uint32_t i = 0; i < ecs.volumes.count; i++) {
+        volume_c_t* volume = (volume_c_t*)component_at(&ecs.volumes, i);
+        const uint32_t transform = component_find(&ecs.transforms, ecs.volumes.entities[i]);
+        if (volume->bricks) {
+            if (transform != UINT32_MAX) {
+                update_bricked_volume(volume, transform_world_position_at(transform), view_proj, state.cam_pos, volume_lod_scale(volume, pixel_angle));
             }
+        } else {
+            if (volume->stream) {
+                update_volume_stream(ecs.volumes.entities[i]);
+            }
+            upload_volume(volume);
         }
     }
 
-    // Render each mesh if it exists
-    for (int i = 0; i < NUM_COMPONENTS; i++) {
-        if (ecs.transforms_valid[i] && ecs.mesh_valid[i]) {
-            sg_apply_bindings(&ecs.meshes[i].binding);
-            transform_c_t *transform = &ecs.transforms[i];
-            vs_params_t vs_params;
-            vs_params.mvp = HMM_MultiplyMat4(view_proj, ecs.transforms[i]._transform);
-            sg_apply_uniforms(SG_SHADERSTAGE_VS, SLOT_vs_params, &SG_RANGE(vs_params));
-            sg_draw(0, ecs.meshes[i].face_count * 3, 1);
-        }
+    // Start the average over whenever anything the volumes show changed, and once more when it stops changing to
+    // drop the coarse frame drawn while it moved. Without progressive rendering every frame starts over
+    const uint64_t scene_hash = volume_scene_hash(view_proj);
+    const bool moving = scene_hash != volume_target.scene_hash;
+    volume_target.scene_hash = scene_hash;
+    if (moving || volume_target.coarse || !state.volume_progressive) {
+        volume_target.frames = 0;
     }
+    volume_target.coarse = moving && state.volume_progressive;
+    const int refine_frames = state.volume_progressive ? (int)HMM_Clamp(1, state.volume_refine_frames, VOLUME_REFINE_MAX_FRAMES) : 1;
+    const float min_step = volume_target.coarse ? HMM_MAX(state.volume_motion_step, 1.0f) : 1.0f;
+    const float max_step = HMM_MAX(state.volume_max_step, min_step);
+
+    if (volume_target.frames < refine_frames) {
+        sg_begin_pass(&(sg_pass){
+            .action = {
+                .colors[0] = { .load_action = SG_LOADACTION_CLEAR, .clear_value = { SCENE_DISTANCE_FAR, 0.0f, 0.0f, 0.0f } },
+                .depth = { .load_action = SG_LOADACTION_CLEAR, .clear_value = 1.0f },
+            },
+            .attachments = volume_target.scene_pass
+        });
+        draw_meshes(volume_target.distance_pip, volume_target.distance_mesh_pip, volume_target.distance_mesh_pip_uint32, true);
+        sg_end_pass();
 
-    // Render each volume if it exists
-    for (int i = 0; i < NUM_COMPONENTS; i++) {
-        if (ecs.transforms_valid[i] && ecs.volume_valid[i]) {
-            if (ecs.volume_valid[i] && ecs.volumes[i]._volume == NULL) { // TODO make this a better null check
-                printf("VOLUME DATA FROM ENTITY NUMBER %d UNALLOCATED!\n", i);
-                continue;
-            }
-
-            sg_apply_pipeline(state.volume_pip);
-            sg_bindings volume_bind = {
-                .vertex_buffers[0] = state.volume_bind.vertex_buffers[0],
-                .index_buffer = state.volume_bind.index_buffer,
-            };
-
-            volume_bind.fs.images[SLOT_volume] = ecs.volumes[i].img;
-            volume_bind.fs.samplers[SLOT_volume_smp] = state.volume_bind.fs.samplers[SLOT_volume_smp];
-            // Add the colormap image to the bindings
-            volume_bind.fs.images[SLOT_colormap] = colormap_img;
-            volume_bind.fs.samplers[SLOT_colormap_smp] = state.volume_bind.fs.samplers[SLOT_colormap_smp];
-            sg_apply_bindings(&volume_bind);
-
-            fs_vol_params_t fs_vol_params = {
-                .volume_dims = { 100, 100, 100 },
-                .dt_scale = 0.005f,
-                .near_clip = 0.01f,
-                .far_clip = 1000.0f,
-                .new_box_min = { 0.0f, 0.0f, 0.0f },
-                .new_box_max = { 1.0f, 1.0f, 1.0f }
-            };
-            sg_apply_uniforms(SG_SHADERSTAGE_FS, SLOT_fs_vol_params, &SG_RANGE(fs_vol_params));
-
-            vs_vol_params_t vs_vol_params = {
-                .proj_view = view_proj,
-                .eye_pos = { state.cam_pos.X, state.cam_pos.Y, state.cam_pos.Z },
-                .volume_scale = { 1.0f, 1.0f, 1.0f },
-                .volume_translation = {
-                    ecs.transforms[i].position.X,
-                    ecs.transforms[i].position.Y,
-                    ecs.transforms[i].position.Z
-                }
-            };
-            sg_apply_uniforms(SG_SHADERSTAGE_VS, SLOT_vs_params, &SG_RANGE(vs_vol_params));
-
-            sg_draw(0, 36, 1); // Assuming 4 vertices for the volume quad
+        build_volume_queue(view_proj, state.cam_pos);
+        sg_begin_pass(&(sg_pass){
+            .action.colors[0] = { .load_action = SG_LOADACTION_CLEAR, .clear_value = { 0.0f, 0.0f, 0.0f, 0.0f } },
+            .attachments = volume_target.pass
+        });
+        draw_volume_queue(view_proj, pixel_angle, min_step, max_step);
+        sg_end_pass();
+
+        // Add the frame onto the ones before it. A single frame is composited straight from color
+        if (refine_frames > 1) {
+            sg_begin_pass(&(sg_pass){
+                .action.colors[0] = {
+                    .load_action = volume_target.frames == 0 ? SG_LOADACTION_CLEAR : SG_LOADACTION_LOAD,
+                    .clear_value = { 0.0f, 0.0f, 0.0f, 0.0f }
+                },
+                .attachments = volume_target.accum_pass
+            });
+            sg_apply_pipeline(volume_target.accum_pip);
+            sg_apply_bindings(&(sg_bindings){
+                .fs.images[SLOT_source] = volume_target.color,
+                .fs.images[SLOT_full_distance] = volume_target.scene_distance,
+                .fs.samplers[SLOT_point_smp] = volume_target.smp
+            });
+            fs_composite_params_t accum_params = { .weight = 1.0f, .upsample = 0 };
+            sg_apply_uniforms(SG_SHADERSTAGE_FS, SLOT_fs_composite_params, &SG_RANGE(accum_params));
+            sg_draw(0, 3, 1);
+            sg_end_pass();
         }
+        volume_target.frames++;
     }
 
+    // sg_begin_default_pass(&state.pass_action, (int)w, (int)h);
+    sg_begin_pass(&(sg_pass){ .action = state.pass_action, .swapchain = sglue_swapchain() });
+    draw_meshes(state.pip, state.mesh_pip, state.mesh_pip_uint32, false);
+
+    // Volumes over the meshes, averaged over the frames refined so far and scaled up to the swapchain
+    sg_apply_pipeline(volume_target.composite_pip);
+    sg_apply_bindings(&(sg_bindings){
+        .fs.images[SLOT_source] = refine_frames > 1 ? volume_target.accum : volume_target.color,
+        .fs.images[SLOT_full_distance] = volume_target.scene_distance,
+        .fs.samplers[SLOT_point_smp] = volume_target.smp
+    });
+    fs_composite_params_t composite_params = {
+        .source_size = { (float)volume_target.scaled_width, (float)volume_target.scaled_height },
+        .target_size = { (float)volume_target.width, (float)volume_target.height },
+        .weight = 1.0f / (float)volume_target.frames,
+        .depth_tolerance = 0.01f, // Relative difference in distance that halves a texel's weight against an exact match
+        .upsample = 1
+    };
+    sg_apply_uniforms(SG_SHADERSTAGE_FS, SLOT_fs_composite_params, &SG_RANGE(composite_params));
+    sg_draw(0, 3, 1);
+
     simgui_render();
     sg_end_pass();
     sg_commit();
@@ -1122,6 +6049,7 @@ void cleanup(void) {
     // fast_obj_destroy(mesh);
 
     cleanup_ecs();
+    free_staging();
     simgui_shutdown();
     sg_shutdown();
 }